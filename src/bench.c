@@ -0,0 +1,1298 @@
+#include "fontlist.c"
+#include "testutil.h"
+
+#include <stdio.h>
+
+static uint32_t g_rand_state = 2463534242u;
+
+static uint32_t xorshift32(void) {
+  g_rand_state ^= g_rand_state << 13;
+  g_rand_state ^= g_rand_state >> 17;
+  g_rand_state ^= g_rand_state << 5;
+  return g_rand_state;
+}
+
+// Generates font-like names such as "Noto Sans CJK JP 00042 Bold" or "Kanori Zenlu 00043 Light".
+// Half of them share a few long family names, the rest are made of random syllables.
+static wchar_t **generate_font_names(size_t const n) {
+  static wchar_t const *const syllables[] = {
+      L"ka",
+      L"no",
+      L"to",
+      L"sa",
+      L"ri",
+      L"mo",
+      L"zen",
+      L"han",
+      L"gar",
+      L"de",
+      L"lu",
+      L"vi",
+      L"xo",
+      L"pe",
+      L"qua",
+      L"ji",
+  };
+  static wchar_t const *const families[] = {
+      L"Noto Sans CJK JP",
+      L"Noto Serif CJK JP",
+      L"Source Han Sans",
+      L"Source Han Serif",
+      L"Adobe Garamond",
+      L"ＭＳ Ｐゴシック",
+      L"游ゴシック",
+      L"A1 Mincho",
+  };
+  static wchar_t const *const styles[] = {
+      L"Regular",
+      L"Bold",
+      L"Light",
+      L"Medium",
+  };
+  enum {
+    name_len = 32,
+  };
+  wchar_t **names = realloc(NULL, n * (sizeof(wchar_t *) + name_len * sizeof(wchar_t)));
+  if (!names) {
+    return NULL;
+  }
+  wchar_t *buf = (void *)(names + n);
+  for (size_t i = 0; i < n; ++i) {
+    names[i] = buf + i * name_len;
+    wchar_t family[20];
+    if (i % 2) {
+      wcscpy(family, families[xorshift32() % (sizeof(families) / sizeof(families[0]))]);
+    } else {
+      wsprintfW(family,
+                L"%s%s%s %s%s",
+                syllables[xorshift32() % (sizeof(syllables) / sizeof(syllables[0]))],
+                syllables[xorshift32() % (sizeof(syllables) / sizeof(syllables[0]))],
+                syllables[xorshift32() % (sizeof(syllables) / sizeof(syllables[0]))],
+                syllables[xorshift32() % (sizeof(syllables) / sizeof(syllables[0]))],
+                syllables[xorshift32() % (sizeof(syllables) / sizeof(syllables[0]))]);
+    }
+    wsprintfW(names[i], L"%s %05d %s", family, (int)i, styles[xorshift32() % (sizeof(styles) / sizeof(styles[0]))]);
+  }
+  return names;
+}
+
+static double now(void) {
+  static LARGE_INTEGER freq = {0};
+  if (!freq.QuadPart) {
+    QueryPerformanceFrequency(&freq);
+  }
+  LARGE_INTEGER c;
+  QueryPerformanceCounter(&c);
+  return (double)c.QuadPart / (double)freq.QuadPart;
+}
+
+static int font_list_index_of_linear(struct font_list const *const fl, wchar_t const *const s) {
+  struct font_dict_cursor c = {0};
+  for (size_t i = 0; i < fl->num; ++i) {
+    font_dict_cursor_seek(&c, fl, i);
+    if (wcscmp(s, c.name) == 0) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+static void bench_font_list_index_of(void) {
+  static size_t const sizes[] = {1000, 10000, 50000};
+  enum {
+    lookups = 2000,
+  };
+  printf("font_list_index_of (%d lookups)\n", (int)lookups);
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); ++si) {
+    size_t const n = sizes[si];
+    wchar_t **names = generate_font_names(n);
+    struct font_list fl = {0};
+    if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+      printf("  failed to create font list\n");
+      free(names);
+      return;
+    }
+    // The second half receives the indices that font_list_index_of found.
+    size_t *queries = realloc(NULL, lookups * 2 * sizeof(size_t));
+    if (!queries) {
+      font_list_destroy(&fl);
+      free(names);
+      return;
+    }
+    for (size_t i = 0; i < lookups; ++i) {
+      queries[i] = xorshift32() % n;
+    }
+
+    int sink = 0;
+    double t = now();
+    for (size_t i = 0; i < lookups; ++i) {
+      sink += font_list_index_of_linear(&fl, names[queries[i]]);
+    }
+    double const linear = now() - t;
+    t = now();
+    for (size_t i = 0; i < lookups; ++i) {
+      int const idx = font_list_index_of(&fl, names[queries[i]]);
+      queries[lookups + i] = (size_t)idx;
+      sink -= idx;
+    }
+    double const dict = now() - t;
+    t = now();
+    for (size_t i = 0; i < lookups; ++i) {
+      wchar_t buf[font_name_buffer_len];
+      font_list_get_name(&fl, queries[lookups + i], buf);
+      sink += wcscmp(buf, names[queries[i]]) != 0;
+    }
+    double const get_name = now() - t;
+    printf("  %6d fonts: linear %10.1f ns/op, dictionary %8.1f ns/op, get name %8.1f ns/op%s\n",
+           (int)n,
+           linear * 1e9 / lookups,
+           dict * 1e9 / lookups,
+           get_name * 1e9 / lookups,
+           sink ? " (mismatch!)" : "");
+
+    free(queries);
+    font_list_destroy(&fl);
+    free(names);
+  }
+}
+
+static size_t font_list_prefix_count_linear(struct font_list const *const fl, wchar_t const *const prefix) {
+  struct font_dict_cursor c = {0};
+  size_t const len = wcslen(prefix);
+  size_t count = 0;
+  for (size_t i = 0; i < fl->num; ++i) {
+    font_dict_cursor_seek(&c, fl, i);
+    if (c.namelen >= len &&
+        CompareStringW(LOCALE_USER_DEFAULT, font_list_collation_flags, c.name, (int)len, prefix, (int)len) ==
+            CSTR_EQUAL) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+static void bench_font_list_prefix_range(void) {
+  static size_t const sizes[] = {1000, 10000, 50000};
+  enum {
+    lookups = 200,
+  };
+  printf("font_list_prefix_range (%d lookups)\n", (int)lookups);
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); ++si) {
+    size_t const n = sizes[si];
+    wchar_t **names = generate_font_names(n);
+    struct font_list fl = {0};
+    if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+      printf("  failed to create font list\n");
+      free(names);
+      return;
+    }
+    // Prefixes of 1 to 8 characters of the existing names, as typed into the font field.
+    wchar_t(*prefixes)[font_name_buffer_len] = realloc(NULL, lookups * sizeof(*prefixes));
+    if (!prefixes) {
+      font_list_destroy(&fl);
+      free(names);
+      return;
+    }
+    for (size_t i = 0; i < lookups; ++i) {
+      wchar_t const *const name = names[xorshift32() % n];
+      size_t const len = 1 + xorshift32() % 8;
+      wcsncpy(prefixes[i], name, len);
+      prefixes[i][len] = L'\0';
+    }
+
+    size_t linear_matches = 0, matches = 0;
+    double t = now();
+    for (size_t i = 0; i < lookups; ++i) {
+      linear_matches += font_list_prefix_count_linear(&fl, prefixes[i]);
+    }
+    double const linear = now() - t;
+    t = now();
+    for (size_t i = 0; i < lookups; ++i) {
+      size_t first = 0, last = 0;
+      if (font_list_prefix_range(&fl, prefixes[i], &first, &last)) {
+        matches += last - first;
+      }
+    }
+    double const range = now() - t;
+    printf("  %6d fonts: linear %10.1f us/op, binary search %6.1f us/op, %8.1f matches/op%s\n",
+           (int)n,
+           linear * 1e6 / lookups,
+           range * 1e6 / lookups,
+           (double)matches / lookups,
+           matches != linear_matches ? " (mismatch!)" : "");
+
+    free(prefixes);
+    font_list_destroy(&fl);
+    free(names);
+  }
+}
+
+static void bench_font_list_family(void) {
+  static size_t const sizes[] = {1000, 10000, 50000};
+  static wchar_t const *const weights[] = {
+      L"Thin",
+      L"Light",
+      L"Regular",
+      L"Medium",
+      L"Bold",
+      L"Black",
+      L"Italic",
+      L"Bold Italic",
+  };
+  enum {
+    steps = 100000,
+  };
+  printf("font family index (%d steps)\n", (int)steps);
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); ++si) {
+    size_t const n = sizes[si];
+    // Families of eight styles such as "Family 00042 Bold".
+    wchar_t **names = generate_font_names(n);
+    if (names) {
+      for (size_t i = 0; i < n; ++i) {
+        wsprintfW(names[i], L"Family %05d %s", (int)(i / 8), weights[i % 8]);
+      }
+    }
+    struct font_list fl = {0};
+    if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+      printf("  failed to create font list\n");
+      free(names);
+      return;
+    }
+    // Rebuild the index alone to time it.
+    free(fl.family.members);
+    free(fl.family.offsets);
+    fl.family = (struct font_family_index){0};
+    double t = now();
+    bool const built = font_list_build_family(&fl);
+    double const build = now() - t;
+    if (!built) {
+      printf("  failed to build font family index\n");
+      font_list_destroy(&fl);
+      free(names);
+      return;
+    }
+    size_t idx = xorshift32() % n;
+    t = now();
+    for (size_t i = 0; i < steps; ++i) {
+      idx = font_list_step_in_family(&fl, idx, i % 2 ? 1 : -1);
+    }
+    double const in_family = now() - t;
+    t = now();
+    for (size_t i = 0; i < steps; ++i) {
+      idx = font_list_step_family(&fl, idx, (i / 1000) % 2 ? 1 : -1);
+    }
+    double const across = now() - t;
+    printf("  %6d fonts: %6d families, build %8.3f ms, in family %6.1f ns/step, across %6.1f ns/step (%d)\n",
+           (int)n,
+           (int)fl.family.num,
+           build * 1e3,
+           in_family * 1e9 / steps,
+           across * 1e9 / steps,
+           (int)idx);
+
+    font_list_destroy(&fl);
+    free(names);
+  }
+}
+
+static int compare_string(void const *n1, void const *n2) {
+  int const r = CompareStringW(LOCALE_USER_DEFAULT,
+                               font_list_collation_flags,
+                               *(wchar_t const *const *)n1,
+                               -1,
+                               *(wchar_t const *const *)n2,
+                               -1);
+  return r - 2;
+}
+
+static double sort_by_sort_keys(wchar_t const **const names, size_t const n) {
+  struct enum_font_data fd = {0};
+  struct font_build_chunk c = {.fd = &fd};
+  struct font_sort_entry *entries = realloc(NULL, n * sizeof(struct font_sort_entry));
+  size_t *keyend = realloc(NULL, n * sizeof(size_t));
+  double elapsed = -1;
+  if (!entries || !keyend) {
+    goto cleanup;
+  }
+  double const start = now();
+  for (size_t i = 0; i < n; ++i) {
+    if (!font_build_chunk_sort_key(&c, names[i], wcslen(names[i]))) {
+      goto cleanup;
+    }
+    keyend[i] = c.keyspos;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    size_t const begin = i ? keyend[i - 1] : 0;
+    entries[i] = (struct font_sort_entry){
+        .key = c.keys + begin,
+        .keylen = keyend[i] - begin,
+        .name = names[i],
+        .idx = i,
+    };
+    for (size_t j = 0; j < 8; ++j) {
+      entries[i].prefix = (entries[i].prefix << 8) | (j < entries[i].keylen ? entries[i].key[j] : 0);
+    }
+  }
+  qsort(entries, n, sizeof(struct font_sort_entry), compare_sort_entry);
+  elapsed = now() - start;
+
+cleanup:
+  free(c.keys);
+  free(keyend);
+  free(entries);
+  return elapsed;
+}
+
+static void bench_font_list_sort(void) {
+  static size_t const sizes[] = {1000, 10000, 50000};
+  printf("font list sort\n");
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); ++si) {
+    size_t const n = sizes[si];
+    wchar_t **names = generate_font_names(n);
+    if (!names) {
+      printf("  failed to allocate names\n");
+      return;
+    }
+    wchar_t const **sorted = realloc(NULL, n * sizeof(wchar_t const *));
+    if (!sorted) {
+      free(names);
+      return;
+    }
+    memcpy(sorted, names, n * sizeof(wchar_t const *));
+    double t = now();
+    qsort(sorted, n, sizeof(wchar_t const *), compare_string);
+    double const compare = now() - t;
+    memcpy(sorted, names, n * sizeof(wchar_t const *));
+    double const keys = sort_by_sort_keys(sorted, n);
+    struct font_list fl = {0};
+    t = now();
+    bool const built = create_font_list_from_names(&fl, (wchar_t const *const *)names, n);
+    double const build = now() - t;
+    printf("  %6d fonts: CompareStringW %8.3f ms, sort keys %8.3f ms, build %8.3f ms (%d workers)%s\n",
+           (int)n,
+           compare * 1e3,
+           keys * 1e3,
+           build * 1e3,
+           (int)font_build_worker_count(n),
+           built && keys >= 0 ? "" : " (failed!)");
+    font_list_destroy(&fl);
+    free(sorted);
+    free(names);
+  }
+}
+
+static void bench_similar_scorer(void) {
+  static wchar_t const *const queries[] = {
+      L"NOTO",
+      L"SOURCE HAN SANS 01234",
+      L"ゆうこしつく",
+      L"ADOBE GARAMOND BOLD",
+  };
+  enum {
+    n = 10000,
+  };
+  printf("similarity scorer (%d fonts)\n", (int)n);
+  wchar_t **names = generate_font_names(n);
+  struct font_list fl = {0};
+  if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+    printf("  failed to create font list\n");
+    free(names);
+    return;
+  }
+  struct diff diff = {0};
+  struct bitlcs bitlcs;
+  struct font_dict_cursor c = {0};
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    wchar_t const *const q = queries[qi];
+    int sink = 0;
+    double t = now();
+    for (size_t i = 0; i < fl.num; ++i) {
+      font_dict_cursor_seek(&c, &fl, i);
+      diff_init(&diff, q, (int)wcslen(q), font_dict_cursor_norm(&c, &fl), (int)fl.normlen[i]);
+      sink += diff_distance(&diff, INT_MAX);
+    }
+    double const onp = now() - t;
+    t = now();
+    bitlcs_init(&bitlcs, q, (int)(wcslen(q)));
+    for (size_t i = 0; i < fl.num; ++i) {
+      font_dict_cursor_seek(&c, &fl, i);
+      sink -= bitlcs_distance(&bitlcs, font_dict_cursor_norm(&c, &fl), (int)fl.normlen[i]);
+    }
+    double const bp = now() - t;
+    printf("  query #%d (%2d chars): O(NP) %8.3f ms, bit-parallel %8.3f ms%s\n",
+           (int)qi,
+           (int)(wcslen(q)),
+           onp * 1e3,
+           bp * 1e3,
+           sink ? " (mismatch!)" : "");
+  }
+  free(diff.fpbuf);
+  font_list_destroy(&fl);
+  free(names);
+}
+
+static int compare_similar(void const *const n1, void const *const n2) {
+  int const x = ((struct font_similar const *)n1)->score;
+  int const y = ((struct font_similar const *)n2)->score;
+  return x == y ? 0 : x > y ? 1 : -1;
+}
+
+// The implementation before font_get_similar_topk: score all fonts and sort them.
+static struct font_similar *font_get_similar_qsort(struct font_list const *const fl, wchar_t const *const s) {
+  struct similar_query q;
+  if (!similar_query_init(&q, s)) {
+    return NULL;
+  }
+  struct font_similar *sim = realloc(NULL, fl->num * sizeof(struct font_similar));
+  if (sim) {
+    struct font_dict_cursor c = {0};
+    for (size_t i = 0; i < fl->num; ++i) {
+      font_dict_cursor_seek(&c, fl, i);
+      sim[i].idx = (int)i;
+      sim[i].score = similar_query_score(&q, font_dict_cursor_norm(&c, fl), fl->normlen[i], INT_MAX);
+    }
+    qsort(sim, fl->num, sizeof(struct font_similar), compare_similar);
+  }
+  similar_query_free(&q);
+  return sim;
+}
+
+static void bench_similar_topk(void) {
+  static wchar_t const *const queries[] = {
+      L"noto",
+      L"source han sans 01234",
+      L"adobe garamond bold",
+  };
+  enum {
+    n = 10000,
+    k = 10,
+    iterations = 20,
+  };
+  printf("top-%d selection (%d fonts, %d iterations)\n", (int)k, (int)n, (int)iterations);
+  wchar_t **names = generate_font_names(n);
+  struct font_list fl = {0};
+  if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+    printf("  failed to create font list\n");
+    free(names);
+    return;
+  }
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    int sink = 0;
+    double t = now();
+    for (size_t i = 0; i < iterations; ++i) {
+      struct font_similar *sim = font_get_similar_qsort(&fl, queries[qi]);
+      if (sim) {
+        sink += sim[0].score;
+        free(sim);
+      }
+    }
+    double const sorted = now() - t;
+    struct font_similar_stats stats = {0};
+    t = now();
+    for (size_t i = 0; i < iterations; ++i) {
+      struct font_similar out[k];
+      if (font_get_similar_topk(&fl, queries[qi], k, out, &stats)) {
+        sink -= out[0].score;
+      }
+    }
+    double const topk = now() - t;
+    printf("  query #%d: qsort %8.3f ms/op, top-k %8.3f ms/op (%d scored, %d pruned)%s\n",
+           (int)qi,
+           sorted * 1e3 / iterations,
+           topk * 1e3 / iterations,
+           (int)stats.scored,
+           (int)stats.pruned,
+           sink ? " (mismatch!)" : "");
+  }
+  font_list_destroy(&fl);
+  free(names);
+}
+
+static void bench_similar_alphabet(void) {
+  static wchar_t const *const queries[] = {
+      L"noto",
+      L"ゆうこしつく",
+      L"source han sans 01234",
+      L"adobe garamond bold source han serif light noto sans cjk jp medium 0123456789",
+  };
+  enum {
+    n = 10000,
+    iterations = 20,
+  };
+  printf("alphabet codes (%d fonts, %d iterations)\n", (int)n, (int)iterations);
+  wchar_t **names = generate_font_names(n);
+  struct font_list fl = {0};
+  if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+    printf("  failed to create font list\n");
+    free(names);
+    return;
+  }
+  // The normalized names as code units, which is what the scorers compared before the alphabet.
+  size_t narrow = 0, wide_size = 0, coded_size = 0;
+  wchar_t *norms = realloc(NULL, fl.num * font_dict_norm_buffer_len * sizeof(wchar_t));
+  if (!norms) {
+    font_list_destroy(&fl);
+    free(names);
+    return;
+  }
+  struct font_dict_cursor c = {0};
+  for (size_t i = 0; i < fl.num; ++i) {
+    font_dict_cursor_seek(&c, &fl, i);
+    wcscpy(norms + i * font_dict_norm_buffer_len, font_dict_cursor_norm(&c, &fl));
+    wide_size += c.normlen * sizeof(wchar_t);
+    coded_size += c.narrow ? (c.normlen + 1) / 2 * sizeof(wchar_t) : c.normlen * sizeof(wchar_t);
+    narrow += c.narrow;
+  }
+  printf("  %d / %d names coded, normalized names %d bytes as code units, %d bytes coded\n",
+         (int)narrow,
+         (int)fl.num,
+         (int)wide_size,
+         (int)coded_size);
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    struct similar_query q;
+    if (!similar_query_init(&q, queries[qi]) || !similar_query_encode(&q, &fl)) {
+      printf("  failed to initialize query\n");
+      similar_query_free(&q);
+      continue;
+    }
+    size_t const qlen = q.snlen;
+    int sink = 0;
+    double t = now();
+    for (size_t it = 0; it < iterations; ++it) {
+      for (size_t i = 0; i < fl.num; ++i) {
+        sink += similar_query_score(&q, norms + i * font_dict_norm_buffer_len, fl.normlen[i], INT_MAX);
+      }
+    }
+    double const wide = now() - t;
+    t = now();
+    for (size_t it = 0; it < iterations; ++it) {
+      for (size_t i = 0; i < fl.num; ++i) {
+        font_dict_cursor_seek(&c, &fl, i);
+        sink -= c.narrow ? similar_query_score_code(&q, c.code, c.normlen, INT_MAX)
+                         : similar_query_score(&q, font_dict_cursor_norm(&c, &fl), c.normlen, INT_MAX);
+      }
+    }
+    double const coded = now() - t;
+    similar_query_free(&q);
+    t = now();
+    for (size_t it = 0; it < iterations; ++it) {
+      free(font_get_similar(&fl, queries[qi]));
+    }
+    double const similar = now() - t;
+    printf("  query #%d (%2d chars): code units %8.3f ms/op, codes %8.3f ms/op, font_get_similar %8.3f ms/op%s\n",
+           (int)qi,
+           (int)qlen,
+           wide * 1e3 / iterations,
+           coded * 1e3 / iterations,
+           similar * 1e3 / iterations,
+           sink ? " (mismatch!)" : "");
+  }
+  free(norms);
+  font_list_destroy(&fl);
+  free(names);
+}
+
+static void bench_similar_batch(void) {
+  static wchar_t const *const queries[] = {
+      L"noto",
+      L"zenquaji",
+      L"garamond 01234",
+      L"source han serif",
+  };
+  enum {
+    n = 50000,
+    k = 10,
+    iterations = 20,
+  };
+  printf("batch scoring (%d fonts, top-%d, %d iterations)\n", (int)n, (int)k, (int)iterations);
+  wchar_t **names = generate_font_names(n);
+  struct font_list fl = {0};
+  if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+    printf("  failed to create font list\n");
+    free(names);
+    return;
+  }
+  struct {
+    char const *name;
+    similar_batch_fn fn;
+  } kernels[3] = {{"scalar", similar_batch_scalar}};
+  size_t num_kernels = 1;
+#ifdef FONTLIST_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2")) {
+    kernels[num_kernels].name = "sse2";
+    kernels[num_kernels++].fn = similar_batch_sse2;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    kernels[num_kernels].name = "avx2";
+    kernels[num_kernels++].fn = similar_batch_avx2;
+  }
+#endif
+  size_t const num_blocks = font_batch_num_blocks(fl.num);
+  struct font_dict_cursor c = {0};
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    struct similar_query q;
+    if (!similar_query_init(&q, queries[qi]) || !similar_query_encode(&q, &fl) || !q.batch_fn) {
+      printf("  failed to initialize query\n");
+      similar_query_free(&q);
+      continue;
+    }
+    printf("  query #%d (%2d chars):\n", (int)qi, (int)q.snlen);
+    // One name at a time over the coded names, which is what the full scan did before the blocks.
+    long long expected = 0;
+    double t = now();
+    for (size_t it = 0; it < iterations; ++it) {
+      expected = 0;
+      for (size_t i = 0; i < fl.num; ++i) {
+        font_dict_cursor_seek(&c, &fl, i);
+        if (c.narrow) {
+          expected += similar_query_score_code(&q, c.code, c.normlen, INT_MAX);
+        }
+      }
+    }
+    double const base = now() - t;
+    printf("    per name %8.3f ms/op\n", base * 1e3 / iterations);
+    for (size_t ki = 0; ki < num_kernels; ++ki) {
+      long long sum = 0;
+      t = now();
+      for (size_t it = 0; it < iterations; ++it) {
+        sum = 0;
+        for (size_t b = 0; b < num_blocks; ++b) {
+          uint32_t const offset = fl.batch.offsets[b];
+          uint16_t v[font_batch_lanes];
+          kernels[ki].fn(&q.batch, fl.batch.codes + offset, (fl.batch.offsets[b + 1] - offset) / font_batch_lanes, v);
+          for (size_t lane = 0; lane < font_batch_lanes && b * font_batch_lanes + lane < fl.num; ++lane) {
+            if (!(fl.batch.wide[b] & (1u << lane))) {
+              sum += bitlcs_score(v[lane], (int)q.snlen, (int)fl.normlen[b * font_batch_lanes + lane]);
+            }
+          }
+        }
+      }
+      double const batch = now() - t;
+      printf("    %-8s %8.3f ms/op (%5.2fx)%s\n",
+             kernels[ki].name,
+             batch * 1e3 / iterations,
+             base / batch,
+             sum != expected ? " (mismatch!)" : "");
+    }
+    similar_query_free(&q);
+    struct font_similar out[k];
+    struct font_qgram_index const qgram = fl.qgram;
+    fl.qgram.keys = NULL;
+    t = now();
+    for (size_t it = 0; it < iterations; ++it) {
+      font_get_similar_topk(&fl, queries[qi], k, out, NULL);
+    }
+    double const topk = now() - t;
+    fl.qgram = qgram;
+    printf("    font_get_similar_topk full scan %8.3f ms/op\n", topk * 1e3 / iterations);
+  }
+  font_list_destroy(&fl);
+  free(names);
+}
+
+static void bench_similar_threads(void) {
+  static size_t const threads[] = {1, 2, 4, 8};
+  static wchar_t const *const queries[] = {
+      L"noto",
+      L"garamond 01234",
+      L"source han serif bold light medium",
+  };
+  enum {
+    n = 90000,
+    k = 10,
+    iterations = 10,
+  };
+  printf("worker pool (%d fonts, full scan, %d iterations)\n", (int)n, (int)iterations);
+  wchar_t **names = generate_font_names(n);
+  struct font_list fl = {0};
+  if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+    printf("  failed to create font list\n");
+    free(names);
+    return;
+  }
+  struct font_similar *out = realloc(NULL, fl.num * sizeof(struct font_similar));
+  if (!out) {
+    font_list_destroy(&fl);
+    free(names);
+    return;
+  }
+  struct font_qgram_index const qgram = fl.qgram;
+  fl.qgram.keys = NULL;
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    printf("  query #%d:\n", (int)qi);
+    double base_topk = 0, base_all = 0;
+    for (size_t ti = 0; ti < sizeof(threads) / sizeof(threads[0]); ++ti) {
+      struct thread_pool *pool = NULL;
+      if (threads[ti] > 1 && !thread_pool_create(&pool, threads[ti])) {
+        printf("    failed to create worker pool\n");
+        continue;
+      }
+      fl.pool = pool;
+      double t = now();
+      for (size_t i = 0; i < iterations; ++i) {
+        font_get_similar_topk(&fl, queries[qi], k, out, NULL);
+      }
+      double const topk = now() - t;
+      t = now();
+      for (size_t i = 0; i < iterations; ++i) {
+        font_get_similar_topk(&fl, queries[qi], fl.num, out, NULL);
+      }
+      double const all = now() - t;
+      fl.pool = NULL;
+      thread_pool_destroy(&pool);
+      if (ti == 0) {
+        base_topk = topk;
+        base_all = all;
+      }
+      printf("    %d threads: top-%d %8.3f ms/op (%5.2fx), all %8.3f ms/op (%5.2fx)\n",
+             (int)threads[ti],
+             (int)k,
+             topk * 1e3 / iterations,
+             base_topk / topk,
+             all * 1e3 / iterations,
+             base_all / all);
+    }
+  }
+  fl.qgram = qgram;
+  free(out);
+  font_list_destroy(&fl);
+  free(names);
+}
+
+static void bench_similar_cached(void) {
+  static wchar_t const *const typed[] = {
+      L"source han serif 01234",
+      L"noto sans cjk jp bold",
+      L"zenquaji",
+  };
+  enum {
+    n = 50000,
+    k = 10,
+    iterations = 10,
+  };
+  printf("incremental query cache (%d fonts, top-%d, %d iterations)\n", (int)n, (int)k, (int)iterations);
+  wchar_t **names = generate_font_names(n);
+  struct font_list fl = {0};
+  if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+    printf("  failed to create font list\n");
+    free(names);
+    return;
+  }
+  struct font_qgram_index const qgram = fl.qgram;
+  for (size_t ti = 0; ti < sizeof(typed) / sizeof(typed[0]); ++ti) {
+    // Every prefix of the text, as if it was typed one character at a time.
+    size_t const len = wcslen(typed[ti]);
+    wchar_t query[64];
+    struct font_similar out[k];
+    size_t scored = 0;
+    double t = now();
+    for (size_t it = 0; it < iterations; ++it) {
+      for (size_t l = 1; l <= len; ++l) {
+        wcsncpy(query, typed[ti], l);
+        query[l] = L'\0';
+        font_get_similar_topk(&fl, query, k, out, NULL);
+      }
+    }
+    double const indexed = now() - t;
+    fl.qgram.keys = NULL;
+    t = now();
+    for (size_t it = 0; it < iterations; ++it) {
+      for (size_t l = 1; l <= len; ++l) {
+        wcsncpy(query, typed[ti], l);
+        query[l] = L'\0';
+        font_get_similar_topk(&fl, query, k, out, NULL);
+      }
+    }
+    double const full = now() - t;
+    fl.qgram = qgram;
+    struct font_similar_cache cache = {0};
+    t = now();
+    for (size_t it = 0; it < iterations; ++it) {
+      for (size_t l = 1; l <= len; ++l) {
+        wcsncpy(query, typed[ti], l);
+        query[l] = L'\0';
+        struct font_similar_stats stats;
+        font_get_similar_cached(&fl, &cache, query, k, out, &stats, NULL, NULL);
+        scored += stats.scored;
+        // and once more, as when the popup is opened again without typing.
+        font_get_similar_cached(&fl, &cache, query, k, out, NULL, NULL, NULL);
+      }
+    }
+    double const cached = now() - t;
+    double const keys = (double)(len * iterations);
+    printf("  \"%ls\": per key: bigram index %8.3f ms, full scan %8.3f ms, cached %8.3f ms "
+           "(%d scored per key, %d hits, %d refines, %d misses)\n",
+           typed[ti],
+           indexed * 1e3 / keys,
+           full * 1e3 / keys,
+           cached * 1e3 / keys,
+           (int)((double)scored / keys),
+           (int)cache.hits,
+           (int)cache.refines,
+           (int)cache.misses);
+    font_similar_cache_free(&cache);
+  }
+  font_list_destroy(&fl);
+  free(names);
+}
+
+static void bench_similar_recent(void) {
+  // Partial names that are typed again and again in a session.
+  static wchar_t const *const queries[] = {
+      L"ms",
+      L"noto",
+      L"source han",
+      L"zenquaji",
+      L"garamond",
+      L"noto serif",
+      L"mincho",
+      L"gothic",
+  };
+  enum {
+    n = 50000,
+    k = 10,
+    rounds = 20,
+    num_queries = sizeof(queries) / sizeof(queries[0]),
+  };
+  printf("recent queries (%d fonts, top-%d, %d queries x %d rounds)\n", (int)n, (int)k, (int)num_queries, (int)rounds);
+  wchar_t **names = generate_font_names(n);
+  struct font_list fl = {0};
+  if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+    printf("  failed to create font list\n");
+    free(names);
+    return;
+  }
+  struct font_similar out[k];
+  double t = now();
+  for (size_t r = 0; r < rounds; ++r) {
+    for (size_t qi = 0; qi < num_queries; ++qi) {
+      font_get_similar_topk(&fl, queries[qi], k, out, NULL);
+    }
+  }
+  double const plain = now() - t;
+  struct font_similar_cache cache = {0};
+  t = now();
+  for (size_t r = 0; r < rounds; ++r) {
+    for (size_t qi = 0; qi < num_queries; ++qi) {
+      font_get_similar_cached(&fl, &cache, queries[qi], k, out, NULL, NULL, NULL);
+    }
+  }
+  double const cached = now() - t;
+  size_t const total = rounds * num_queries;
+  printf("  per query: topk %8.3f ms, cached %8.3f ms "
+         "(%d hits, %d recent hits, %d refines, %d misses, hit rate %d%%)\n",
+         plain * 1e3 / (double)total,
+         cached * 1e3 / (double)total,
+         (int)cache.hits,
+         (int)cache.recent_hits,
+         (int)cache.refines,
+         (int)cache.misses,
+         (int)((cache.hits + cache.recent_hits) * 100 / total));
+  font_similar_cache_free(&cache);
+  font_list_destroy(&fl);
+  free(names);
+}
+
+static void bench_similar_preferred(void) {
+  static wchar_t const *const queries[] = {
+      L"source han serif",
+      L"noto sans cjk jp bold",
+      L"zenquaji",
+  };
+  enum {
+    n = 50000,
+    k = 10,
+    iterations = 10,
+  };
+  printf("preferred fonts (%d fonts, top-%d, %d preferred, %d iterations)\n",
+         (int)n,
+         (int)k,
+         (int)font_similar_preferred_max,
+         (int)iterations);
+  wchar_t **names = generate_font_names(n);
+  struct font_list fl = {0};
+  if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+    printf("  failed to create font list\n");
+    free(names);
+    return;
+  }
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    // The preferred fonts are random ones, or the top k of the query followed by random ones,
+    // as when the fonts looked for are the ones used often.
+    struct font_similar out[k];
+    struct font_similar_preferred unrelated = {.num = font_similar_preferred_max};
+    struct font_similar_preferred matching = {.num = font_similar_preferred_max};
+    size_t const good = font_get_similar_topk(&fl, queries[qi], k, out, NULL);
+    for (size_t i = 0; i < font_similar_preferred_max; ++i) {
+      unrelated.idx[i] = (int)(xorshift32() % n);
+      matching.idx[i] = i < good ? out[i].idx : unrelated.idx[i];
+    }
+    struct font_similar_preferred const *const modes[] = {NULL, &unrelated, &matching};
+    double elapsed[3];
+    size_t scored[3] = {0};
+    for (size_t mode = 0; mode < 3; ++mode) {
+      double const t = now();
+      for (size_t it = 0; it < iterations; ++it) {
+        // A new cache each time, so that every query scans all fonts.
+        struct font_similar_cache cache = {0};
+        struct font_similar_stats stats;
+        font_get_similar_cached(&fl, &cache, queries[qi], k, out, &stats, NULL, modes[mode]);
+        scored[mode] += stats.scored;
+        font_similar_cache_free(&cache);
+      }
+      elapsed[mode] = now() - t;
+    }
+    printf("  \"%ls\": none %8.3f ms (%d scored), unrelated %8.3f ms (%d scored), matching %8.3f ms (%d scored)\n",
+           queries[qi],
+           elapsed[0] * 1e3 / iterations,
+           (int)(scored[0] / iterations),
+           elapsed[1] * 1e3 / iterations,
+           (int)(scored[1] / iterations),
+           elapsed[2] * 1e3 / iterations,
+           (int)(scored[2] / iterations));
+  }
+  font_list_destroy(&fl);
+  free(names);
+}
+
+static void bench_similar_qgram(void) {
+  static size_t const sizes[] = {10000, 50000};
+  static wchar_t const *const queries[] = {
+      L"noto",
+      L"zenquaji",
+      L"kanori",
+      L"garamond 01234",
+      L"source han serif bold",
+  };
+  enum {
+    k = 10,
+    iterations = 20,
+  };
+  printf("bigram index (top-%d, %d iterations)\n", (int)k, (int)iterations);
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); ++si) {
+    size_t const n = sizes[si];
+    wchar_t **names = generate_font_names(n);
+    struct font_list fl = {0};
+    if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+      printf("  failed to create font list\n");
+      free(names);
+      return;
+    }
+    printf("  %6d fonts: index %d bytes (postings %d bytes)\n",
+           (int)n,
+           (int)((fl.qgram.mask + 1) * 2 * sizeof(uint32_t) + fl.qgram.postings_size),
+           (int)fl.qgram.postings_size);
+    for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+      struct font_similar out[k];
+      struct font_similar_stats stats = {0};
+      struct font_qgram_index const qgram = fl.qgram;
+      fl.qgram.keys = NULL;
+      double t = now();
+      for (size_t i = 0; i < iterations; ++i) {
+        font_get_similar_topk(&fl, queries[qi], k, out, NULL);
+      }
+      double const full = now() - t;
+      fl.qgram = qgram;
+      t = now();
+      for (size_t i = 0; i < iterations; ++i) {
+        font_get_similar_topk(&fl, queries[qi], k, out, &stats);
+      }
+      double const indexed = now() - t;
+      printf("    query #%d: full scan %8.3f ms/op, indexed %8.3f ms/op (%d candidates)\n",
+             (int)qi,
+             full * 1e3 / iterations,
+             indexed * 1e3 / iterations,
+             (int)stats.candidates);
+    }
+    font_list_destroy(&fl);
+    free(names);
+  }
+}
+
+static void bench_font_cache(void) {
+  static size_t const sizes[] = {10000, 50000};
+  wchar_t path[MAX_PATH];
+  DWORD const len = GetTempPathW(MAX_PATH, path);
+  if (len == 0 || len + 32 >= MAX_PATH) {
+    return;
+  }
+  wsprintfW(path + len, L"textassist_bench_%u.fontcache", (unsigned)GetCurrentProcessId());
+  printf("font list cache\n");
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); ++si) {
+    size_t const n = sizes[si];
+    wchar_t **names = generate_font_names(n);
+    struct font_list fl = {0}, cached = {0};
+    double t = now();
+    if (!names || !create_font_list_from_names(&fl, (wchar_t const *const *)names, n)) {
+      printf("  failed to create font list\n");
+      free(names);
+      return;
+    }
+    double const build = now() - t;
+    struct font_cache_key const key = {.count = (uint32_t)n, .hash = 1, .lcid = 1};
+    t = now();
+    bool const saved = font_cache_save(&fl, &key, path);
+    double const save = now() - t;
+    t = now();
+    bool const loaded = saved && font_cache_load(&cached, &key, path);
+    double const load = now() - t;
+    printf("  %6d fonts: build %9.3f ms, save %8.3f ms, load %8.3f ms%s\n",
+           (int)n,
+           build * 1e3,
+           save * 1e3,
+           load * 1e3,
+           loaded ? "" : " (failed!)");
+    struct font_list_memory_usage mu;
+    font_list_memory_usage(&fl, &mu);
+    printf("    memory %d bytes: text %d, restarts %d, signature %d, bigram %d, family %d\n",
+           (int)mu.total,
+           (int)mu.text,
+           (int)mu.restarts,
+           (int)mu.signature,
+           (int)mu.qgram,
+           (int)mu.family);
+    font_list_destroy(&cached);
+    font_list_destroy(&fl);
+    free(names);
+  }
+  DeleteFileW(path);
+}
+
+// The previous implementation: linear duplicate check and fixed-size growth.
+static int CALLBACK enum_font_callback_linear(const LOGFONTW *lf,
+                                             const TEXTMETRICW *tm,
+                                             DWORD fontType,
+                                             LPARAM lParam) {
+  (void)tm;
+  (void)fontType;
+  struct enum_font_data *fd = (struct enum_font_data *)lParam;
+  wchar_t const *facename = lf->lfFaceName[0] == L'@' ? lf->lfFaceName + 1 : lf->lfFaceName;
+  for (size_t i = 0; i < fd->n; ++i) {
+    if (wcscmp(fd->buf + fd->list.pos[i], facename) == 0) {
+      return TRUE;
+    }
+  }
+  size_t const namelen = wcslen(facename);
+  if (fd->pos + namelen + 1 > fd->len) {
+    fd->len += buffer_size;
+    if (!my_realloc(&fd->buf, (size_t)(fd->len) * sizeof(wchar_t))) {
+      return FALSE;
+    }
+  }
+  memcpy(fd->buf + fd->pos, facename, (namelen + 1) * sizeof(wchar_t));
+  if (fd->n == fd->listlen) {
+    fd->listlen += buffer_size;
+    if (!my_realloc(&fd->list, (size_t)(fd->listlen) * sizeof(wchar_t *))) {
+      return FALSE;
+    }
+  }
+  fd->list.pos[fd->n] = fd->pos;
+  fd->pos += namelen + 1;
+  fd->textlen += namelen + 1;
+  ++fd->n;
+  return TRUE;
+}
+
+static double enumerate_font_names(FONTENUMPROCW const proc,
+                                   LOGFONTW const *const stream,
+                                   size_t const n,
+                                   size_t *const unique) {
+  struct enum_font_data fd = {0};
+  double const t = now();
+  for (size_t i = 0; i < n; ++i) {
+    if (!proc(&stream[i], NULL, TRUETYPE_FONTTYPE, (LPARAM)&fd)) {
+      break;
+    }
+  }
+  double const elapsed = now() - t;
+  *unique = fd.n;
+  enum_font_data_free(&fd);
+  return elapsed;
+}
+
+static void bench_enum_font_callback(void) {
+  static size_t const sizes[] = {10000, 50000};
+  printf("enum_font_callback (every 4th name also has an @ vertical variant)\n");
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); ++si) {
+    size_t const n = sizes[si];
+    wchar_t **names = generate_font_names(n);
+    LOGFONTW *stream = realloc(NULL, (n + n / 4) * sizeof(LOGFONTW));
+    if (!names || !stream) {
+      printf("  failed to allocate names\n");
+      free(stream);
+      free(names);
+      return;
+    }
+    size_t len = 0;
+    for (size_t i = 0; i < n; ++i) {
+      stream[len] = (LOGFONTW){0};
+      wcscpy(stream[len++].lfFaceName, names[i]);
+      if (i % 4 == 0) {
+        stream[len] = (LOGFONTW){0};
+        stream[len].lfFaceName[0] = L'@';
+        wcsncpy(stream[len++].lfFaceName + 1, names[i], LF_FACESIZE - 2);
+      }
+    }
+    size_t unique_linear, unique_hashed;
+    double const linear = enumerate_font_names(enum_font_callback_linear, stream, len, &unique_linear);
+    double const hashed = enumerate_font_names(enum_font_callback, stream, len, &unique_hashed);
+    printf("  %6d names: linear %10.3f ms, hash set %8.3f ms (%d / %d unique)\n",
+           (int)len,
+           linear * 1e3,
+           hashed * 1e3,
+           (int)unique_linear,
+           (int)unique_hashed);
+    free(stream);
+    free(names);
+  }
+}
+
+static void extended_normalize_scalar(wchar_t *const str, size_t const len) {
+  for (size_t i = 0; i < len; ++i) {
+    wchar_t const ch = str[i];
+    str[i] = L'a' <= ch && ch <= L'z' ? (wchar_t)(ch - (L'a' - L'A')) : kana_fold(ch);
+  }
+}
+
+static double normalize_font_names(void (*normalize)(wchar_t *const, size_t const),
+                                   wchar_t *const buf,
+                                   wchar_t const *const *const names,
+                                   size_t const *const lens,
+                                   size_t const n,
+                                   size_t const rounds) {
+  double elapsed = 0;
+  for (size_t r = 0; r < rounds; ++r) {
+    wchar_t *p = buf;
+    for (size_t i = 0; i < n; ++i) {
+      memcpy(p, names[i], (lens[i] + 1) * sizeof(wchar_t));
+      p += lens[i] + 1;
+    }
+    double const t = now();
+    p = buf;
+    for (size_t i = 0; i < n; ++i) {
+      normalize(p, lens[i]);
+      p += lens[i] + 1;
+    }
+    elapsed += now() - t;
+  }
+  return elapsed;
+}
+
+static void bench_extended_normalize(void) {
+  enum {
+    n = 50000,
+    rounds = 20,
+    name_len = 32,
+  };
+  printf("extended_normalize (%d names x %d rounds)\n", (int)n, (int)rounds);
+  wchar_t **names = generate_font_names(n);
+  wchar_t *buf = realloc(NULL, n * name_len * sizeof(wchar_t));
+  size_t *lens = realloc(NULL, n * sizeof(size_t));
+  if (!names || !buf || !lens) {
+    printf("  failed to allocate names\n");
+    free(lens);
+    free(buf);
+    free(names);
+    return;
+  }
+  size_t units = 0;
+  for (size_t i = 0; i < n; ++i) {
+    lens[i] = wcslen(names[i]);
+    units += lens[i];
+  }
+  wchar_t const *const *const cnames = (wchar_t const *const *)names;
+  double const mb = (double)(units * rounds * sizeof(wchar_t)) / (1024. * 1024.);
+  double const scalar = normalize_font_names(extended_normalize_scalar, buf, cnames, lens, n, rounds);
+  double const table = normalize_font_names(extended_normalize, buf, cnames, lens, n, rounds);
+  printf("  scalar %8.3f ms (%7.1f MB/s), extended_normalize %8.3f ms (%7.1f MB/s)\n",
+         scalar * 1e3,
+         mb / scalar,
+         table * 1e3,
+         mb / table);
+  free(lens);
+  free(buf);
+  free(names);
+}
+
+static double normalize_kc_twice(wchar_t *const buf,
+                                 size_t const buflen,
+                                 wchar_t const *const *const names,
+                                 size_t const *const lens,
+                                 size_t const n,
+                                 size_t const rounds) {
+  double const start = now();
+  for (size_t r = 0; r < rounds; ++r) {
+    for (size_t i = 0; i < n; ++i) {
+      int const len = NormalizeString(NormalizationKC, names[i], (int)lens[i], NULL, 0);
+      if (len <= 0 || (size_t)len > buflen) {
+        continue;
+      }
+      NormalizeString(NormalizationKC, names[i], (int)lens[i], buf, len);
+    }
+  }
+  return now() - start;
+}
+
+static double normalize_kc_once(wchar_t *const buf,
+                                size_t const buflen,
+                                wchar_t const *const *const names,
+                                size_t const *const lens,
+                                size_t const n,
+                                size_t const rounds) {
+  double const start = now();
+  for (size_t r = 0; r < rounds; ++r) {
+    for (size_t i = 0; i < n; ++i) {
+      nfkc(names[i], lens[i], buf, buflen);
+    }
+  }
+  return now() - start;
+}
+
+static void bench_nfkc(void) {
+  enum {
+    n = 50000,
+    rounds = 20,
+    buflen = 256,
+  };
+  printf("nfkc (%d names x %d rounds)\n", (int)n, (int)rounds);
+  wchar_t **names = generate_font_names(n);
+  size_t *lens = realloc(NULL, n * sizeof(size_t));
+  if (!names || !lens) {
+    printf("  failed to allocate names\n");
+    free(lens);
+    free(names);
+    return;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    lens[i] = wcslen(names[i]);
+  }
+  wchar_t buf[buflen];
+  wchar_t const *const *const cnames = (wchar_t const *const *)names;
+  double const twice = normalize_kc_twice(buf, buflen, cnames, lens, n, rounds);
+  double const once = normalize_kc_once(buf, buflen, cnames, lens, n, rounds);
+  printf("  NormalizeString x2 %8.3f ms, nfkc %8.3f ms (%5.2fx)\n", twice * 1e3, once * 1e3, twice / once);
+  free(lens);
+  free(names);
+}
+
+int main(void) {
+  bench_font_list_index_of();
+  bench_font_list_prefix_range();
+  bench_font_list_family();
+  bench_font_list_sort();
+  bench_similar_scorer();
+  bench_similar_topk();
+  bench_similar_alphabet();
+  bench_similar_batch();
+  bench_similar_threads();
+  bench_similar_cached();
+  bench_similar_recent();
+  bench_similar_preferred();
+  bench_similar_qgram();
+  bench_font_cache();
+  bench_enum_font_callback();
+  bench_extended_normalize();
+  bench_nfkc();
+  return 0;
+}
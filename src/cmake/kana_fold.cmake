@@ -0,0 +1,59 @@
+# Generates kana_fold.h from kana_fold.txt.
+#
+# cmake -Dinput_file=kana_fold.txt -Dtemplate_file=kana_fold.h.in -Doutput_file=kana_fold.h -P kana_fold.cmake
+cmake_minimum_required(VERSION 3.20)
+
+set(_range1_first 12352) # U+3040
+set(_range1_last 12543)  # U+30FF
+set(_range2_first 12784) # U+31F0
+set(_range2_last 12799)  # U+31FF
+
+set(_table "")
+foreach(_cp RANGE ${_range1_first} ${_range1_last})
+  list(APPEND _table ${_cp})
+endforeach()
+foreach(_cp RANGE ${_range2_first} ${_range2_last})
+  list(APPEND _table ${_cp})
+endforeach()
+list(LENGTH _table _table_size)
+
+file(STRINGS "${input_file}" _lines ENCODING UTF-8)
+foreach(_line IN LISTS _lines)
+  string(REGEX REPLACE "#.*$" "" _line "${_line}")
+  string(STRIP "${_line}" _line)
+  if("${_line}" STREQUAL "")
+    continue()
+  endif()
+  string(REGEX REPLACE "[ \t]+" ";" _fields "${_line}")
+  list(POP_FRONT _fields _target)
+  math(EXPR _target "0x${_target}")
+  foreach(_source IN LISTS _fields)
+    math(EXPR _cp "0x${_source}")
+    if(_cp GREATER_EQUAL _range1_first AND _cp LESS_EQUAL _range1_last)
+      math(EXPR _index "${_cp} - ${_range1_first}")
+    elseif(_cp GREATER_EQUAL _range2_first AND _cp LESS_EQUAL _range2_last)
+      math(EXPR _index "${_cp} - ${_range2_first} + ${_range1_last} - ${_range1_first} + 1")
+    else()
+      message(FATAL_ERROR "U+${_source} is out of the kana_fold_table range: ${_line}")
+    endif()
+    list(REMOVE_AT _table ${_index})
+    list(INSERT _table ${_index} ${_target})
+  endforeach()
+endforeach()
+
+set(_body "")
+set(_column 0)
+foreach(_cp IN LISTS _table)
+  math(EXPR _hex "${_cp}" OUTPUT_FORMAT HEXADECIMAL)
+  if(_column EQUAL 0)
+    string(APPEND _body "   ")
+  endif()
+  string(APPEND _body " ${_hex},")
+  math(EXPR _column "(${_column} + 1) % 8")
+  if(_column EQUAL 0)
+    string(APPEND _body "\n")
+  endif()
+endforeach()
+set(_table "${_body}")
+
+configure_file(${template_file} ${output_file} @ONLY)
@@ -1,14 +1,46 @@
 #include "fontlist.h"
 
+#include <limits.h>
+#include <stddef.h>
 #include <stdlib.h>
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
 
+#ifdef __SSE2__
+#  include <emmintrin.h>
+#endif
+#if defined(__i386__) || defined(__x86_64__)
+#  define FONTLIST_X86
+#  include <immintrin.h>
+#endif
+
+#include "kana_fold.h"
+#include "nfkc.h"
 #include "ods.h"
+#include "thread.h"
 
 enum {
   buffer_size = 1024,
+  // See the front-coded font dictionary below.
+  font_dict_restart_interval = 16,
+  // Set in the suffix length of a normalized name that is not coded by the alphabet.
+  font_dict_wide = 0x8000,
+  // The code of a code unit that is not in the alphabet, it never appears in the font list.
+  font_alphabet_none = font_alphabet_size,
+  // NFKC expands a code unit to at most 18 code units (U+FDFA).
+  font_dict_norm_buffer_len = font_name_buffer_len * 18,
+  // See the batch scorer below.
+  font_batch_lanes = 16,
+  font_batch_max_query = 16,
+  // See the parallel scan below.
+  font_similar_chunk_min = 2048,
+  font_similar_max_threads = 8,
+};
+
+struct enum_font_seen {
+  uint32_t hash;
+  uint32_t idx; // index in list + 1, 0 means empty
 };
 
 struct enum_font_data {
@@ -18,267 +50,55 @@ struct enum_font_data {
     wchar_t const **wc;
     size_t *pos;
   } list;
+  // Open addressing set of the enumerated names, used to drop duplicates such as @ vertical variants.
+  struct enum_font_seen *seen;
+  size_t seen_mask;
+  // Collation sort keys of the names made by enum_font_data_normalize.
+  // The key of the i-th font is keys[keyend[i - 1]..keyend[i]], keyend[-1] is treated as 0.
+  uint8_t *keys;
+  size_t *keyend;
 };
 
-static void extended_normalize(wchar_t *str) {
-  for (wchar_t ch; *str; ++str) {
-    ch = *str;
-    if (L'a' <= ch && ch <= L'z') {
-      *str -= L'a' - L'A';
-      continue;
-    }
-    switch (ch) {
-    case L'ぁ':
-    case L'ァ':
-    case L'ア':
-      *str = L'あ';
-      break;
-    case L'ぃ':
-    case L'ゐ':
-    case L'ィ':
-    case L'イ':
-    case L'ヰ':
-    case L'ヸ':
-      *str = L'い';
-      break;
-    case L'ぅ':
-    case L'ゔ':
-    case L'ゥ':
-    case L'ウ':
-    case L'ヴ':
-      *str = L'う';
-      break;
-    case L'ぇ':
-    case L'ゑ':
-    case L'ェ':
-    case L'エ':
-    case L'ヱ':
-    case L'ヹ':
-      *str = L'え';
-      break;
-    case L'ぉ':
-    case L'を':
-    case L'ォ':
-    case L'オ':
-    case L'ヲ':
-    case L'ヺ':
-      *str = L'お';
-      break;
-    case L'が':
-    case L'ゕ':
-    case L'カ':
-    case L'ガ':
-    case L'ヵ':
-      *str = L'か';
-      break;
-    case L'ぎ':
-    case L'キ':
-    case L'ギ':
-      *str = L'き';
-      break;
-    case L'ぐ':
-    case L'ク':
-    case L'グ':
-    case L'ㇰ':
-      *str = L'く';
-      break;
-    case L'げ':
-    case L'ゖ':
-    case L'ケ':
-    case L'ゲ':
-    case L'ヶ':
-      *str = L'け';
-      break;
-    case L'ご':
-    case L'コ':
-    case L'ゴ':
-      *str = L'こ';
-      break;
-    case L'ざ':
-    case L'サ':
-    case L'ザ':
-      *str = L'さ';
-      break;
-    case L'じ':
-    case L'シ':
-    case L'ジ':
-    case L'ㇱ':
-      *str = L'し';
-      break;
-    case L'ず':
-    case L'ス':
-    case L'ズ':
-    case L'ㇲ':
-      *str = L'す';
-      break;
-    case L'ぜ':
-    case L'セ':
-    case L'ゼ':
-      *str = L'せ';
-      break;
-    case L'ぞ':
-    case L'ソ':
-    case L'ゾ':
-      *str = L'そ';
-      break;
-    case L'だ':
-    case L'タ':
-    case L'ダ':
-      *str = L'た';
-      break;
-    case L'ぢ':
-    case L'チ':
-    case L'ヂ':
-      *str = L'ち';
-      break;
-    case L'っ':
-    case L'づ':
-    case L'ッ':
-    case L'ツ':
-    case L'ヅ':
-      *str = L'つ';
-      break;
-    case L'で':
-    case L'テ':
-    case L'デ':
-      *str = L'て';
-      break;
-    case L'ど':
-    case L'ト':
-    case L'ド':
-    case L'ㇳ':
-      *str = L'と';
-      break;
-    case L'ナ':
-      *str = L'な';
-      break;
-    case L'ニ':
-      *str = L'に';
-      break;
-    case L'ヌ':
-    case L'ㇴ':
-      *str = L'ぬ';
-      break;
-    case L'ネ':
-      *str = L'ね';
-      break;
-    case L'ノ':
-      *str = L'の';
-      break;
-    case L'ば':
-    case L'ぱ':
-    case L'ハ':
-    case L'バ':
-    case L'パ':
-    case L'ㇵ':
-      *str = L'は';
-      break;
-    case L'び':
-    case L'ぴ':
-    case L'ヒ':
-    case L'ビ':
-    case L'ピ':
-    case L'ㇶ':
-      *str = L'ひ';
-      break;
-    case L'ぶ':
-    case L'ぷ':
-    case L'フ':
-    case L'ブ':
-    case L'プ':
-    case L'ㇷ':
-      *str = L'ふ';
-      break;
-    case L'べ':
-    case L'ぺ':
-    case L'ヘ':
-    case L'ベ':
-    case L'ペ':
-    case L'ㇸ':
-      *str = L'へ';
-      break;
-    case L'ぼ':
-    case L'ぽ':
-    case L'ホ':
-    case L'ボ':
-    case L'ポ':
-    case L'ㇹ':
-      *str = L'ほ';
-      break;
-    case L'マ':
-      *str = L'ま';
-      break;
-    case L'ミ':
-      *str = L'み';
-      break;
-    case L'ム':
-    case L'ㇺ':
-      *str = L'む';
-      break;
-    case L'メ':
-      *str = L'め';
-      break;
-    case L'モ':
-      *str = L'も';
-      break;
-    case L'ゃ':
-    case L'ャ':
-    case L'ヤ':
-      *str = L'や';
-      break;
-    case L'ゅ':
-    case L'ュ':
-    case L'ユ':
-      *str = L'ゆ';
-      break;
-    case L'ょ':
-    case L'ョ':
-    case L'ヨ':
-      *str = L'よ';
-      break;
-    case L'ラ':
-    case L'ㇻ':
-      *str = L'ら';
-      break;
-    case L'リ':
-    case L'ㇼ':
-      *str = L'り';
-      break;
-    case L'ル':
-    case L'ㇽ':
-      *str = L'る';
-      break;
-    case L'レ':
-    case L'ㇾ':
-      *str = L'れ';
-      break;
-    case L'ロ':
-    case L'ㇿ':
-      *str = L'ろ';
-      break;
-    case L'ゎ':
-    case L'ヮ':
-    case L'ワ':
-    case L'ヷ':
-      *str = L'わ';
-      break;
-    case L'ン':
-      *str = L'ん';
-      break;
-    }
+static inline wchar_t kana_fold(wchar_t const ch) {
+  uint32_t const c = (uint32_t)ch;
+  if (c - kana_fold_range1_first <= kana_fold_range1_last - kana_fold_range1_first) {
+    return (wchar_t)kana_fold_table[c - kana_fold_range1_first];
   }
-}
-
-static size_t normalize_kc(wchar_t const *const src, size_t const srclen, wchar_t *dest, size_t const destlen) {
-  int r = NormalizeString(NormalizationKC, src, (int)srclen, dest, (int)destlen);
-  if (r <= 0) {
-    return 0;
+  if (c - kana_fold_range2_first <= kana_fold_range2_last - kana_fold_range2_first) {
+    return (wchar_t)kana_fold_table[c - kana_fold_range2_first + kana_fold_range1_last - kana_fold_range1_first + 1];
   }
-  return (size_t)(r);
+  return ch;
 }
 
-static size_t normalize_kc_len(wchar_t const *const src, size_t const srclen) {
-  return normalize_kc(src, srclen, NULL, 0);
+// Upper-cases ASCII letters and folds kana variants into hiragana as listed in kana_fold.txt.
+static void extended_normalize(wchar_t *const str, size_t const len) {
+  size_t i = 0;
+#if defined(__SSE2__) && WCHAR_MAX == 0xffff
+  // Eight code units at a time. Only the blocks that contain U+3040-U+31FF go through kana_fold.
+  __m128i const lower_first = _mm_set1_epi16(L'a' - 1);
+  __m128i const lower_last = _mm_set1_epi16(L'z' + 1);
+  __m128i const case_bit = _mm_set1_epi16(L'a' - L'A');
+  __m128i const kana_first = _mm_set1_epi16(kana_fold_range1_first);
+  __m128i const sign = _mm_set1_epi16(INT16_MIN);
+  __m128i const kana_limit = _mm_set1_epi16(INT16_MIN + kana_fold_range2_last - kana_fold_range1_first + 1);
+  for (; i + 8 <= len; i += 8) {
+    __m128i v = _mm_loadu_si128((__m128i const *)(void const *)(str + i));
+    __m128i const lower = _mm_and_si128(_mm_cmpgt_epi16(v, lower_first), _mm_cmplt_epi16(v, lower_last));
+    v = _mm_sub_epi16(v, _mm_and_si128(lower, case_bit));
+    _mm_storeu_si128((__m128i *)(void *)(str + i), v);
+    // Unsigned v - kana_first < span, compared as signed by flipping the sign bit.
+    __m128i const kana = _mm_cmplt_epi16(_mm_xor_si128(_mm_sub_epi16(v, kana_first), sign), kana_limit);
+    // One bit per byte, so the even bits tell which code units are in the range.
+    for (unsigned m = (unsigned)_mm_movemask_epi8(kana) & 0x5555u; m; m &= m - 1) {
+      size_t const j = i + (size_t)(__builtin_ctz(m) / 2);
+      str[j] = kana_fold(str[j]);
+    }
+  }
+#endif
+  for (; i < len; ++i) {
+    wchar_t const ch = str[i];
+    str[i] = L'a' <= ch && ch <= L'z' ? (wchar_t)(ch - (L'a' - L'A')) : kana_fold(ch);
+  }
 }
 
 static bool my_realloc(void *p, size_t newsize) {
@@ -290,6 +110,58 @@ static bool my_realloc(void *p, size_t newsize) {
   return true;
 }
 
+static uint32_t hash_string(wchar_t const *s) {
+  // FNV-1a
+  uint32_t h = 2166136261u;
+  for (; *s; ++s) {
+    h ^= (uint32_t)(*s);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static bool enum_font_data_grow_seen(struct enum_font_data *const fd) {
+  size_t const size = fd->seen ? (fd->seen_mask + 1) * 2 : buffer_size;
+  struct enum_font_seen *seen = NULL;
+  if (!my_realloc(&seen, size * sizeof(struct enum_font_seen))) {
+    ods(L"failed to allocate font name set");
+    return false;
+  }
+  memset(seen, 0, size * sizeof(struct enum_font_seen));
+  size_t const mask = size - 1;
+  if (fd->seen) {
+    for (size_t i = 0; i <= fd->seen_mask; ++i) {
+      if (!fd->seen[i].idx) {
+        continue;
+      }
+      size_t slot = fd->seen[i].hash & mask;
+      while (seen[slot].idx) {
+        slot = (slot + 1) & mask;
+      }
+      seen[slot] = fd->seen[i];
+    }
+    free(fd->seen);
+  }
+  fd->seen = seen;
+  fd->seen_mask = mask;
+  return true;
+}
+
+static bool enum_font_data_grow(void *p, size_t *const len, size_t const required, size_t const elem_size) {
+  if (required <= *len) {
+    return true;
+  }
+  size_t newlen = *len ? *len : buffer_size;
+  while (newlen < required) {
+    newlen *= 2;
+  }
+  if (!my_realloc(p, newlen * elem_size)) {
+    return false;
+  }
+  *len = newlen;
+  return true;
+}
+
 static int CALLBACK enum_font_callback(const LOGFONTW *lf, const TEXTMETRICW *tm, DWORD fontType, LPARAM lParam) {
   (void)tm;
   if (fontType == RASTER_FONTTYPE) {
@@ -298,307 +170,3512 @@ static int CALLBACK enum_font_callback(const LOGFONTW *lf, const TEXTMETRICW *tm
   }
   struct enum_font_data *fd = (struct enum_font_data *)lParam;
   wchar_t const *facename = lf->lfFaceName[0] == L'@' ? lf->lfFaceName + 1 : lf->lfFaceName;
-  if (fd->n > 0) {
-    for (size_t i = 0; i < fd->n; ++i) {
-      if (wcscmp(fd->buf + fd->list.pos[i], facename) == 0) {
-        // already enumerated
-        return TRUE;
-      }
+  if (!fd->seen || (fd->n + 1) * 2 > fd->seen_mask + 1) {
+    if (!enum_font_data_grow_seen(fd)) {
+      return FALSE;
+    }
+  }
+  uint32_t const hash = hash_string(facename);
+  size_t slot = hash & fd->seen_mask;
+  for (; fd->seen[slot].idx; slot = (slot + 1) & fd->seen_mask) {
+    if (fd->seen[slot].hash == hash && wcscmp(fd->buf + fd->list.pos[fd->seen[slot].idx - 1], facename) == 0) {
+      // already enumerated
+      return TRUE;
     }
   }
 
   size_t const namelen = wcslen(facename);
-  size_t normlen = normalize_kc_len(facename, namelen);
-  if (normlen == 0) {
-    odshr(HRESULT_FROM_WIN32(GetLastError()), L"failed to get normalized font name length: %s", facename);
-    return TRUE;
-  }
-  if (fd->pos + namelen + 1 + normlen + 1 > fd->len) {
-    fd->len += buffer_size;
-    if (!my_realloc(&fd->buf, (size_t)(fd->len) * sizeof(wchar_t))) {
-      ods(L"failed to expand font list buffer");
-      return FALSE;
-    }
+  if (!enum_font_data_grow(&fd->buf, &fd->len, fd->pos + namelen + 1, sizeof(wchar_t))) {
+    ods(L"failed to expand font list buffer");
+    return FALSE;
   }
   memcpy(fd->buf + fd->pos, facename, namelen * sizeof(wchar_t));
   fd->buf[fd->pos + namelen] = L'\0';
-  normlen = normalize_kc(facename, namelen, fd->buf + fd->pos + namelen + 1, normlen + 1);
-  if (normlen == 0) {
-    odshr(HRESULT_FROM_WIN32(GetLastError()), L"failed to get normalized font name: %s", facename);
-    return TRUE;
-  }
-  fd->buf[fd->pos + namelen + 1 + normlen] = L'\0';
-  extended_normalize(fd->buf + fd->pos + namelen + 1);
 
-  if (fd->n == fd->listlen) {
-    fd->listlen += buffer_size;
-    if (!my_realloc(&fd->list, (size_t)(fd->listlen) * sizeof(wchar_t *))) {
-      ods(L"failed to expand normalized font list buffer");
-      return FALSE;
-    }
+  if (!enum_font_data_grow(&fd->list, &fd->listlen, fd->n + 1, sizeof(wchar_t *))) {
+    ods(L"failed to expand normalized font list buffer");
+    return FALSE;
   }
   // Since the address may change depending on realloc,
   // at this point we record only the position.
   fd->list.pos[fd->n] = fd->pos;
+  fd->seen[slot] = (struct enum_font_seen){.hash = hash, .idx = (uint32_t)(fd->n + 1)};
 
-  fd->pos += namelen + 1 + normlen + 1;
+  fd->pos += namelen + 1;
   fd->textlen += namelen + 1;
-  fd->text2len += normlen + 1;
   ++fd->n;
   return TRUE;
 }
 
-static int compare_string(void const *n1, void const *n2) {
+enum {
   // In exedit, CBS_SORT is used to sort the font list.
-  // It seems that CompareString can be used to achieve similar behavior.
-  int const r = CompareStringW(LOCALE_USER_DEFAULT,
-                               SORT_STRINGSORT | LINGUISTIC_IGNORECASE,
-                               *(wchar_t const *const *)n1,
-                               -1,
-                               *(wchar_t const *const *)n2,
-                               -1);
-  return r - 2;
-}
+  // It seems that CompareString with these flags can be used to achieve similar behavior,
+  // and the sort keys made by LCMapString with the same flags give the same order by memcmp.
+  font_list_collation_flags = SORT_STRINGSORT | LINGUISTIC_IGNORECASE,
+  // Splitting the normalization is not worth a thread below this number of fonts per worker.
+  font_build_chunk_min = 512,
+  font_build_max_workers = 16,
+};
 
-bool font_list_create(struct font_list *fl) {
-  bool ret = false;
-  HWND const window = GetDesktopWindow();
-  HDC dc = NULL;
-  struct enum_font_data fd = {0};
-  wchar_t **r = NULL;
+// A range of the enumerated fonts that is normalized and keyed by one worker into its own buffers.
+struct font_build_chunk {
+  struct enum_font_data const *fd;
+  size_t first, last;
+  wchar_t *buf;
+  size_t len, pos, text2len;
+  uint8_t *keys;
+  size_t keyslen, keyspos;
+  // Indexed by the font index, namepos is SIZE_MAX for the fonts whose name can not be normalized.
+  size_t *namepos;
+  size_t *keyend;
+  bool ok;
+};
 
-  dc = GetDC(window);
-  if (!dc) {
-    ods(L"GetDC failed");
-    goto cleanup;
+static bool font_build_chunk_sort_key(struct font_build_chunk *const c,
+                                      wchar_t const *const name,
+                                      size_t const namelen) {
+  // Sort keys take a few bytes per character, so try with a generous guess first
+  // and ask for the exact size only when it does not fit.
+  if (!enum_font_data_grow(&c->keys, &c->keyslen, c->keyspos + namelen * 8 + 64, sizeof(uint8_t))) {
+    ods(L"failed to expand sort key buffer");
+    return false;
+  }
+  int r = LCMapStringW(LOCALE_USER_DEFAULT,
+                       LCMAP_SORTKEY | font_list_collation_flags,
+                       name,
+                       (int)namelen,
+                       (LPWSTR)(void *)(c->keys + c->keyspos),
+                       (int)(c->keyslen - c->keyspos));
+  if (r == 0) {
+    if (GetLastError() != ERROR_INSUFFICIENT_BUFFER) {
+      odshr(HRESULT_FROM_WIN32(GetLastError()), L"LCMapStringW failed: %s", name);
+      return false;
+    }
+    r = LCMapStringW(LOCALE_USER_DEFAULT, LCMAP_SORTKEY | font_list_collation_flags, name, (int)namelen, NULL, 0);
+    if (r == 0 || !enum_font_data_grow(&c->keys, &c->keyslen, c->keyspos + (size_t)r, sizeof(uint8_t))) {
+      odshr(HRESULT_FROM_WIN32(GetLastError()), L"failed to expand sort key buffer: %s", name);
+      return false;
+    }
+    r = LCMapStringW(LOCALE_USER_DEFAULT,
+                     LCMAP_SORTKEY | font_list_collation_flags,
+                     name,
+                     (int)namelen,
+                     (LPWSTR)(void *)(c->keys + c->keyspos),
+                     r);
+    if (r == 0) {
+      odshr(HRESULT_FROM_WIN32(GetLastError()), L"LCMapStringW failed: %s", name);
+      return false;
+    }
   }
+  c->keyspos += (size_t)r;
+  return true;
+}
 
-  // We should use EnumFontFamiliesExW but some fonts are not enumerate when
-  // using it. exedit.auf uses EnumFontFamilies, so follow it. LOGFONTW lf = { 0
-  // }; lf.lfCharSet = DEFAULT_CHARSET; EnumFontFamiliesExW(dc, &lf,
-  // enum_font_callback, (LPARAM)&fd, 0);
-  if (!EnumFontFamiliesW(dc, NULL, enum_font_callback, (LPARAM)&fd)) {
-    ods(L"EnumFontFamiliesW failed");
-    goto cleanup;
+// Writes each name of the range followed by its normalized copy to the buffer of the chunk,
+// and the sort key of the name to the key buffer.
+static void font_build_chunk_run(struct font_build_chunk *const c) {
+  struct enum_font_data const *const fd = c->fd;
+  for (size_t i = c->first; i < c->last; ++i) {
+    wchar_t const *const name = fd->buf + fd->list.pos[i];
+    size_t const namelen = wcslen(name);
+    c->namepos[i] = SIZE_MAX;
+    c->keyend[i] = c->keyspos;
+    if (namelen >= font_name_buffer_len) {
+      ods(L"font name is too long: %s", name);
+      continue;
+    }
+    // Most names keep their length, so normalize into the space left after reserving twice the name
+    // and retry only when the normalized name turns out to be longer.
+    size_t const normpos = c->pos + namelen + 1;
+    if (!enum_font_data_grow(&c->buf, &c->len, normpos + namelen + 1, sizeof(wchar_t))) {
+      ods(L"failed to expand font list buffer");
+      return;
+    }
+    memcpy(c->buf + c->pos, name, (namelen + 1) * sizeof(wchar_t));
+    size_t normlen = nfkc(name, namelen, c->buf + normpos, c->len - normpos - 1);
+    if (normlen > c->len - normpos - 1) {
+      if (!enum_font_data_grow(&c->buf, &c->len, normpos + normlen + 1, sizeof(wchar_t))) {
+        ods(L"failed to expand font list buffer");
+        return;
+      }
+      normlen = nfkc(name, namelen, c->buf + normpos, normlen);
+    }
+    if (normlen == 0 || normlen >= font_dict_norm_buffer_len) {
+      ods(L"failed to normalize font name: %s", name);
+      continue;
+    }
+    c->buf[normpos + normlen] = L'\0';
+    extended_normalize(c->buf + normpos, normlen);
+    if (!font_build_chunk_sort_key(c, name, namelen)) {
+      return;
+    }
+    c->namepos[i] = c->pos;
+    c->keyend[i] = c->keyspos;
+    c->pos = normpos + normlen + 1;
+    c->text2len += normlen + 1;
   }
+  c->ok = true;
+}
 
-  // Create sorted font list.
+static DWORD WINAPI font_build_chunk_thread(LPVOID param) {
+  font_build_chunk_run(param);
+  return 0;
+}
 
-  // Replace with the actual address to use qsort.
-  for (size_t i = 0; i < fd.n; ++i) {
-    fd.list.wc[i] = fd.buf + fd.list.pos[i];
+static size_t font_build_worker_count(size_t const n) {
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  size_t workers = si.dwNumberOfProcessors ? (size_t)si.dwNumberOfProcessors : 1;
+  if (workers > n / font_build_chunk_min) {
+    workers = n / font_build_chunk_min ? n / font_build_chunk_min : 1;
   }
-  qsort(fd.list.wc, (size_t)fd.n, sizeof(wchar_t *), compare_string);
+  return workers < font_build_max_workers ? workers : font_build_max_workers;
+}
 
-  r = realloc(NULL, (size_t)(fd.n) * sizeof(wchar_t *) + (size_t)(fd.pos) * sizeof(wchar_t));
-  if (!r) {
-    ods(L"failed to allocate sorted font list buffer");
+// Rebuilds the buffer so that each enumerated name is followed by its normalized copy,
+// and makes the sort key of each name.
+// The fonts whose name can not be normalized are removed from the list.
+// The names are split into chunks that are processed in parallel and concatenated in the original order.
+static bool enum_font_data_normalize(struct enum_font_data *const fd) {
+  bool ret = false;
+  struct font_build_chunk chunks[font_build_max_workers] = {0};
+  HANDLE threads[font_build_max_workers] = {0};
+  size_t *namepos = NULL;
+  size_t *keyend = NULL;
+  size_t const nchunks = font_build_worker_count(fd->n);
+
+  if (!fd->n) {
+    ret = true;
     goto cleanup;
   }
-
-  wchar_t *str = (void *)(r + fd.n);
-  size_t ln, ln2;
-  for (size_t i = 0; i < fd.n; ++i) {
-    r[i] = str;
-    ln = wcslen(fd.list.wc[i]) + 1;
-    ln2 = wcslen(fd.list.wc[i] + ln) + 1;
-    memcpy(str, fd.list.wc[i], (ln + ln2) * sizeof(wchar_t));
-    str += (ln + ln2);
+  namepos = realloc(NULL, fd->n * sizeof(size_t));
+  keyend = realloc(NULL, fd->n * sizeof(size_t));
+  if (!namepos || !keyend) {
+    ods(L"failed to allocate font list position buffer");
+    goto cleanup;
+  }
+  for (size_t i = 0; i < nchunks; ++i) {
+    chunks[i] = (struct font_build_chunk){
+        .fd = fd,
+        .first = fd->n * i / nchunks,
+        .last = fd->n * (i + 1) / nchunks,
+        .namepos = namepos,
+        .keyend = keyend,
+    };
+  }
+  for (size_t i = 1; i < nchunks; ++i) {
+    threads[i] = CreateThread(NULL, 0, font_build_chunk_thread, &chunks[i], 0, NULL);
+    if (!threads[i]) {
+      odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateThread failed");
+      font_build_chunk_run(&chunks[i]);
+    }
+  }
+  font_build_chunk_run(&chunks[0]);
+  for (size_t i = 1; i < nchunks; ++i) {
+    if (threads[i]) {
+      WaitForSingleObject(threads[i], INFINITE);
+      CloseHandle(threads[i]);
+      threads[i] = NULL;
+    }
   }
 
-  fl->sorted = r;
-  fl->num = fd.n;
+  // Append the other chunks to the buffers of the first chunk.
+  size_t pos = 0, keyspos = 0;
+  for (size_t i = 0; i < nchunks; ++i) {
+    if (!chunks[i].ok) {
+      goto cleanup;
+    }
+    pos += chunks[i].pos;
+    keyspos += chunks[i].keyspos;
+  }
+  struct font_build_chunk *const c0 = &chunks[0];
+  if (!enum_font_data_grow(&c0->buf, &c0->len, pos, sizeof(wchar_t)) ||
+      !enum_font_data_grow(&c0->keys, &c0->keyslen, keyspos, sizeof(uint8_t))) {
+    ods(L"failed to expand font list buffer");
+    goto cleanup;
+  }
+  size_t n = 0;
+  pos = 0;
+  keyspos = 0;
+  fd->text2len = 0;
+  for (size_t i = 0; i < nchunks; ++i) {
+    struct font_build_chunk const *const c = &chunks[i];
+    if (i) {
+      memcpy(c0->buf + pos, c->buf, c->pos * sizeof(wchar_t));
+      memcpy(c0->keys + keyspos, c->keys, c->keyspos);
+    }
+    for (size_t j = c->first; j < c->last; ++j) {
+      if (namepos[j] == SIZE_MAX) {
+        continue;
+      }
+      fd->list.pos[n] = pos + namepos[j];
+      keyend[n] = keyspos + keyend[j];
+      ++n;
+    }
+    pos += c->pos;
+    keyspos += c->keyspos;
+    fd->text2len += c->text2len;
+  }
+  free(fd->buf);
+  fd->buf = c0->buf;
+  fd->len = c0->len;
+  fd->pos = pos;
+  fd->n = n;
+  c0->buf = NULL;
+  if (fd->keys) {
+    free(fd->keys);
+  }
+  fd->keys = c0->keys;
+  c0->keys = NULL;
+  if (fd->keyend) {
+    free(fd->keyend);
+  }
+  fd->keyend = keyend;
+  keyend = NULL;
   ret = true;
 
 cleanup:
-  if (!ret) {
-    fl->sorted = NULL;
-    fl->num = 0;
-    free(r);
-    r = NULL;
-  }
-  if (fd.list.wc) {
-    free(fd.list.wc);
-    fd.list.wc = NULL;
+  for (size_t i = 0; i < nchunks; ++i) {
+    if (chunks[i].buf) {
+      free(chunks[i].buf);
+    }
+    if (chunks[i].keys) {
+      free(chunks[i].keys);
+    }
   }
-  if (fd.buf) {
-    free(fd.buf);
-    fd.buf = NULL;
+  if (keyend) {
+    free(keyend);
   }
-  if (dc) {
-    ReleaseDC(window, dc);
-    dc = NULL;
+  if (namepos) {
+    free(namepos);
   }
   return ret;
 }
 
-void font_list_destroy(struct font_list *fl) {
-  if (!fl) {
-    return;
+struct font_sort_entry {
+  uint64_t prefix; // the first 8 bytes of the sort key in big-endian order
+  uint8_t const *key;
+  size_t keylen;
+  wchar_t const *name; // followed by the normalized name
+  size_t idx;          // enumeration order, breaks ties between the names that collate equal
+};
+
+static int compare_sort_entry(void const *n1, void const *n2) {
+  struct font_sort_entry const *const a = n1;
+  struct font_sort_entry const *const b = n2;
+  if (a->prefix != b->prefix) {
+    return a->prefix < b->prefix ? -1 : 1;
   }
-  if (fl->sorted) {
-    free(fl->sorted);
-    fl->sorted = NULL;
+  int const r = memcmp(a->key, b->key, a->keylen < b->keylen ? a->keylen : b->keylen);
+  if (r) {
+    return r;
   }
-  fl->num = 0;
+  if (a->keylen != b->keylen) {
+    return a->keylen < b->keylen ? -1 : 1;
+  }
+  return a->idx < b->idx ? -1 : a->idx > b->idx ? 1 : 0;
 }
 
-int font_list_index_of(struct font_list const *const fl, wchar_t const *const s) {
-  if (!fl || !s || !fl->sorted) {
-    ods(L"invalid parameter");
-    return -1;
-  }
-  for (size_t i = 0; i < fl->num; ++i) {
-    if (wcscmp(s, fl->sorted[i]) == 0) {
-      return (int)i;
-    }
+// Each code unit sets one of 64 bits, so the characters of a string whose bits are
+// not in the signature of another string can not be a part of their LCS.
+static uint64_t signature_string(wchar_t const *s, size_t const len) {
+  uint64_t sig = 0;
+  for (size_t i = 0; i < len; ++i) {
+    sig |= UINT64_C(1) << (((uint32_t)s[i] * 2654435761u) >> 26);
   }
-  return -1;
+  return sig;
 }
 
-// Based on https://github.com/convto/onp
-// implementation "An O(NP) Sequence Comparison Algorithm"
-// Copyright (c) 2019 YuyaOkumura
+// Folded-code alphabet.
+//
+// Normalized names use a small set of code units, upper-case ASCII, digits, hiragana and some CJK,
+// so the font_alphabet_size most frequent ones are given 8-bit codes in the ascending order of
+// the code units. A normalized name whose code units are all in the alphabet is stored and scored
+// as bytes, the others are kept as they are.
 
-struct diff {
-  wchar_t const *a;
-  wchar_t const *b;
-  int m, n;
-  int fpbuflen;
-  int *fpbuf;
+struct font_alphabet_count {
+  uint32_t ch;
+  uint32_t count; // 0 means empty
 };
 
-static void diff_init(struct diff *const d, wchar_t const *const a, wchar_t const *const b) {
-  int m = (int)(wcslen(a));
-  int n = (int)(wcslen(b));
-  if (m > n) {
-    d->a = b;
-    d->b = a;
-    d->m = n;
-    d->n = m;
-    return;
+static int compare_alphabet_count(void const *const n1, void const *const n2) {
+  struct font_alphabet_count const *const a = n1;
+  struct font_alphabet_count const *const b = n2;
+  if (a->count != b->count) {
+    return a->count > b->count ? -1 : 1;
   }
-  d->a = a;
-  d->b = b;
-  d->m = m;
-  d->n = n;
+  return a->ch < b->ch ? -1 : a->ch > b->ch ? 1 : 0;
 }
 
-static int diff_snake(struct diff const *const d, int const k, int y) {
-  int x = y - k;
-  while (x < d->m && y < d->n && d->a[x] == d->b[y]) {
-    ++x;
-    ++y;
-  }
-  return y;
+static int compare_wchar(void const *const n1, void const *const n2) {
+  wchar_t const x = *(wchar_t const *)n1;
+  wchar_t const y = *(wchar_t const *)n2;
+  return x == y ? 0 : x > y ? 1 : -1;
 }
 
-static inline int diff_max(int const x, int const y) { return x > y ? x : y; }
-
-static int diff_distance(struct diff *const d) {
-  int offset = d->m + 1;
-  int delta = d->n - d->m;
-  int fplen = d->m + d->n + 3;
-  if (d->fpbuflen < fplen) {
-    d->fpbuflen = fplen;
-    if (!my_realloc(&d->fpbuf, (size_t)(d->fpbuflen) * sizeof(int))) {
-      return -1;
+static bool font_alphabet_count_grow(struct font_alphabet_count **const counts, size_t *const mask) {
+  size_t const size = *counts ? (*mask + 1) * 2 : buffer_size;
+  struct font_alphabet_count *c = NULL;
+  if (!my_realloc(&c, size * sizeof(struct font_alphabet_count))) {
+    return false;
+  }
+  memset(c, 0, size * sizeof(struct font_alphabet_count));
+  if (*counts) {
+    for (size_t i = 0; i <= *mask; ++i) {
+      if (!(*counts)[i].count) {
+        continue;
+      }
+      size_t slot = ((*counts)[i].ch * 2654435761u) & (size - 1);
+      while (c[slot].count) {
+        slot = (slot + 1) & (size - 1);
+      }
+      c[slot] = (*counts)[i];
     }
+    free(*counts);
   }
-  int *fp = d->fpbuf;
-  for (int i = 0; i < fplen; ++i) {
-    fp[i] = -1;
+  *counts = c;
+  *mask = size - 1;
+  return true;
+}
+
+static bool font_alphabet_build(wchar_t *const alphabet,
+                                size_t *const alphabet_len,
+                                struct font_sort_entry const *const entries,
+                                size_t const num) {
+  bool ret = false;
+  struct font_alphabet_count *counts = NULL;
+  size_t mask = 0, used = 0;
+  if (!font_alphabet_count_grow(&counts, &mask)) {
+    goto cleanup;
   }
-  for (int p = 0;; ++p) {
-    // -p <= k <= delta - 1
-    for (int k = -p; k <= delta - 1; ++k) {
-      fp[k + offset] = diff_snake(d, k, diff_max(fp[k - 1 + offset] + 1, fp[k + 1 + offset]));
-    }
-    // d.delta + 1 <= k <= d.delta + p
-    for (int k = delta + p; k >= delta + 1; --k) {
-      fp[k + offset] = diff_snake(d, k, diff_max(fp[k - 1 + offset] + 1, fp[k + 1 + offset]));
+  for (size_t i = 0; i < num; ++i) {
+    for (wchar_t const *p = entries[i].name + wcslen(entries[i].name) + 1; *p; ++p) {
+      uint32_t const ch = (uint32_t)*p;
+      size_t slot = (ch * 2654435761u) & mask;
+      while (counts[slot].count && counts[slot].ch != ch) {
+        slot = (slot + 1) & mask;
+      }
+      if (counts[slot].count) {
+        ++counts[slot].count;
+        continue;
+      }
+      counts[slot] = (struct font_alphabet_count){.ch = ch, .count = 1};
+      if (++used * 2 > mask && !font_alphabet_count_grow(&counts, &mask)) {
+        goto cleanup;
+      }
     }
-    // d.delta == k
-    fp[delta + offset] = diff_snake(d, delta, diff_max(fp[delta - 1 + offset] + 1, fp[delta + 1 + offset]));
-    if (fp[delta + offset] == d->n) {
-      return delta + 8 * p;
+  }
+  size_t n = 0;
+  for (size_t i = 0; i <= mask; ++i) {
+    if (counts[i].count) {
+      counts[n++] = counts[i];
     }
   }
-}
+  qsort(counts, n, sizeof(struct font_alphabet_count), compare_alphabet_count);
+  if (n > font_alphabet_size) {
+    n = font_alphabet_size;
+  }
+  for (size_t i = 0; i < n; ++i) {
+    alphabet[i] = (wchar_t)counts[i].ch;
+  }
+  qsort(alphabet, n, sizeof(wchar_t), compare_wchar);
+  *alphabet_len = n;
+  ret = true;
 
-static int compare_distance(void const *const n1, void const *const n2) {
-  int const x = ((struct font_similar const *)n1)->score;
-  int const y = ((struct font_similar const *)n2)->score;
-  return x == y ? 0 : x > y ? 1 : -1;
+cleanup:
+  if (counts) {
+    free(counts);
+  }
+  return ret;
 }
 
-struct font_similar *font_get_similar(struct font_list const *const fl, wchar_t const *const s) {
-  if (!fl || !s || !fl->num || !fl->sorted) {
-    ods(L"invalid parameter");
-    return NULL;
+// Returns font_alphabet_none if ch is not in the alphabet.
+static uint8_t font_alphabet_code(wchar_t const *const alphabet, size_t const alphabet_len, wchar_t const ch) {
+  size_t lo = 0, hi = alphabet_len;
+  while (lo < hi) {
+    size_t const mid = lo + (hi - lo) / 2;
+    if (alphabet[mid] < ch) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
   }
-  struct diff diff = {0};
-  struct font_similar *sim = NULL;
+  return lo < alphabet_len && alphabet[lo] == ch ? (uint8_t)lo : (uint8_t)font_alphabet_none;
+}
 
-  // make normalized input
-  const size_t slen = wcslen(s);
-  size_t snormlen = normalize_kc_len(s, slen);
-  if (snormlen == 0) {
-    odshr(HRESULT_FROM_WIN32(GetLastError()), L"NormalizeString failed");
-    return NULL;
+// Returns false if s has a code unit that is not in the alphabet.
+static bool font_alphabet_encode(wchar_t const *const alphabet,
+                                 size_t const alphabet_len,
+                                 wchar_t const *const s,
+                                 size_t const len,
+                                 uint8_t *const code) {
+  bool narrow = true;
+  for (size_t i = 0; i < len; ++i) {
+    code[i] = font_alphabet_code(alphabet, alphabet_len, s[i]);
+    narrow = narrow && code[i] != font_alphabet_none;
   }
+  return narrow;
+}
 
-  wchar_t *sn = realloc(NULL, (size_t)(snormlen + 1) * sizeof(wchar_t));
-  if (!sn) {
-    ods(L"failed to allocate memory");
-    goto failed;
-  }
-  snormlen = normalize_kc(s, slen, sn, snormlen);
-  if (snormlen == 0) {
-    odshr(HRESULT_FROM_WIN32(GetLastError()), L"NormalizeString failed");
+// Front-coded font dictionary.
+//
+// Each entry in text is the display name followed by the normalized name, both coded as
+//   prefix length, suffix length, suffix
+// where the prefix is shared with the same name of the previous entry.
+// The suffix of a normalized name is its alphabet codes packed two per code unit, low byte first.
+// If the name is not coded by the alphabet, font_dict_wide is set in the suffix length and
+// the suffix is the code units, and the prefix is shared only between the names of the same kind.
+// Every font_dict_restart_interval-th entry has no shared prefix so that decoding can start there.
+
+struct font_dict_cursor {
+  size_t next; // index of the entry at pos
+  size_t pos;
+  size_t namelen;
+  size_t normlen;
+  bool narrow; // the normalized name is in code, otherwise in norm
+  wchar_t name[font_name_buffer_len];
+  // Unpacking writes one byte past an odd length.
+  uint8_t code[font_dict_norm_buffer_len + 1];
+  wchar_t norm[font_dict_norm_buffer_len];
+};
+
+static inline size_t font_dict_num_restarts(size_t const num) {
+  return (num + font_dict_restart_interval - 1) / font_dict_restart_interval;
+}
+
+static size_t font_dict_put(wchar_t *const text,
+                            size_t pos,
+                            wchar_t const *const prev,
+                            size_t const prevlen,
+                            wchar_t const *const s,
+                            size_t const len,
+                            size_t const flags) {
+  size_t prefix = 0;
+  while (prefix < prevlen && prefix < len && prev[prefix] == s[prefix]) {
+    ++prefix;
+  }
+  text[pos++] = (wchar_t)prefix;
+  text[pos++] = (wchar_t)((len - prefix) | flags);
+  memcpy(text + pos, s + prefix, (len - prefix) * sizeof(wchar_t));
+  return pos + len - prefix;
+}
+
+static size_t font_dict_put_code(wchar_t *const text,
+                                 size_t pos,
+                                 uint8_t const *const prev,
+                                 size_t const prevlen,
+                                 uint8_t const *const code,
+                                 size_t const len) {
+  size_t prefix = 0;
+  while (prefix < prevlen && prefix < len && prev[prefix] == code[prefix]) {
+    ++prefix;
+  }
+  text[pos++] = (wchar_t)prefix;
+  text[pos++] = (wchar_t)(len - prefix);
+  for (size_t i = prefix; i < len; i += 2) {
+    uint32_t const u = (uint32_t)code[i] | (i + 1 < len ? (uint32_t)code[i + 1] << 8 : 0);
+    text[pos++] = (wchar_t)u;
+  }
+  return pos;
+}
+
+static inline void font_dict_cursor_next(struct font_dict_cursor *const c, wchar_t const *const text) {
+  wchar_t const *p = text + c->pos;
+  size_t prefix = (size_t)p[0], suffix = (size_t)p[1];
+  memcpy(c->name + prefix, p + 2, suffix * sizeof(wchar_t));
+  c->namelen = prefix + suffix;
+  c->name[c->namelen] = L'\0';
+  p += 2 + suffix;
+  prefix = (size_t)p[0];
+  suffix = (size_t)p[1];
+  c->normlen = prefix + (suffix & ~(size_t)font_dict_wide);
+  c->narrow = !(suffix & font_dict_wide);
+  if (c->narrow) {
+    uint8_t *const code = c->code + prefix;
+    p += 2;
+    for (size_t i = 0; i < suffix; i += 2) {
+      uint32_t const u = (uint32_t)*p++;
+      code[i] = (uint8_t)u;
+      code[i + 1] = (uint8_t)(u >> 8);
+    }
+  } else {
+    suffix &= ~(size_t)font_dict_wide;
+    memcpy(c->norm + prefix, p + 2, suffix * sizeof(wchar_t));
+    c->norm[c->normlen] = L'\0';
+    p += 2 + suffix;
+  }
+  c->pos = (size_t)(p - text);
+  ++c->next;
+}
+
+// Decodes the idx-th entry. Moving forward within a block continues from the current entry,
+// otherwise decoding starts from the restart point of the block.
+static void font_dict_cursor_seek(struct font_dict_cursor *const c,
+                                  struct font_list const *const fl,
+                                  size_t const idx) {
+  if (c->next == 0 || idx + 1 < c->next ||
+      idx / font_dict_restart_interval != (c->next - 1) / font_dict_restart_interval) {
+    c->next = idx - idx % font_dict_restart_interval;
+    c->pos = fl->restarts[idx / font_dict_restart_interval];
+  }
+  while (c->next <= idx) {
+    font_dict_cursor_next(c, fl->text);
+  }
+}
+
+// Returns the normalized name of the current entry as code units.
+// Decoding a coded name overwrites norm, which is fine because the next wide name has no shared prefix.
+static wchar_t const *font_dict_cursor_norm(struct font_dict_cursor *const c, struct font_list const *const fl) {
+  if (c->narrow) {
+    for (size_t i = 0; i < c->normlen; ++i) {
+      c->norm[i] = fl->alphabet[c->code[i]];
+    }
+    c->norm[c->normlen] = L'\0';
+  }
+  return c->norm;
+}
+
+// len holds the length of the same name in the previous entry and receives the decoded length.
+static bool font_dict_validate_name(wchar_t const *const text,
+                                    size_t const textlen,
+                                    size_t *const pos,
+                                    bool const restart,
+                                    size_t *const len,
+                                    size_t const buflen) {
+  if (textlen - *pos < 2) {
+    return false;
+  }
+  size_t const prefix = (size_t)text[*pos], suffix = (size_t)text[*pos + 1];
+  if ((restart && prefix) || prefix > *len || suffix >= buflen - prefix || suffix > textlen - *pos - 2) {
+    return false;
+  }
+  *pos += 2 + suffix;
+  *len = prefix + suffix;
+  return true;
+}
+
+// Same as font_dict_validate_name for a normalized name, which may be coded by the alphabet.
+// narrow holds the kind of the previous normalized name and receives the decoded one.
+static bool font_dict_validate_norm(wchar_t const *const text,
+                                    size_t const textlen,
+                                    size_t *const pos,
+                                    bool const restart,
+                                    size_t *const len,
+                                    bool *const narrow,
+                                    size_t const alphabet_len) {
+  if (textlen - *pos < 2) {
+    return false;
+  }
+  size_t const prefix = (size_t)text[*pos], raw = (size_t)text[*pos + 1];
+  size_t const suffix = raw & ~(size_t)font_dict_wide;
+  bool const n = !(raw & font_dict_wide);
+  size_t const units = n ? (suffix + 1) / 2 : suffix;
+  if ((restart && prefix) || (prefix && n != *narrow) || prefix > *len ||
+      suffix >= font_dict_norm_buffer_len - prefix || units > textlen - *pos - 2) {
+    return false;
+  }
+  if (n) {
+    for (size_t i = 0; i < suffix; ++i) {
+      uint32_t const u = (uint32_t)text[*pos + 2 + i / 2];
+      if (((i % 2 ? u >> 8 : u) & 0xff) >= alphabet_len) {
+        return false;
+      }
+    }
+  }
+  *pos += 2 + units;
+  *len = prefix + suffix;
+  *narrow = n;
+  return true;
+}
+
+// Checks that the entries can be decoded within text and the buffers of the cursor,
+// and that they match the restart points and the normalized lengths.
+static bool font_dict_validate(wchar_t const *const text,
+                               size_t const textlen,
+                               uint32_t const *const restarts,
+                               uint16_t const *const normlen,
+                               size_t const num,
+                               size_t const alphabet_len) {
+  size_t pos = 0, namelen = 0, prevnormlen = 0;
+  bool narrow = false;
+  for (size_t i = 0; i < num; ++i) {
+    bool const restart = i % font_dict_restart_interval == 0;
+    if (restart && restarts[i / font_dict_restart_interval] != pos) {
+      return false;
+    }
+    if (!font_dict_validate_name(text, textlen, &pos, restart, &namelen, font_name_buffer_len) ||
+        !font_dict_validate_norm(text, textlen, &pos, restart, &prevnormlen, &narrow, alphabet_len)) {
+      return false;
+    }
+    if (normlen[i] != prevnormlen) {
+      return false;
+    }
+  }
+  return pos == textlen;
+}
+
+static bool font_list_build_signature(struct font_list *const fl) {
+  uint64_t *sig = realloc(NULL, fl->num * (sizeof(uint64_t) + sizeof(uint16_t)));
+  if (!sig) {
+    return false;
+  }
+  uint16_t *len = (void *)(sig + fl->num);
+  struct font_dict_cursor c = {0};
+  for (size_t i = 0; i < fl->num; ++i) {
+    font_dict_cursor_seek(&c, fl, i);
+    sig[i] = signature_string(font_dict_cursor_norm(&c, fl), c.normlen);
+    len[i] = (uint16_t)c.normlen;
+  }
+  fl->signature = sig;
+  fl->normlen = len;
+  return true;
+}
+
+// Bigram inverted index over the normalized names.
+//
+// Each posting list is stored in postings as a varint encoded count followed by
+// varint encoded deltas of the ascending font indices.
+// The key of a bigram is made from two code units, if wchar_t is wider than 16 bits
+// different bigrams may share a key, which only adds extra candidates.
+
+static inline uint32_t qgram_key(wchar_t const a, wchar_t const b) { return ((uint32_t)a << 16) ^ (uint32_t)b; }
+
+static inline size_t qgram_slot(uint32_t const key) { return key * 2654435761u; }
+
+static size_t varint_len(uint32_t v) {
+  size_t n = 1;
+  while (v >= 0x80) {
+    v >>= 7;
+    ++n;
+  }
+  return n;
+}
+
+static uint8_t *varint_write(uint8_t *p, uint32_t v) {
+  while (v >= 0x80) {
+    *p++ = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  *p++ = (uint8_t)v;
+  return p;
+}
+
+static uint32_t varint_read(uint8_t const **const pp) {
+  uint8_t const *p = *pp;
+  uint32_t v = 0;
+  for (int shift = 0;; shift += 7) {
+    uint8_t const b = *p++;
+    v |= (uint32_t)(b & 0x7f) << shift;
+    if (b < 0x80) {
+      break;
+    }
+  }
+  *pp = p;
+  return v;
+}
+
+// Sorts the pairs by the bigram in the upper half with a radix sort, which keeps the order of the fonts of a bigram.
+// The pairs are made in the order of the fonts, so they end up sorted as a whole, several times faster than by qsort.
+// The bytes that are the same in all pairs, such as the upper bytes of ASCII, are skipped.
+static bool qgram_sort_pairs(uint64_t **const pairs, size_t const npairs) {
+  if (npairs < 2) {
+    return true;
+  }
+  uint64_t *const buf = realloc(NULL, npairs * sizeof(uint64_t));
+  if (!buf) {
+    return false;
+  }
+  uint64_t *src = *pairs, *dst = buf;
+  for (unsigned shift = 32; shift < 64; shift += 8) {
+    size_t pos[256] = {0};
+    for (size_t i = 0; i < npairs; ++i) {
+      ++pos[(src[i] >> shift) & 0xff];
+    }
+    if (pos[(src[0] >> shift) & 0xff] == npairs) {
+      continue;
+    }
+    for (size_t d = 0, total = 0; d < 256; ++d) {
+      size_t const count = pos[d];
+      pos[d] = total;
+      total += count;
+    }
+    for (size_t i = 0; i < npairs; ++i) {
+      dst[pos[(src[i] >> shift) & 0xff]++] = src[i];
+    }
+    uint64_t *const t = src;
+    src = dst;
+    dst = t;
+  }
+  *pairs = src;
+  free(dst);
+  return true;
+}
+
+static bool font_list_build_qgram(struct font_list *const fl) {
+  struct font_qgram_index *const ix = &fl->qgram;
+  bool ret = false;
+  uint64_t *pairs = NULL;
+  size_t npairs = 0;
+  for (size_t i = 0; i < fl->num; ++i) {
+    if (fl->normlen[i] >= 2) {
+      npairs += fl->normlen[i] - 1;
+    }
+  }
+  pairs = realloc(NULL, (npairs ? npairs : 1) * sizeof(uint64_t));
+  if (!pairs) {
+    goto cleanup;
+  }
+  npairs = 0;
+  struct font_dict_cursor c = {0};
+  for (size_t i = 0; i < fl->num; ++i) {
+    font_dict_cursor_seek(&c, fl, i);
+    wchar_t const *const norm = font_dict_cursor_norm(&c, fl);
+    for (size_t j = 1; j < c.normlen; ++j) {
+      pairs[npairs++] = ((uint64_t)qgram_key(norm[j - 1], norm[j]) << 32) | (uint64_t)i;
+    }
+  }
+  if (!qgram_sort_pairs(&pairs, npairs)) {
+    goto cleanup;
+  }
+
+  // The same bigram may appear more than once in a name, so duplicates are skipped.
+  size_t nkeys = 0, bytes = 0;
+  for (size_t i = 0; i < npairs;) {
+    uint32_t const key = (uint32_t)(pairs[i] >> 32);
+    uint32_t count = 0, prev = 0;
+    for (; i < npairs && (uint32_t)(pairs[i] >> 32) == key; ++i) {
+      uint32_t const idx = (uint32_t)pairs[i];
+      if (count && idx == prev) {
+        continue;
+      }
+      bytes += varint_len(idx - prev);
+      prev = idx;
+      ++count;
+    }
+    bytes += varint_len(count);
+    ++nkeys;
+  }
+
+  size_t cap = 16;
+  while (cap < nkeys * 2) {
+    cap <<= 1;
+  }
+  ix->keys = realloc(NULL, cap * 2 * sizeof(uint32_t));
+  ix->postings = realloc(NULL, bytes ? bytes : 1);
+  if (!ix->keys || !ix->postings) {
+    goto cleanup;
+  }
+  ix->offsets = ix->keys + cap;
+  ix->mask = cap - 1;
+  ix->postings_size = bytes;
+  for (size_t i = 0; i < cap; ++i) {
+    ix->offsets[i] = UINT32_MAX;
+  }
+
+  uint8_t *p = ix->postings;
+  for (size_t i = 0; i < npairs;) {
+    uint32_t const key = (uint32_t)(pairs[i] >> 32);
+    size_t end = i;
+    uint32_t count = 0;
+    for (uint32_t prev = 0; end < npairs && (uint32_t)(pairs[end] >> 32) == key; ++end) {
+      uint32_t const idx = (uint32_t)pairs[end];
+      if (!count || idx != prev) {
+        ++count;
+      }
+      prev = idx;
+    }
+    size_t slot = qgram_slot(key) & ix->mask;
+    while (ix->offsets[slot] != UINT32_MAX) {
+      slot = (slot + 1) & ix->mask;
+    }
+    ix->keys[slot] = key;
+    ix->offsets[slot] = (uint32_t)(p - ix->postings);
+    p = varint_write(p, count);
+    for (uint32_t prev = 0, written = 0; i < end; ++i) {
+      uint32_t const idx = (uint32_t)pairs[i];
+      if (written && idx == prev) {
+        continue;
+      }
+      p = varint_write(p, idx - prev);
+      prev = idx;
+      ++written;
+    }
+  }
+  ret = true;
+
+cleanup:
+  if (!ret) {
+    if (ix->keys) {
+      free(ix->keys);
+    }
+    if (ix->postings) {
+      free(ix->postings);
+    }
+    *ix = (struct font_qgram_index){0};
+  }
+  if (pairs) {
+    free(pairs);
+  }
+  return ret;
+}
+
+static inline size_t font_batch_num_blocks(size_t const num) {
+  return (num + font_batch_lanes - 1) / font_batch_lanes;
+}
+
+static bool font_list_build_batch(struct font_list *const fl) {
+  struct font_batch_index *const ix = &fl->batch;
+  size_t const nblocks = font_batch_num_blocks(fl->num);
+  ix->offsets = realloc(NULL, (nblocks + 1) * sizeof(uint32_t) + nblocks * sizeof(uint16_t));
+  if (!ix->offsets) {
     goto failed;
   }
-  sn[snormlen] = L'\0';
-  extended_normalize(sn);
+  ix->wide = (void *)(ix->offsets + nblocks + 1);
+  size_t size = 0;
+  struct font_dict_cursor c = {0};
+  for (size_t b = 0; b < nblocks; ++b) {
+    size_t width = 0;
+    uint16_t wide = 0;
+    for (size_t lane = 0; lane < font_batch_lanes && b * font_batch_lanes + lane < fl->num; ++lane) {
+      font_dict_cursor_seek(&c, fl, b * font_batch_lanes + lane);
+      if (!c.narrow) {
+        wide |= (uint16_t)(1u << lane);
+      } else if (width < c.normlen) {
+        width = c.normlen;
+      }
+    }
+    ix->offsets[b] = (uint32_t)size;
+    ix->wide[b] = wide;
+    size += width * font_batch_lanes;
+    if (size > UINT32_MAX) {
+      goto failed;
+    }
+  }
+  ix->offsets[nblocks] = (uint32_t)size;
+  ix->codes = realloc(NULL, size ? size : 1);
+  if (!ix->codes) {
+    goto failed;
+  }
+  ix->codes_size = size;
+  memset(ix->codes, font_alphabet_none, size);
+  for (size_t i = 0; i < fl->num; ++i) {
+    font_dict_cursor_seek(&c, fl, i);
+    if (!c.narrow) {
+      continue;
+    }
+    uint8_t *const dest = ix->codes + ix->offsets[i / font_batch_lanes] + i % font_batch_lanes;
+    for (size_t pos = 0; pos < c.normlen; ++pos) {
+      dest[pos * font_batch_lanes] = c.code[pos];
+    }
+  }
+  return true;
+
+failed:
+  if (ix->offsets) {
+    free(ix->offsets);
+  }
+  *ix = (struct font_batch_index){0};
+  return false;
+}
+
+// Family index.
+//
+// A name is split into the family and the style words at its end, "Noto Sans JP Bold" is the Bold of
+// "Noto Sans JP" and "ヒラギノ角ゴ Pro W6" is the W6 of "ヒラギノ角ゴ Pro". The first word is always kept as
+// the family, so a font named "Black" is a family of its own.
+
+struct font_style_word {
+  wchar_t const *word; // lower case
+  uint16_t weight;     // 0 for italic
+};
+
+static struct font_style_word const font_style_words[] = {
+    {L"thin", 100},
+    {L"hairline", 100},
+    {L"extralight", 200},
+    {L"ultralight", 200},
+    {L"light", 300},
+    {L"semilight", 350},
+    {L"regular", 400},
+    {L"normal", 400},
+    {L"book", 400},
+    {L"roman", 400},
+    {L"medium", 500},
+    {L"semibold", 600},
+    {L"demibold", 600},
+    {L"bold", 700},
+    {L"extrabold", 800},
+    {L"ultrabold", 800},
+    {L"heavy", 900},
+    {L"black", 900},
+    {L"italic", 0},
+    {L"oblique", 0},
+};
+
+// Returns the weight of the style word, 0 for italic, or -1 if it is not a style word.
+static int font_style_word_weight(wchar_t const *const word, size_t const len) {
+  // W0 to W9 as in the Japanese font families.
+  if (len == 2 && (word[0] == L'W' || word[0] == L'w') && word[1] >= L'0' && word[1] <= L'9') {
+    return word[1] == L'0' ? 50 : (word[1] - L'0') * 100;
+  }
+  wchar_t lower[16];
+  if (len >= sizeof(lower) / sizeof(lower[0])) {
+    return -1;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    lower[i] = word[i] >= L'A' && word[i] <= L'Z' ? (wchar_t)(word[i] + (L'a' - L'A')) : word[i];
+  }
+  lower[len] = L'\0';
+  for (size_t i = 0; i < sizeof(font_style_words) / sizeof(font_style_words[0]); ++i) {
+    if (wcscmp(lower, font_style_words[i].word) == 0) {
+      return font_style_words[i].weight;
+    }
+  }
+  return -1;
+}
+
+static inline bool font_family_separator(wchar_t const ch) { return ch == L' ' || ch == L'-'; }
+
+// Returns the length of the family part of the name and writes the weight of the style words to weight.
+static size_t font_family_split(wchar_t const *const name, size_t const len, uint16_t *const weight) {
+  size_t end = len;
+  int w = 0;
+  bool italic = false;
+  for (;;) {
+    size_t begin = end;
+    while (begin > 0 && !font_family_separator(name[begin - 1])) {
+      --begin;
+    }
+    if (begin == 0) {
+      break;
+    }
+    int const ww = font_style_word_weight(name + begin, end - begin);
+    if (ww < 0) {
+      break;
+    }
+    if (!ww) {
+      italic = true;
+    } else if (!w) {
+      w = ww;
+    }
+    end = begin - 1;
+    while (end > 0 && font_family_separator(name[end - 1])) {
+      --end;
+    }
+  }
+  *weight = (uint16_t)((w ? w : 400) + (italic ? 1 : 0));
+  return end;
+}
+
+struct font_family_entry {
+  wchar_t const *name;
+  size_t famlen;
+  uint32_t idx;
+  uint32_t first; // the first font of the family in the list
+  uint16_t weight;
+};
+
+static int compare_family_name(struct font_family_entry const *const a, struct font_family_entry const *const b) {
+  int const r = wcsncmp(a->name, b->name, a->famlen < b->famlen ? a->famlen : b->famlen);
+  if (r) {
+    return r;
+  }
+  return a->famlen < b->famlen ? -1 : a->famlen > b->famlen ? 1 : 0;
+}
+
+static int compare_family_entry(void const *const n1, void const *const n2) {
+  struct font_family_entry const *const a = n1;
+  struct font_family_entry const *const b = n2;
+  int const r = compare_family_name(a, b);
+  if (r) {
+    return r;
+  }
+  if (a->weight != b->weight) {
+    return a->weight < b->weight ? -1 : 1;
+  }
+  return a->idx < b->idx ? -1 : a->idx > b->idx ? 1 : 0;
+}
+
+static int compare_family_first(void const *const n1, void const *const n2) {
+  struct font_family_entry const *const a = n1;
+  struct font_family_entry const *const b = n2;
+  if (a->first != b->first) {
+    return a->first < b->first ? -1 : 1;
+  }
+  if (a->weight != b->weight) {
+    return a->weight < b->weight ? -1 : 1;
+  }
+  return a->idx < b->idx ? -1 : a->idx > b->idx ? 1 : 0;
+}
+
+static bool font_list_build_family(struct font_list *const fl) {
+  bool ret = false;
+  struct font_family_index *const ix = &fl->family;
+  size_t const num = fl->num;
+  struct font_family_entry *entries = realloc(NULL, (num ? num : 1) * sizeof(struct font_family_entry));
+  wchar_t *names = realloc(NULL, (num ? num : 1) * font_name_buffer_len * sizeof(wchar_t));
+  ix->members = realloc(NULL, (num ? num : 1) * (sizeof(uint32_t) * 3 + sizeof(uint16_t)));
+  ix->offsets = realloc(NULL, (num + 1) * sizeof(uint32_t));
+  if (!entries || !names || !ix->members || !ix->offsets) {
+    goto cleanup;
+  }
+  ix->family = ix->members + num;
+  ix->slot = ix->family + num;
+  ix->weight = (void *)(ix->slot + num);
+
+  struct font_dict_cursor c = {0};
+  for (size_t i = 0; i < num; ++i) {
+    font_dict_cursor_seek(&c, fl, i);
+    wchar_t *const name = names + i * font_name_buffer_len;
+    memcpy(name, c.name, (c.namelen + 1) * sizeof(wchar_t));
+    entries[i] = (struct font_family_entry){
+        .name = name,
+        .idx = (uint32_t)i,
+    };
+    entries[i].famlen = font_family_split(name, c.namelen, &entries[i].weight);
+  }
+  // Group the fonts by family, then order the families by their first font.
+  qsort(entries, num, sizeof(struct font_family_entry), compare_family_entry);
+  for (size_t i = 0; i < num;) {
+    uint32_t first = entries[i].idx;
+    size_t end = i + 1;
+    for (; end < num && compare_family_name(entries + i, entries + end) == 0; ++end) {
+      if (first > entries[end].idx) {
+        first = entries[end].idx;
+      }
+    }
+    for (; i < end; ++i) {
+      entries[i].first = first;
+    }
+  }
+  qsort(entries, num, sizeof(struct font_family_entry), compare_family_first);
+  size_t nfamilies = 0;
+  for (size_t i = 0; i < num; ++i) {
+    if (!i || entries[i].first != entries[i - 1].first) {
+      ix->offsets[nfamilies++] = (uint32_t)i;
+    }
+    uint32_t const idx = entries[i].idx;
+    ix->members[i] = idx;
+    ix->family[idx] = (uint32_t)(nfamilies - 1);
+    ix->slot[idx] = (uint32_t)i;
+    ix->weight[idx] = entries[i].weight;
+  }
+  ix->offsets[nfamilies] = (uint32_t)num;
+  ix->num = nfamilies;
+  // Give back the unused offsets, the larger buffer is still usable if this fails.
+  (void)my_realloc(&ix->offsets, (nfamilies + 1) * sizeof(uint32_t));
+  ret = true;
+
+cleanup:
+  if (names) {
+    free(names);
+  }
+  if (entries) {
+    free(entries);
+  }
+  if (!ret) {
+    if (ix->members) {
+      free(ix->members);
+    }
+    if (ix->offsets) {
+      free(ix->offsets);
+    }
+    *ix = (struct font_family_index){0};
+  }
+  return ret;
+}
+
+size_t font_list_step_in_family(struct font_list const *const fl, size_t const idx, int const delta) {
+  if (!fl || !fl->family.members || idx >= fl->num) {
+    ods(L"invalid parameter");
+    return idx;
+  }
+  struct font_family_index const *const ix = &fl->family;
+  uint32_t const f = ix->family[idx];
+  int const first = (int)ix->offsets[f];
+  int const last = (int)ix->offsets[f + 1] - 1;
+  int pos = (int)ix->slot[idx] + delta;
+  pos = pos < first ? first : pos > last ? last : pos;
+  return ix->members[pos];
+}
+
+size_t font_list_step_family(struct font_list const *const fl, size_t const idx, int const delta) {
+  if (!fl || !fl->family.members || idx >= fl->num) {
+    ods(L"invalid parameter");
+    return idx;
+  }
+  struct font_family_index const *const ix = &fl->family;
+  int f = (int)ix->family[idx] + delta;
+  f = f < 0 ? 0 : f >= (int)ix->num ? (int)ix->num - 1 : f;
+  if ((uint32_t)f == ix->family[idx]) {
+    return idx;
+  }
+  // The members of a family are ordered by weight, so find the closest one by binary search.
+  uint16_t const w = ix->weight[idx];
+  size_t const first = ix->offsets[f];
+  size_t lo = first, hi = ix->offsets[f + 1];
+  while (lo < hi) {
+    size_t const mid = lo + (hi - lo) / 2;
+    if (ix->weight[ix->members[mid]] < w) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == ix->offsets[f + 1] ||
+      (lo > first && w - ix->weight[ix->members[lo - 1]] < ix->weight[ix->members[lo]] - w)) {
+    --lo;
+  }
+  return ix->members[lo];
+}
+
+// Tells the font lists apart for the caches of query results, 0 is never used.
+static uint32_t font_list_next_generation(void) {
+  static LONG volatile generation = 0;
+  uint32_t g;
+  do {
+    g = (uint32_t)InterlockedIncrement(&generation);
+  } while (!g);
+  return g;
+}
+
+static bool font_list_build(struct font_list *const fl, struct enum_font_data *const fd) {
+  bool ret = false;
+  struct font_sort_entry *entries = NULL;
+  wchar_t *text = NULL;
+  uint32_t *restarts = NULL;
+  size_t const num = fd->n;
+
+  // Create sorted font list by comparing the sort keys.
+  entries = realloc(NULL, (num ? num : 1) * sizeof(struct font_sort_entry));
+  if (!entries) {
+    ods(L"failed to allocate font sort buffer");
+    goto cleanup;
+  }
+  for (size_t i = 0; i < num; ++i) {
+    size_t const begin = i ? fd->keyend[i - 1] : 0;
+    entries[i] = (struct font_sort_entry){
+        .key = fd->keys + begin,
+        .keylen = fd->keyend[i] - begin,
+        .name = fd->buf + fd->list.pos[i],
+        .idx = i,
+    };
+    for (size_t j = 0; j < 8; ++j) {
+      entries[i].prefix = (entries[i].prefix << 8) | (j < entries[i].keylen ? entries[i].key[j] : 0);
+    }
+  }
+  qsort(entries, num, sizeof(struct font_sort_entry), compare_sort_entry);
+
+  if (!font_alphabet_build(fl->alphabet, &fl->alphabet_len, entries, num)) {
+    ods(L"failed to allocate font name alphabet buffer");
+    goto cleanup;
+  }
+
+  // Front-code the names in the sorted order.
+  // Each name takes two more code units than with the null character, which bounds the size of text.
+  if (fd->pos + num * 2 > UINT32_MAX) {
+    ods(L"font list is too large");
+    goto cleanup;
+  }
+  text = realloc(NULL, (fd->pos + num * 2 + 1) * sizeof(wchar_t));
+  restarts = realloc(NULL, (font_dict_num_restarts(num) + 1) * sizeof(uint32_t));
+  if (!text || !restarts) {
+    ods(L"failed to allocate sorted font list buffer");
+    goto cleanup;
+  }
+  size_t pos = 0;
+  wchar_t const *prev = NULL, *prevnorm = NULL;
+  size_t prevlen = 0, prevnormlen = 0;
+  bool prevnarrow = false;
+  uint8_t code[2][font_dict_norm_buffer_len];
+  for (size_t i = 0; i < num; ++i) {
+    wchar_t const *const name = entries[i].name;
+    size_t const len = wcslen(name);
+    wchar_t const *const norm = name + len + 1;
+    size_t const normlen = wcslen(norm);
+    if (i % font_dict_restart_interval == 0) {
+      restarts[i / font_dict_restart_interval] = (uint32_t)pos;
+      prevlen = 0;
+      prevnormlen = 0;
+    }
+    pos = font_dict_put(text, pos, prev, prevlen, name, len, 0);
+    // The codes of the previous name are in code[(i + 1) % 2].
+    bool const narrow = font_alphabet_encode(fl->alphabet, fl->alphabet_len, norm, normlen, code[i % 2]);
+    size_t const shared = narrow == prevnarrow ? prevnormlen : 0;
+    if (narrow) {
+      pos = font_dict_put_code(text, pos, code[(i + 1) % 2], shared, code[i % 2], normlen);
+    } else {
+      pos = font_dict_put(text, pos, prevnorm, shared, norm, normlen, font_dict_wide);
+    }
+    prev = name;
+    prevlen = len;
+    prevnorm = norm;
+    prevnormlen = normlen;
+    prevnarrow = narrow;
+  }
+  // Give back the space saved by the front coding, the larger buffer is still usable if this fails.
+  (void)my_realloc(&text, (pos ? pos : 1) * sizeof(wchar_t));
+
+  fl->text = text;
+  fl->textlen = pos;
+  fl->restarts = restarts;
+  fl->num = num;
+  text = NULL;
+  restarts = NULL;
+  if (!font_list_build_signature(fl)) {
+    ods(L"failed to allocate font name signature table");
+    font_list_destroy(fl);
+    goto cleanup;
+  }
+  if (!font_list_build_qgram(fl)) {
+    ods(L"failed to build font name bigram index");
+    font_list_destroy(fl);
+    goto cleanup;
+  }
+  if (!font_list_build_batch(fl)) {
+    ods(L"failed to build font name batch index");
+    font_list_destroy(fl);
+    goto cleanup;
+  }
+  if (!font_list_build_family(fl)) {
+    ods(L"failed to build font family index");
+    font_list_destroy(fl);
+    goto cleanup;
+  }
+  fl->generation = font_list_next_generation();
+  ret = true;
+
+cleanup:
+  if (restarts) {
+    free(restarts);
+  }
+  if (text) {
+    free(text);
+  }
+  if (entries) {
+    free(entries);
+  }
+  return ret;
+}
+
+static void enum_font_data_free(struct enum_font_data *const fd) {
+  if (fd->list.wc) {
+    free(fd->list.wc);
+    fd->list.wc = NULL;
+  }
+  if (fd->buf) {
+    free(fd->buf);
+    fd->buf = NULL;
+  }
+  if (fd->seen) {
+    free(fd->seen);
+    fd->seen = NULL;
+  }
+  fd->seen_mask = 0;
+  if (fd->keys) {
+    free(fd->keys);
+    fd->keys = NULL;
+  }
+  if (fd->keyend) {
+    free(fd->keyend);
+    fd->keyend = NULL;
+  }
+}
+
+// Font list cache file.
+//
+// The cache holds the sorted names and all indexes in the same layout as the memory,
+// so that the file can be used through a read-only file mapping without copying.
+// It is tied to the enumerated font names by font_cache_key.
+
+enum {
+  font_cache_magic = 0x43464154, // "TAFC"
+  font_cache_version = 6,
+};
+
+struct font_cache_key {
+  uint32_t count; // number of enumerated fonts
+  uint32_t hash;  // FNV-1a of the enumerated font names
+  uint32_t lcid;  // the sort order depends on the user locale
+};
+
+struct font_cache_header {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t wchar_size;
+  uint32_t file_size;
+  uint32_t checksum; // of everything after the header
+  struct font_cache_key key;
+  uint32_t num;
+  uint32_t text_offset;
+  uint32_t text_size;
+  uint32_t restarts_offset;
+  uint32_t alphabet_offset;
+  uint32_t alphabet_len;
+  uint32_t signature_offset; // followed by normlen
+  uint32_t qgram_offset;     // keys followed by offsets
+  uint32_t qgram_cap;
+  uint32_t postings_offset;
+  uint32_t postings_size;
+  uint32_t batch_offset; // offsets followed by wide
+  uint32_t batch_codes_offset;
+  uint32_t batch_codes_size;
+  uint32_t family_offset; // members followed by family, slot and weight
+  uint32_t family_offsets_offset;
+  uint32_t family_num;
+};
+
+static void font_cache_key_init(struct font_cache_key *const key, struct enum_font_data const *const fd) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < fd->n; ++i) {
+    for (wchar_t const *p = fd->buf + fd->list.pos[i];; ++p) {
+      h ^= (uint32_t)(*p);
+      h *= 16777619u;
+      if (!*p) {
+        break;
+      }
+    }
+  }
+  key->count = (uint32_t)fd->n;
+  key->hash = h;
+  key->lcid = (uint32_t)GetUserDefaultLCID();
+}
+
+static inline size_t font_cache_align(size_t const v) { return (v + 7) & ~(size_t)7; }
+
+// FNV-1a over 32-bit words, size must be a multiple of 4.
+static uint32_t font_cache_checksum(void const *const p, size_t const size) {
+  uint32_t const *w = p;
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < size / sizeof(uint32_t); ++i) {
+    h ^= w[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+
+static bool font_cache_save(struct font_list const *const fl,
+                            struct font_cache_key const *const key,
+                            wchar_t const *const path) {
+  bool ret = false;
+  uint8_t *buf = NULL;
+  HANDLE h = INVALID_HANDLE_VALUE;
+  wchar_t tmp[MAX_PATH];
+  if (wcslen(path) + 5 > MAX_PATH) {
+    ods(L"font cache path is too long");
+    return false;
+  }
+  wcscpy(tmp, path);
+  wcscat(tmp, L".tmp");
+
+  struct font_cache_header hdr = {
+      .magic = font_cache_magic,
+      .version = font_cache_version,
+      .wchar_size = sizeof(wchar_t),
+      .key = *key,
+      .num = (uint32_t)fl->num,
+      .alphabet_len = (uint32_t)fl->alphabet_len,
+      .qgram_cap = (uint32_t)(fl->qgram.mask + 1),
+      .postings_size = (uint32_t)fl->qgram.postings_size,
+      .batch_codes_size = (uint32_t)fl->batch.codes_size,
+      .family_num = (uint32_t)fl->family.num,
+  };
+  size_t const nblocks = font_batch_num_blocks(fl->num);
+  size_t const batch_size = (nblocks + 1) * sizeof(uint32_t) + nblocks * sizeof(uint16_t);
+  size_t const text_size = fl->textlen * sizeof(wchar_t);
+  size_t const family_size = fl->num * (sizeof(uint32_t) * 3 + sizeof(uint16_t));
+  size_t pos = font_cache_align(sizeof(hdr));
+  hdr.text_offset = (uint32_t)pos;
+  hdr.text_size = (uint32_t)text_size;
+  pos = font_cache_align(pos + text_size);
+  hdr.restarts_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + font_dict_num_restarts(fl->num) * sizeof(uint32_t));
+  hdr.alphabet_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + fl->alphabet_len * sizeof(wchar_t));
+  hdr.signature_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + fl->num * (sizeof(uint64_t) + sizeof(uint16_t)));
+  hdr.qgram_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + hdr.qgram_cap * 2 * sizeof(uint32_t));
+  hdr.postings_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + fl->qgram.postings_size);
+  hdr.batch_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + batch_size);
+  hdr.batch_codes_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + fl->batch.codes_size);
+  hdr.family_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + family_size);
+  hdr.family_offsets_offset = (uint32_t)pos;
+  pos = font_cache_align(pos + (fl->family.num + 1) * sizeof(uint32_t));
+  hdr.file_size = (uint32_t)pos;
+
+  buf = realloc(NULL, pos);
+  if (!buf) {
+    ods(L"failed to allocate font cache buffer");
+    goto cleanup;
+  }
+  memset(buf, 0, pos);
+  if (text_size) {
+    memcpy(buf + hdr.text_offset, fl->text, text_size);
+  }
+  if (fl->num) {
+    memcpy(buf + hdr.restarts_offset, fl->restarts, font_dict_num_restarts(fl->num) * sizeof(uint32_t));
+  }
+  memcpy(buf + hdr.alphabet_offset, fl->alphabet, fl->alphabet_len * sizeof(wchar_t));
+  memcpy(buf + hdr.signature_offset, fl->signature, fl->num * (sizeof(uint64_t) + sizeof(uint16_t)));
+  memcpy(buf + hdr.qgram_offset, fl->qgram.keys, hdr.qgram_cap * 2 * sizeof(uint32_t));
+  memcpy(buf + hdr.postings_offset, fl->qgram.postings, fl->qgram.postings_size);
+  memcpy(buf + hdr.batch_offset, fl->batch.offsets, batch_size);
+  memcpy(buf + hdr.batch_codes_offset, fl->batch.codes, fl->batch.codes_size);
+  if (fl->num) {
+    memcpy(buf + hdr.family_offset, fl->family.members, family_size);
+  }
+  memcpy(buf + hdr.family_offsets_offset, fl->family.offsets, (fl->family.num + 1) * sizeof(uint32_t));
+  size_t const payload = font_cache_align(sizeof(hdr));
+  hdr.checksum = font_cache_checksum(buf + payload, pos - payload);
+  memcpy(buf, &hdr, sizeof(hdr));
+
+  h = CreateFileW(tmp, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (h == INVALID_HANDLE_VALUE) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateFileW failed: %s", tmp);
+    goto cleanup;
+  }
+  DWORD written = 0;
+  if (!WriteFile(h, buf, (DWORD)pos, &written, NULL) || written != (DWORD)pos) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"WriteFile failed: %s", tmp);
+    goto cleanup;
+  }
+  CloseHandle(h);
+  h = INVALID_HANDLE_VALUE;
+  if (!MoveFileExW(tmp, path, MOVEFILE_REPLACE_EXISTING)) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"MoveFileExW failed: %s", path);
+    goto cleanup;
+  }
+  ret = true;
+
+cleanup:
+  if (h != INVALID_HANDLE_VALUE) {
+    CloseHandle(h);
+    h = INVALID_HANDLE_VALUE;
+  }
+  if (!ret) {
+    DeleteFileW(tmp);
+  }
+  if (buf) {
+    free(buf);
+    buf = NULL;
+  }
+  return ret;
+}
+
+static bool font_cache_in_range(struct font_cache_header const *const hdr, uint32_t const offset, size_t const size) {
+  return offset % 8 == 0 && offset <= hdr->file_size && size <= hdr->file_size - offset;
+}
+
+// Maps the cache file and makes fl point into it.
+// The header, the checksum and the structure of the strings and the tables are validated
+// because a broken file must not crash the host application.
+static bool font_cache_load(struct font_list *const fl,
+                            struct font_cache_key const *const key,
+                            wchar_t const *const path) {
+  bool ret = false;
+  HANDLE file = INVALID_HANDLE_VALUE;
+  HANDLE mapping = NULL;
+  uint8_t const *view = NULL;
+
+  file = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    goto cleanup;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart < (LONGLONG)sizeof(struct font_cache_header) ||
+      size.QuadPart > UINT32_MAX) {
+    goto cleanup;
+  }
+  mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (!mapping) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateFileMappingW failed: %s", path);
+    goto cleanup;
+  }
+  view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"MapViewOfFile failed: %s", path);
+    goto cleanup;
+  }
+
+  struct font_cache_header const *const hdr = (void const *)view;
+  size_t const payload = font_cache_align(sizeof(*hdr));
+  size_t const qgram_cap = hdr->qgram_cap;
+  size_t const num = hdr->num;
+  size_t const nblocks = font_batch_num_blocks(num);
+  size_t const nfamilies = hdr->family_num;
+  if (hdr->magic != font_cache_magic || hdr->version != font_cache_version || hdr->wchar_size != sizeof(wchar_t) ||
+      hdr->file_size != (uint32_t)size.QuadPart || hdr->file_size % 8 != 0 || hdr->key.count != key->count ||
+      hdr->key.hash != key->hash || hdr->key.lcid != key->lcid) {
+    goto cleanup;
+  }
+  if (!font_cache_in_range(hdr, hdr->text_offset, hdr->text_size) ||
+      !font_cache_in_range(hdr, hdr->restarts_offset, font_dict_num_restarts(num) * sizeof(uint32_t)) ||
+      hdr->alphabet_len > font_alphabet_size ||
+      !font_cache_in_range(hdr, hdr->alphabet_offset, hdr->alphabet_len * sizeof(wchar_t)) ||
+      !font_cache_in_range(hdr, hdr->signature_offset, num * (sizeof(uint64_t) + sizeof(uint16_t))) ||
+      !font_cache_in_range(hdr, hdr->qgram_offset, qgram_cap * 2 * sizeof(uint32_t)) ||
+      !font_cache_in_range(hdr, hdr->postings_offset, hdr->postings_size) ||
+      !font_cache_in_range(hdr, hdr->batch_offset, (nblocks + 1) * sizeof(uint32_t) + nblocks * sizeof(uint16_t)) ||
+      !font_cache_in_range(hdr, hdr->batch_codes_offset, hdr->batch_codes_size) ||
+      !font_cache_in_range(hdr, hdr->family_offset, num * (sizeof(uint32_t) * 3 + sizeof(uint16_t))) ||
+      nfamilies > num || !font_cache_in_range(hdr, hdr->family_offsets_offset, (nfamilies + 1) * sizeof(uint32_t)) ||
+      qgram_cap < 16 ||
+      (qgram_cap & (qgram_cap - 1)) != 0 ||
+      hdr->text_size % sizeof(wchar_t) != 0) {
+    goto cleanup;
+  }
+  if (font_cache_checksum(view + payload, hdr->file_size - payload) != hdr->checksum) {
+    ods(L"font cache is broken");
+    goto cleanup;
+  }
+
+  wchar_t const *const text = (void const *)(view + hdr->text_offset);
+  size_t const textlen = hdr->text_size / sizeof(wchar_t);
+  uint32_t const *const restarts = (void const *)(view + hdr->restarts_offset);
+  uint16_t const *const normlen = (void const *)(view + hdr->signature_offset + num * sizeof(uint64_t));
+  if (!font_dict_validate(text, textlen, restarts, normlen, num, hdr->alphabet_len)) {
+    goto cleanup;
+  }
+  uint32_t const *const qgram_offsets = (void const *)(view + hdr->qgram_offset + qgram_cap * sizeof(uint32_t));
+  for (size_t i = 0; i < qgram_cap; ++i) {
+    if (qgram_offsets[i] != UINT32_MAX && qgram_offsets[i] >= hdr->postings_size) {
+      goto cleanup;
+    }
+  }
+
+  uint32_t const *const batch_offsets = (void const *)(view + hdr->batch_offset);
+  if (batch_offsets[0] != 0 || batch_offsets[nblocks] != hdr->batch_codes_size) {
+    goto cleanup;
+  }
+  for (size_t b = 0; b < nblocks; ++b) {
+    if (batch_offsets[b + 1] < batch_offsets[b] || (batch_offsets[b + 1] - batch_offsets[b]) % font_batch_lanes) {
+      goto cleanup;
+    }
+  }
+
+  // Every font must be in exactly one family, at the position given by slot.
+  uint32_t const *const members = (void const *)(view + hdr->family_offset);
+  uint32_t const *const family = members + num;
+  uint32_t const *const slot = family + num;
+  uint32_t const *const family_offsets = (void const *)(view + hdr->family_offsets_offset);
+  if (family_offsets[0] != 0 || family_offsets[nfamilies] != num) {
+    goto cleanup;
+  }
+  for (size_t f = 0; f < nfamilies; ++f) {
+    if (family_offsets[f + 1] <= family_offsets[f]) {
+      goto cleanup;
+    }
+  }
+  for (size_t i = 0; i < num; ++i) {
+    if (family[i] >= nfamilies || slot[i] >= num || members[slot[i]] != i || slot[i] < family_offsets[family[i]] ||
+        slot[i] >= family_offsets[family[i] + 1]) {
+      goto cleanup;
+    }
+  }
+
+  // The pointers into the read-only view are exposed as non-const but they are never written.
+  fl->num = num;
+  fl->text = (wchar_t *)(uintptr_t)text;
+  fl->textlen = textlen;
+  fl->restarts = (uint32_t *)(uintptr_t)restarts;
+  // The alphabet lives in the struct, it is small enough to copy.
+  memcpy(fl->alphabet, view + hdr->alphabet_offset, hdr->alphabet_len * sizeof(wchar_t));
+  fl->alphabet_len = hdr->alphabet_len;
+  fl->signature = (uint64_t *)(uintptr_t)(view + hdr->signature_offset);
+  fl->normlen = (uint16_t *)(uintptr_t)normlen;
+  fl->qgram = (struct font_qgram_index){
+      .mask = qgram_cap - 1,
+      .keys = (uint32_t *)(uintptr_t)(view + hdr->qgram_offset),
+      .offsets = (uint32_t *)(uintptr_t)qgram_offsets,
+      .postings = (uint8_t *)(uintptr_t)(view + hdr->postings_offset),
+      .postings_size = hdr->postings_size,
+  };
+  fl->batch = (struct font_batch_index){
+      .offsets = (uint32_t *)(uintptr_t)batch_offsets,
+      .wide = (uint16_t *)(uintptr_t)(batch_offsets + nblocks + 1),
+      .codes = (uint8_t *)(uintptr_t)(view + hdr->batch_codes_offset),
+      .codes_size = hdr->batch_codes_size,
+  };
+  fl->family = (struct font_family_index){
+      .members = (uint32_t *)(uintptr_t)members,
+      .family = (uint32_t *)(uintptr_t)family,
+      .slot = (uint32_t *)(uintptr_t)slot,
+      .weight = (uint16_t *)(uintptr_t)(slot + num),
+      .offsets = (uint32_t *)(uintptr_t)family_offsets,
+      .num = nfamilies,
+  };
+  fl->cache_view = (void *)(uintptr_t)view;
+  fl->generation = font_list_next_generation();
+  view = NULL;
+  ret = true;
+
+cleanup:
+  if (view) {
+    UnmapViewOfFile(view);
+    view = NULL;
+  }
+  if (mapping) {
+    CloseHandle(mapping);
+    mapping = NULL;
+  }
+  if (file != INVALID_HANDLE_VALUE) {
+    CloseHandle(file);
+    file = INVALID_HANDLE_VALUE;
+  }
+  return ret;
+}
+
+enum {
+  font_cache_slots = 2,
+};
+
+// The cache is kept in one of two files, the path itself and the path with ".1" appended.
+// A font list loaded from the cache keeps its file mapped, and Windows can not replace or delete a mapped file,
+// so a rebuild while the list is in use saves to the other file, see font_cache_save_any.
+static bool font_cache_slot_path(wchar_t const *const path, size_t const slot, wchar_t *const buf) {
+  // font_cache_save appends ".tmp" to it.
+  if (wcslen(path) + 7 > MAX_PATH) {
+    ods(L"font cache path is too long");
+    return false;
+  }
+  wcscpy(buf, path);
+  if (slot) {
+    wcscat(buf, L".1");
+  }
+  return true;
+}
+
+// Loads whichever file was made for the fonts.
+static bool font_cache_load_any(struct font_list *const fl,
+                                struct font_cache_key const *const key,
+                                wchar_t const *const path) {
+  wchar_t buf[MAX_PATH];
+  for (size_t slot = 0; slot < font_cache_slots; ++slot) {
+    if (font_cache_slot_path(path, slot, buf) && font_cache_load(fl, key, buf)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Called only when font_cache_load_any failed, so every file is stale. The ones that can be deleted are,
+// and the list is saved to the first of them. A file that can not be deleted is still mapped by a list in use,
+// and is deleted by a later save after the list is destroyed.
+static bool font_cache_save_any(struct font_list const *const fl,
+                                struct font_cache_key const *const key,
+                                wchar_t const *const path) {
+  wchar_t buf[MAX_PATH];
+  size_t target = font_cache_slots;
+  for (size_t slot = 0; slot < font_cache_slots; ++slot) {
+    if (!font_cache_slot_path(path, slot, buf)) {
+      return false;
+    }
+    if ((DeleteFileW(buf) || GetLastError() == ERROR_FILE_NOT_FOUND) && target == font_cache_slots) {
+      target = slot;
+    }
+  }
+  if (target == font_cache_slots) {
+    ods(L"all font cache files are in use");
+    return false;
+  }
+  return font_cache_slot_path(path, target, buf) && font_cache_save(fl, key, buf);
+}
+
+static size_t font_similar_thread_count(size_t const n) {
+  SYSTEM_INFO si;
+  GetSystemInfo(&si);
+  size_t const threads = si.dwNumberOfProcessors ? (size_t)si.dwNumberOfProcessors : 1;
+  size_t const ranges = n / font_similar_chunk_min;
+  size_t const r = threads < ranges ? threads : ranges;
+  return r < font_similar_max_threads ? r : font_similar_max_threads;
+}
+
+bool font_list_create(struct font_list *fl, wchar_t const *const cache_path) {
+  bool ret = false;
+  HWND const window = GetDesktopWindow();
+  HDC dc = NULL;
+  struct enum_font_data fd = {0};
+  struct font_cache_key key;
+
+  *fl = (struct font_list){0};
+  dc = GetDC(window);
+  if (!dc) {
+    ods(L"GetDC failed");
+    goto cleanup;
+  }
+
+  // We should use EnumFontFamiliesExW but some fonts are not enumerate when
+  // using it. exedit.auf uses EnumFontFamilies, so follow it. LOGFONTW lf = { 0
+  // }; lf.lfCharSet = DEFAULT_CHARSET; EnumFontFamiliesExW(dc, &lf,
+  // enum_font_callback, (LPARAM)&fd, 0);
+  if (!EnumFontFamiliesW(dc, NULL, enum_font_callback, (LPARAM)&fd)) {
+    ods(L"EnumFontFamiliesW failed");
+    goto cleanup;
+  }
+
+  font_cache_key_init(&key, &fd);
+  if (cache_path && font_cache_load_any(fl, &key, cache_path)) {
+    ret = true;
+    goto cleanup;
+  }
+
+  if (!enum_font_data_normalize(&fd)) {
+    goto cleanup;
+  }
+  if (!font_list_build(fl, &fd)) {
+    goto cleanup;
+  }
+  if (cache_path && !font_cache_save_any(fl, &key, cache_path)) {
+    ods(L"failed to save font list cache");
+  }
+  ret = true;
+
+cleanup:
+  if (ret) {
+    size_t const threads = font_similar_thread_count(fl->num);
+    if (threads > 1 && !thread_pool_create(&fl->pool, threads)) {
+      ods(L"failed to create font similarity workers");
+    }
+  } else {
+    *fl = (struct font_list){0};
+  }
+  enum_font_data_free(&fd);
+  if (dc) {
+    ReleaseDC(window, dc);
+    dc = NULL;
+  }
+  return ret;
+}
+
+void font_list_destroy(struct font_list *fl) {
+  if (!fl) {
+    return;
+  }
+  thread_pool_destroy(&fl->pool);
+  if (fl->cache_view) {
+    // Everything lives in the mapped cache file.
+    UnmapViewOfFile(fl->cache_view);
+    *fl = (struct font_list){0};
+    return;
+  }
+  if (fl->text) {
+    free(fl->text);
+    fl->text = NULL;
+  }
+  fl->textlen = 0;
+  if (fl->restarts) {
+    free(fl->restarts);
+    fl->restarts = NULL;
+  }
+  fl->alphabet_len = 0;
+  fl->generation = 0;
+  if (fl->signature) {
+    // normlen shares the allocation with signature.
+    free(fl->signature);
+    fl->signature = NULL;
+  }
+  fl->normlen = NULL;
+  if (fl->qgram.keys) {
+    // offsets shares the allocation with keys.
+    free(fl->qgram.keys);
+  }
+  if (fl->qgram.postings) {
+    free(fl->qgram.postings);
+  }
+  fl->qgram = (struct font_qgram_index){0};
+  if (fl->batch.offsets) {
+    // wide shares the allocation with offsets.
+    free(fl->batch.offsets);
+  }
+  if (fl->batch.codes) {
+    free(fl->batch.codes);
+  }
+  fl->batch = (struct font_batch_index){0};
+  if (fl->family.members) {
+    // family, slot and weight share the allocation with members.
+    free(fl->family.members);
+  }
+  if (fl->family.offsets) {
+    free(fl->family.offsets);
+  }
+  fl->family = (struct font_family_index){0};
+  fl->num = 0;
+}
+
+// Returns the collation order of the name and s as the font list is sorted, or 0 on failure.
+static int font_dict_compare(wchar_t const *const name, size_t const namelen, wchar_t const *const s) {
+  int const r = CompareStringW(LOCALE_USER_DEFAULT, font_list_collation_flags, name, (int)namelen, s, -1);
+  if (!r) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CompareStringW failed");
+  }
+  return r;
+}
+
+// Binary-searches the first names of the blocks, then decodes the entries from the block before
+// the first one that does not sort before s. The names that collate equal to s can be a run that
+// spans several blocks, so the scan continues until the names sort after s.
+int font_list_index_of(struct font_list const *const fl, wchar_t const *const s) {
+  if (!fl || !s || !fl->text || !fl->restarts) {
+    ods(L"invalid parameter");
+    return -1;
+  }
+  size_t lo = 0, hi = font_dict_num_restarts(fl->num);
+  while (lo < hi) {
+    size_t const mid = lo + (hi - lo) / 2;
+    // The first entry of a block has no shared prefix.
+    wchar_t const *const p = fl->text + fl->restarts[mid];
+    int const r = font_dict_compare(p + 2, (size_t)p[1], s);
+    if (!r) {
+      return -1;
+    }
+    if (r == CSTR_LESS_THAN) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  struct font_dict_cursor c = {0};
+  for (size_t i = lo ? (lo - 1) * font_dict_restart_interval : 0; i < fl->num; ++i) {
+    font_dict_cursor_seek(&c, fl, i);
+    if (wcscmp(c.name, s) == 0) {
+      return (int)i;
+    }
+    int const r = font_dict_compare(c.name, c.namelen, s);
+    if (!r || r == CSTR_GREATER_THAN) {
+      break;
+    }
+  }
+  return -1;
+}
+
+enum {
+  font_dict_sort_key_buffer_len = font_name_buffer_len * 8 + 64,
+};
+
+// Writes the sort key of s to buf and returns the length of its primary weights, or SIZE_MAX on failure.
+// A sort key starts with the primary weights followed by the other weights, each section ends with 0x01.
+// The list is sorted by the whole keys, so it is also sorted by the primary weights, and the names whose primary
+// weights start with the ones of a prefix are contiguous.
+static size_t font_dict_primary_weights(wchar_t const *const s, size_t const len, uint8_t *const buf) {
+  int const r = LCMapStringW(LOCALE_USER_DEFAULT,
+                             LCMAP_SORTKEY | font_list_collation_flags,
+                             s,
+                             (int)len,
+                             (LPWSTR)(void *)buf,
+                             font_dict_sort_key_buffer_len);
+  if (!r) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"LCMapStringW failed: %s", s);
+    return SIZE_MAX;
+  }
+  uint8_t const *const sep = memchr(buf, 0x01, (size_t)r);
+  return sep ? (size_t)(sep - buf) : (size_t)r;
+}
+
+// Returns the first index in [lo, hi) whose name does not sort before the prefix if after is false,
+// or the first one that sorts after the names starting with the prefix if after is true, SIZE_MAX on failure.
+static size_t font_dict_prefix_bound(struct font_list const *const fl,
+                                     uint8_t const *const prefix,
+                                     size_t const prefixlen,
+                                     size_t lo,
+                                     size_t hi,
+                                     bool const after) {
+  struct font_dict_cursor c = {0};
+  uint8_t key[font_dict_sort_key_buffer_len];
+  while (lo < hi) {
+    size_t const mid = lo + (hi - lo) / 2;
+    font_dict_cursor_seek(&c, fl, mid);
+    size_t const keylen = font_dict_primary_weights(c.name, c.namelen, key);
+    if (keylen == SIZE_MAX) {
+      return SIZE_MAX;
+    }
+    int r = memcmp(key, prefix, keylen < prefixlen ? keylen : prefixlen);
+    if (!r && keylen < prefixlen) {
+      r = -1;
+    }
+    if (r < 0 || (r == 0 && after)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+bool font_list_prefix_range(struct font_list const *const fl,
+                            wchar_t const *const prefix,
+                            size_t *const first,
+                            size_t *const last) {
+  if (!fl || !prefix || !first || !last || !fl->text || !fl->restarts) {
+    ods(L"invalid parameter");
+    return false;
+  }
+  size_t const len = wcslen(prefix);
+  if (!len) {
+    *first = 0;
+    *last = fl->num;
+    return true;
+  }
+  if (len >= font_name_buffer_len) {
+    *first = 0;
+    *last = 0;
+    return true;
+  }
+  uint8_t key[font_dict_sort_key_buffer_len];
+  size_t const keylen = font_dict_primary_weights(prefix, len, key);
+  if (keylen == SIZE_MAX) {
+    return false;
+  }
+  size_t const lo = font_dict_prefix_bound(fl, key, keylen, 0, fl->num, false);
+  if (lo == SIZE_MAX) {
+    return false;
+  }
+  size_t const hi = font_dict_prefix_bound(fl, key, keylen, lo, fl->num, true);
+  if (hi == SIZE_MAX) {
+    return false;
+  }
+  *first = lo;
+  *last = hi;
+  return true;
+}
+
+void font_list_get_name(struct font_list const *const fl, size_t const idx, wchar_t *const buf) {
+  struct font_dict_cursor c = {0};
+  font_dict_cursor_seek(&c, fl, idx);
+  memcpy(buf, c.name, (c.namelen + 1) * sizeof(wchar_t));
+}
+
+void font_list_memory_usage(struct font_list const *const fl, struct font_list_memory_usage *const usage) {
+  *usage = (struct font_list_memory_usage){
+      .text = fl->textlen * sizeof(wchar_t),
+      .restarts = fl->restarts ? font_dict_num_restarts(fl->num) * sizeof(uint32_t) : 0,
+      .signature = fl->signature ? fl->num * (sizeof(uint64_t) + sizeof(uint16_t)) : 0,
+      .qgram = fl->qgram.keys ? (fl->qgram.mask + 1) * 2 * sizeof(uint32_t) + fl->qgram.postings_size : 0,
+      .batch = fl->batch.offsets ? (font_batch_num_blocks(fl->num) + 1) * sizeof(uint32_t) +
+                                       font_batch_num_blocks(fl->num) * sizeof(uint16_t) + fl->batch.codes_size
+                                 : 0,
+      .family = fl->family.members
+                    ? fl->num * (sizeof(uint32_t) * 3 + sizeof(uint16_t)) + (fl->family.num + 1) * sizeof(uint32_t)
+                    : 0,
+      .mapped = fl->cache_view != NULL,
+  };
+  usage->total = usage->text + usage->restarts + usage->signature + usage->qgram + usage->batch + usage->family;
+}
+
+// Based on https://github.com/convto/onp
+// implementation "An O(NP) Sequence Comparison Algorithm"
+// Copyright (c) 2019 YuyaOkumura
+
+struct diff {
+  wchar_t const *a;
+  wchar_t const *b;
+  // The alphabet codes of the strings if they are set by diff_init_code, otherwise NULL.
+  uint8_t const *a8;
+  uint8_t const *b8;
+  int m, n;
+  int fpbuflen;
+  int *fpbuf;
+};
+
+static void diff_init(struct diff *const d, wchar_t const *const a, int const m, wchar_t const *const b, int const n) {
+  d->a8 = NULL;
+  d->b8 = NULL;
+  if (m > n) {
+    d->a = b;
+    d->b = a;
+    d->m = n;
+    d->n = m;
+    return;
+  }
+  d->a = a;
+  d->b = b;
+  d->m = m;
+  d->n = n;
+}
+
+static void diff_init_code(struct diff *const d,
+                           uint8_t const *const a,
+                           int const m,
+                           uint8_t const *const b,
+                           int const n) {
+  d->a = NULL;
+  d->b = NULL;
+  if (m > n) {
+    d->a8 = b;
+    d->b8 = a;
+    d->m = n;
+    d->n = m;
+    return;
+  }
+  d->a8 = a;
+  d->b8 = b;
+  d->m = m;
+  d->n = n;
+}
+
+static int diff_snake(struct diff const *const d, int const k, int y) {
+  int x = y - k;
+  if (d->a8) {
+    while (x < d->m && y < d->n && d->a8[x] == d->b8[y]) {
+      ++x;
+      ++y;
+    }
+    return y;
+  }
+  while (x < d->m && y < d->n && d->a[x] == d->b[y]) {
+    ++x;
+    ++y;
+  }
+  return y;
+}
+
+static inline int diff_max(int const x, int const y) { return x > y ? x : y; }
+
+// Stops as soon as the score is known to exceed limit and returns a value greater than limit.
+static int diff_distance(struct diff *const d, int const limit) {
+  int offset = d->m + 1;
+  int delta = d->n - d->m;
+  int fplen = d->m + d->n + 3;
+  if (d->fpbuflen < fplen) {
+    d->fpbuflen = fplen;
+    if (!my_realloc(&d->fpbuf, (size_t)(d->fpbuflen) * sizeof(int))) {
+      return -1;
+    }
+  }
+  int *fp = d->fpbuf;
+  for (int i = 0; i < fplen; ++i) {
+    fp[i] = -1;
+  }
+  for (int p = 0;; ++p) {
+    if (delta + 8 * p > limit) {
+      return delta + 8 * p;
+    }
+    // -p <= k <= delta - 1
+    for (int k = -p; k <= delta - 1; ++k) {
+      fp[k + offset] = diff_snake(d, k, diff_max(fp[k - 1 + offset] + 1, fp[k + 1 + offset]));
+    }
+    // d.delta + 1 <= k <= d.delta + p
+    for (int k = delta + p; k >= delta + 1; --k) {
+      fp[k + offset] = diff_snake(d, k, diff_max(fp[k - 1 + offset] + 1, fp[k + 1 + offset]));
+    }
+    // d.delta == k
+    fp[delta + offset] = diff_snake(d, delta, diff_max(fp[delta - 1 + offset] + 1, fp[delta + 1 + offset]));
+    if (fp[delta + offset] == d->n) {
+      return delta + 8 * p;
+    }
+  }
+}
+
+// Bit-parallel LCS based on
+// "Bit-parallel LCS-length computation revisited" (Hyyrö 2004).
+//
+// When a is the shorter string, diff_distance returns delta + 8 * p,
+// where p is the number of elements of a that are not in the LCS of a and b.
+// So the same score can be derived from the LCS length:
+//   score = (n - m) + 8 * (m - lcs)
+// This is used when the pattern fits in 64 bits, otherwise diff_distance is used.
+
+enum {
+  bitlcs_max_len = 64,
+  bitlcs_ascii = 128,
+  bitlcs_table_size = 128,
+};
+
+struct bitlcs {
+  int len;
+  uint64_t ascii[bitlcs_ascii];
+  wchar_t keys[bitlcs_table_size];
+  uint64_t masks[bitlcs_table_size];
+};
+
+static inline size_t bitlcs_slot(wchar_t const ch) {
+  return ((uint32_t)ch * 2654435761u) >> 25;
+}
+
+static void bitlcs_init(struct bitlcs *const b, wchar_t const *const s, int const len) {
+  memset(b, 0, sizeof(*b));
+  b->len = len;
+  for (int i = 0; i < len; ++i) {
+    wchar_t const ch = s[i];
+    uint64_t const bit = UINT64_C(1) << i;
+    if ((uint32_t)(ch) < bitlcs_ascii) {
+      b->ascii[ch] |= bit;
+      continue;
+    }
+    // at most bitlcs_max_len keys are used, so an empty slot always exists.
+    size_t slot = bitlcs_slot(ch);
+    while (b->keys[slot] && b->keys[slot] != ch) {
+      slot = (slot + 1) & (bitlcs_table_size - 1);
+    }
+    b->keys[slot] = ch;
+    b->masks[slot] |= bit;
+  }
+}
+
+static inline uint64_t bitlcs_peq(struct bitlcs const *const b, wchar_t const ch) {
+  if ((uint32_t)(ch) < bitlcs_ascii) {
+    return b->ascii[ch];
+  }
+  for (size_t slot = bitlcs_slot(ch); b->keys[slot]; slot = (slot + 1) & (bitlcs_table_size - 1)) {
+    if (b->keys[slot] == ch) {
+      return b->masks[slot];
+    }
+  }
+  return 0;
+}
+
+// v is the state after the whole text of length len is processed.
+static inline int bitlcs_score(uint64_t const v, int const plen, int const len) {
+  uint64_t const mask = plen == bitlcs_max_len ? ~UINT64_C(0) : (UINT64_C(1) << plen) - 1;
+  int const lcs = __builtin_popcountll(~v & mask);
+  int const m = plen < len ? plen : len;
+  int const n = plen < len ? len : plen;
+  return (n - m) + 8 * (m - lcs);
+}
+
+static int bitlcs_distance(struct bitlcs const *const b, wchar_t const *const s, int const len) {
+  uint64_t v = ~UINT64_C(0);
+  for (int i = 0; i < len; ++i) {
+    uint64_t const u = v & bitlcs_peq(b, s[i]);
+    v = (v + u) | (v - u);
+  }
+  return bitlcs_score(v, b->len, len);
+}
+
+// The same over the alphabet codes, peq is indexed by the code directly.
+static int bitlcs_distance_code(uint64_t const *const peq, int const plen, uint8_t const *const s, int const len) {
+  uint64_t v = ~UINT64_C(0);
+  for (int i = 0; i < len; ++i) {
+    uint64_t const u = v & peq[s[i]];
+    v = (v + u) | (v - u);
+  }
+  return bitlcs_score(v, plen, len);
+}
+
+// Batch scorer.
+//
+// Runs bitlcs_distance_code for one query against the font_batch_lanes fonts of a block of
+// the batch index at once, with 16-bit lanes for queries up to font_batch_max_query codes.
+// The match mask of a lane is built by comparing its code with each distinct code of the query.
+// The padding code font_alphabet_none is never one of them, so it leaves the state of a shorter name as it is.
+// SSE2 runs the block as two vectors of 8 lanes and AVX2 as one vector of 16 lanes,
+// the kernel is chosen at run time by the features of the CPU.
+
+struct similar_batch {
+  size_t n; // distinct codes in the query
+  uint16_t code[font_batch_max_query];
+  uint16_t mask[font_batch_max_query];
+  uint16_t peq[font_alphabet_size + 1]; // mask by code for the scalar kernel
+};
+
+// Writes the state of each lane after width codes to v.
+typedef void (*similar_batch_fn)(struct similar_batch const *const b,
+                                 uint8_t const *const codes,
+                                 size_t const width,
+                                 uint16_t *const v);
+
+static void similar_batch_init(struct similar_batch *const b, uint8_t const *const code, size_t const len) {
+  b->n = 0;
+  memset(b->peq, 0, sizeof(b->peq));
+  for (size_t i = 0; i < len; ++i) {
+    if (code[i] == font_alphabet_none) {
+      continue;
+    }
+    b->peq[code[i]] |= (uint16_t)(1u << i);
+    size_t k = 0;
+    while (k < b->n && b->code[k] != code[i]) {
+      ++k;
+    }
+    if (k == b->n) {
+      b->code[b->n] = code[i];
+      b->mask[b->n++] = 0;
+    }
+    b->mask[k] |= (uint16_t)(1u << i);
+  }
+}
+
+static void similar_batch_scalar(struct similar_batch const *const b,
+                                 uint8_t const *const codes,
+                                 size_t const width,
+                                 uint16_t *const v) {
+  for (size_t lane = 0; lane < font_batch_lanes; ++lane) {
+    uint32_t x = 0xffff;
+    for (size_t pos = 0; pos < width; ++pos) {
+      uint32_t const u = x & b->peq[codes[pos * font_batch_lanes + lane]];
+      x = ((x + u) | (x - u)) & 0xffff;
+    }
+    v[lane] = (uint16_t)x;
+  }
+}
+
+#ifdef FONTLIST_X86
+__attribute__((target("sse2"))) static void similar_batch_sse2(struct similar_batch const *const b,
+                                                               uint8_t const *const codes,
+                                                               size_t const width,
+                                                               uint16_t *const v) {
+  __m128i code[font_batch_max_query], mask[font_batch_max_query];
+  for (size_t k = 0; k < b->n; ++k) {
+    code[k] = _mm_set1_epi16((short)b->code[k]);
+    mask[k] = _mm_set1_epi16((short)b->mask[k]);
+  }
+  __m128i const zero = _mm_setzero_si128();
+  __m128i v0 = _mm_set1_epi16(-1), v1 = v0;
+  for (size_t pos = 0; pos < width; ++pos) {
+    __m128i const c = _mm_loadu_si128((__m128i const *)(void const *)(codes + pos * font_batch_lanes));
+    __m128i const c0 = _mm_unpacklo_epi8(c, zero), c1 = _mm_unpackhi_epi8(c, zero);
+    __m128i p0 = zero, p1 = zero;
+    for (size_t k = 0; k < b->n; ++k) {
+      p0 = _mm_or_si128(p0, _mm_and_si128(_mm_cmpeq_epi16(c0, code[k]), mask[k]));
+      p1 = _mm_or_si128(p1, _mm_and_si128(_mm_cmpeq_epi16(c1, code[k]), mask[k]));
+    }
+    __m128i const u0 = _mm_and_si128(v0, p0), u1 = _mm_and_si128(v1, p1);
+    v0 = _mm_or_si128(_mm_add_epi16(v0, u0), _mm_sub_epi16(v0, u0));
+    v1 = _mm_or_si128(_mm_add_epi16(v1, u1), _mm_sub_epi16(v1, u1));
+  }
+  _mm_storeu_si128((__m128i *)(void *)v, v0);
+  _mm_storeu_si128((__m128i *)(void *)(v + 8), v1);
+}
+
+__attribute__((target("avx2"))) static void similar_batch_avx2(struct similar_batch const *const b,
+                                                               uint8_t const *const codes,
+                                                               size_t const width,
+                                                               uint16_t *const v) {
+  __m256i code[font_batch_max_query], mask[font_batch_max_query];
+  for (size_t k = 0; k < b->n; ++k) {
+    code[k] = _mm256_set1_epi16((short)b->code[k]);
+    mask[k] = _mm256_set1_epi16((short)b->mask[k]);
+  }
+  __m256i x = _mm256_set1_epi16(-1);
+  for (size_t pos = 0; pos < width; ++pos) {
+    __m256i const c =
+        _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i const *)(void const *)(codes + pos * font_batch_lanes)));
+    __m256i p = _mm256_setzero_si256();
+    for (size_t k = 0; k < b->n; ++k) {
+      p = _mm256_or_si256(p, _mm256_and_si256(_mm256_cmpeq_epi16(c, code[k]), mask[k]));
+    }
+    __m256i const u = _mm256_and_si256(x, p);
+    x = _mm256_or_si256(_mm256_add_epi16(x, u), _mm256_sub_epi16(x, u));
+  }
+  _mm256_storeu_si256((__m256i *)(void *)v, x);
+}
+#endif
+
+static similar_batch_fn similar_batch_select(void) {
+#ifdef FONTLIST_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return similar_batch_avx2;
+  }
+  if (__builtin_cpu_supports("sse2")) {
+    return similar_batch_sse2;
+  }
+#endif
+  return similar_batch_scalar;
+}
+
+// Returns true if x should be ranked before y.
+static inline bool similar_better(struct font_similar const x, struct font_similar const y) {
+  return x.score < y.score || (x.score == y.score && x.idx < y.idx);
+}
+
+// heap is a max-heap ordered by similar_better, so the root is the worst entry.
+static void similar_heap_sift_down(struct font_similar *const heap, size_t const n, size_t i) {
+  struct font_similar const v = heap[i];
+  for (size_t c = i * 2 + 1; c < n; i = c, c = i * 2 + 1) {
+    if (c + 1 < n && similar_better(heap[c], heap[c + 1])) {
+      ++c;
+    }
+    if (!similar_better(v, heap[c])) {
+      break;
+    }
+    heap[i] = heap[c];
+  }
+  heap[i] = v;
+}
+
+static void similar_heap_push(struct font_similar *const heap, size_t const n, struct font_similar const v) {
+  size_t i = n;
+  while (i > 0) {
+    size_t const parent = (i - 1) / 2;
+    if (!similar_better(heap[parent], v)) {
+      break;
+    }
+    heap[i] = heap[parent];
+    i = parent;
+  }
+  heap[i] = v;
+}
+
+enum {
+  similar_query_buffer_len = 256,
+};
+
+struct similar_query {
+  wchar_t buf[similar_query_buffer_len];
+  wchar_t *sn;
+  size_t snlen;
+  uint64_t signature;
+  struct bitlcs bitlcs;
+  // The query in the alphabet codes of the font list, see similar_query_encode.
+  // The code units that are not in the alphabet become font_alphabet_none, which matches nothing.
+  uint8_t codebuf[similar_query_buffer_len];
+  uint8_t *code;
+  uint64_t code_peq[font_alphabet_none + 1];
+  // NULL if the query is too long for the batch scorer.
+  similar_batch_fn batch_fn;
+  struct similar_batch batch;
+  struct diff diff;
+  // Candidates are visited in ascending order, so decoding mostly continues from the previous one.
+  struct font_dict_cursor cursor;
+  // If set, receives the score or a lower bound of the score of each visited font, see font_get_similar_cached.
+  uint16_t *bounds;
+  // Unless refine_limit is INT_MAX, bounds holds the bounds for a prefix of the query, and the fonts whose bound
+  // minus refine_drop is above refine_limit are skipped.
+  int refine_drop;
+  int refine_limit;
+  // The scores above it can not enter the top k, INT_MAX if unknown. Set from the preferred fonts.
+  int seed_limit;
+  // Optional, the scans stop when it is requested.
+  struct font_similar_cancel const *cancel;
+};
+
+// Queries up to bitlcs_max_len code units are handled without any heap allocation.
+// Longer queries fall back to diff_distance, which needs a heap buffer.
+static bool similar_query_init(struct similar_query *const q, wchar_t const *const s) {
+  q->sn = NULL;
+  q->code = NULL;
+  q->batch_fn = NULL;
+  q->diff = (struct diff){0};
+  q->cursor.next = 0;
+  q->bounds = NULL;
+  q->refine_limit = INT_MAX;
+  q->seed_limit = INT_MAX;
+  q->cancel = NULL;
+
+  // make normalized input
+  size_t const slen = wcslen(s);
+  size_t snormlen = nfkc(s, slen, q->buf, similar_query_buffer_len - 1);
+  if (snormlen == 0) {
+    ods(L"failed to normalize the query");
+    return false;
+  }
+  if (snormlen < similar_query_buffer_len) {
+    q->sn = q->buf;
+  } else {
+    q->sn = realloc(NULL, (size_t)(snormlen + 1) * sizeof(wchar_t));
+    if (!q->sn) {
+      ods(L"failed to allocate memory");
+      return false;
+    }
+    snormlen = nfkc(s, slen, q->sn, snormlen);
+    if (snormlen == 0) {
+      ods(L"failed to normalize the query");
+      goto failed;
+    }
+  }
+  q->sn[snormlen] = L'\0';
+  extended_normalize(q->sn, snormlen);
+  q->snlen = snormlen;
+  q->signature = signature_string(q->sn, snormlen);
+
+  if (snormlen <= bitlcs_max_len) {
+    bitlcs_init(&q->bitlcs, q->sn, (int)snormlen);
+  } else {
+    q->diff.fpbuflen = 128;
+    q->diff.fpbuf = realloc(NULL, (size_t)(q->diff.fpbuflen) * sizeof(int));
+    if (!q->diff.fpbuf) {
+      ods(L"failed to allocate memory");
+      goto failed;
+    }
+  }
+  return true;
+
+failed:
+  if (q->sn != q->buf) {
+    free(q->sn);
+  }
+  q->sn = NULL;
+  return false;
+}
+
+// Codes the query by the alphabet of fl so that the coded names can be scored by similar_query_score_code.
+static bool similar_query_encode(struct similar_query *const q, struct font_list const *const fl) {
+  if (q->snlen < similar_query_buffer_len) {
+    q->code = q->codebuf;
+  } else {
+    q->code = realloc(NULL, q->snlen);
+    if (!q->code) {
+      ods(L"failed to allocate memory");
+      return false;
+    }
+  }
+  (void)font_alphabet_encode(fl->alphabet, fl->alphabet_len, q->sn, q->snlen, q->code);
+  if (q->snlen <= bitlcs_max_len) {
+    memset(q->code_peq, 0, sizeof(q->code_peq));
+    for (size_t i = 0; i < q->snlen; ++i) {
+      q->code_peq[q->code[i]] |= UINT64_C(1) << i;
+    }
+    q->code_peq[font_alphabet_none] = 0;
+  }
+  if (q->snlen <= font_batch_max_query && fl->batch.offsets) {
+    similar_batch_init(&q->batch, q->code, q->snlen);
+    q->batch_fn = similar_batch_select();
+  }
+  return true;
+}
+
+static void similar_query_free(struct similar_query *const q) {
+  if (q->code && q->code != q->codebuf) {
+    free(q->code);
+  }
+  q->code = NULL;
+  if (q->diff.fpbuf) {
+    free(q->diff.fpbuf);
+    q->diff.fpbuf = NULL;
+  }
+  if (q->sn && q->sn != q->buf) {
+    free(q->sn);
+  }
+  q->sn = NULL;
+}
+
+// Returns a lower bound of the score between a and b.
+// The LCS can not contain the characters which are only in one side of signatures,
+// and each distinct bit in the signature stands for at least one such character.
+static int similar_lower_bound(uint64_t const asig, int const alen, uint64_t const bsig, int const blen) {
+  int const a = alen - __builtin_popcountll(asig & ~bsig);
+  int const b = blen - __builtin_popcountll(bsig & ~asig);
+  int const m = alen < blen ? alen : blen;
+  int const n = alen < blen ? blen : alen;
+  int const lcs = a < b ? a : b;
+  return (n - m) + 8 * (m - lcs);
+}
+
+// Returns -1 on failure.
+// If the score exceeds limit, a value greater than limit might be returned instead of the exact score.
+static int similar_query_score(struct similar_query *const q,
+                               wchar_t const *const norm,
+                               size_t const normlen,
+                               int const limit) {
+  if (q->snlen <= bitlcs_max_len) {
+    return bitlcs_distance(&q->bitlcs, norm, (int)normlen);
+  }
+  diff_init(&q->diff, q->sn, (int)q->snlen, norm, (int)normlen);
+  return diff_distance(&q->diff, limit);
+}
+
+// The same as similar_query_score for a normalized name in the alphabet codes.
+static int similar_query_score_code(struct similar_query *const q,
+                                    uint8_t const *const code,
+                                    size_t const normlen,
+                                    int const limit) {
+  if (q->snlen <= bitlcs_max_len) {
+    return bitlcs_distance_code(q->code_peq, (int)q->snlen, code, (int)normlen);
+  }
+  diff_init_code(&q->diff, q->code, (int)q->snlen, code, (int)normlen);
+  return diff_distance(&q->diff, limit);
+}
+
+struct qgram_cursor {
+  uint8_t const *p;
+  uint32_t remain;
+  uint32_t idx;
+};
+
+// Merges the posting lists of the distinct bigrams in the query in ascending order of the font index.
+struct qgram_merge {
+  struct qgram_cursor cursors[bitlcs_max_len];
+  size_t heap[bitlcs_max_len];
+  size_t n;
+  size_t postings; // total length of the posting lists
+};
+
+static inline bool qgram_cursor_advance(struct qgram_cursor *const c) {
+  if (!c->remain) {
+    return false;
+  }
+  c->idx += varint_read(&c->p);
+  --c->remain;
+  return true;
+}
+
+static void qgram_merge_sift_down(struct qgram_merge *const m, size_t i) {
+  size_t const v = m->heap[i];
+  for (size_t c = i * 2 + 1; c < m->n; i = c, c = i * 2 + 1) {
+    if (c + 1 < m->n && m->cursors[m->heap[c + 1]].idx < m->cursors[m->heap[c]].idx) {
+      ++c;
+    }
+    if (m->cursors[v].idx <= m->cursors[m->heap[c]].idx) {
+      break;
+    }
+    m->heap[i] = m->heap[c];
+  }
+  m->heap[i] = v;
+}
+
+// Bigrams whose posting list is longer than max_postings are too common to narrow down the candidates,
+// so they are not merged.
+static void qgram_merge_init(struct qgram_merge *const m,
+                             struct font_qgram_index const *const ix,
+                             wchar_t const *const s,
+                             size_t const len,
+                             size_t const max_postings) {
+  uint32_t keys[bitlcs_max_len];
+  size_t nkeys = 0;
+  m->n = 0;
+  m->postings = 0;
+  for (size_t i = 1; i < len && nkeys < bitlcs_max_len; ++i) {
+    uint32_t const key = qgram_key(s[i - 1], s[i]);
+    bool dup = false;
+    for (size_t j = 0; j < nkeys && !dup; ++j) {
+      dup = keys[j] == key;
+    }
+    if (dup) {
+      continue;
+    }
+    keys[nkeys++] = key;
+    for (size_t slot = qgram_slot(key) & ix->mask; ix->offsets[slot] != UINT32_MAX; slot = (slot + 1) & ix->mask) {
+      if (ix->keys[slot] != key) {
+        continue;
+      }
+      struct qgram_cursor *const c = &m->cursors[m->n];
+      c->p = ix->postings + ix->offsets[slot];
+      c->remain = varint_read(&c->p);
+      c->idx = 0;
+      if (c->remain > max_postings) {
+        break;
+      }
+      m->postings += c->remain;
+      if (qgram_cursor_advance(c)) {
+        m->heap[m->n] = m->n;
+        ++m->n;
+      }
+      break;
+    }
+  }
+  for (size_t i = m->n / 2; i > 0; --i) {
+    qgram_merge_sift_down(m, i - 1);
+  }
+}
+
+// Returns the next font index which shares at least one bigram with the query.
+// count receives the number of shared bigrams.
+static bool qgram_merge_next(struct qgram_merge *const m, uint32_t *const idx, uint32_t *const count) {
+  if (!m->n) {
+    return false;
+  }
+  uint32_t const v = m->cursors[m->heap[0]].idx;
+  uint32_t c = 0;
+  while (m->n && m->cursors[m->heap[0]].idx == v) {
+    ++c;
+    if (!qgram_cursor_advance(&m->cursors[m->heap[0]])) {
+      m->heap[0] = m->heap[--m->n];
+    }
+    if (m->n) {
+      qgram_merge_sift_down(m, 0);
+    }
+  }
+  *idx = v;
+  *count = c;
+  return true;
+}
+
+// Keeps v if it is one of the k best entries so far.
+static void similar_topk_push(size_t const k,
+                              struct font_similar *const out,
+                              size_t *const n,
+                              struct font_similar const v) {
+  if (*n < k) {
+    similar_heap_push(out, (*n)++, v);
+    return;
+  }
+  if (similar_better(v, out[0])) {
+    out[0] = v;
+    similar_heap_sift_down(out, *n, 0);
+  }
+}
+
+// Returns the highest score that can still enter the heap of n of k entries.
+static inline int similar_topk_limit(struct similar_query const *const q,
+                                     size_t const k,
+                                     struct font_similar const *const out,
+                                     size_t const n) {
+  if (n < k) {
+    return q->seed_limit;
+  }
+  // Fonts are visited in the order of idx, so once the heap is full, a candidate wins only if
+  // its score is strictly lower than the worst one.
+  int const worst = out[0].score - 1;
+  return worst < q->seed_limit ? worst : q->seed_limit;
+}
 
-  diff.fpbuflen = 128;
-  diff.fpbuf = realloc(NULL, (size_t)(diff.fpbuflen) * sizeof(int));
-  if (!diff.fpbuf) {
-    ods(L"failed to allocate memory");
-    goto failed;
+// Returns false on failure.
+static inline void similar_query_set_bound(struct similar_query *const q, size_t const i, int const bound) {
+  if (q->bounds) {
+    q->bounds[i] = (uint16_t)(bound < UINT16_MAX ? bound : UINT16_MAX);
   }
+}
 
-  sim = realloc(NULL, (size_t)(fl->num) * sizeof(struct font_similar));
-  if (!sim) {
+// Returns the score of the i-th font, or a value above limit that does not exceed it, -1 on failure.
+static int similar_query_score_font(struct similar_query *const q,
+                                    struct font_list const *const fl,
+                                    size_t const i,
+                                    int const limit) {
+  struct font_dict_cursor *const c = &q->cursor;
+  font_dict_cursor_seek(c, fl, i);
+  return c->narrow ? similar_query_score_code(q, c->code, c->normlen, limit)
+                   : similar_query_score(q, c->norm, c->normlen, limit);
+}
+
+// Returns true if the font is skipped by its bound for the previous query, whose bound is then updated.
+static inline bool similar_query_skip(struct similar_query *const q,
+                                      size_t const i,
+                                      struct font_similar_stats *const st) {
+  if (q->refine_limit == INT_MAX) {
+    return false;
+  }
+  int const bound = q->bounds[i] > q->refine_drop ? q->bounds[i] - q->refine_drop : 0;
+  if (bound <= q->refine_limit) {
+    return false;
+  }
+  q->bounds[i] = (uint16_t)bound;
+  ++st->pruned;
+  return true;
+}
+
+static bool similar_topk_add(struct font_list const *const fl,
+                             struct similar_query *const q,
+                             size_t const i,
+                             size_t const k,
+                             struct font_similar *const out,
+                             size_t *const n,
+                             struct font_similar_stats *const st) {
+  if (similar_query_skip(q, i, st)) {
+    return true;
+  }
+  int const limit = similar_topk_limit(q, k, out, *n);
+  if (limit != INT_MAX) {
+    int const bound = similar_lower_bound(q->signature, (int)q->snlen, fl->signature[i], (int)fl->normlen[i]);
+    if (bound > limit) {
+      similar_query_set_bound(q, i, bound);
+      ++st->pruned;
+      return true;
+    }
+  }
+  struct font_similar const v = {
+      .idx = (int)i,
+      .score = similar_query_score_font(q, fl, i, limit),
+  };
+  if (v.score == -1) {
+    ods(L"failed to expand temporary buffer");
+    return false;
+  }
+  ++st->scored;
+  // diff_distance stops at a value above limit that does not exceed the score, which is still a lower bound.
+  similar_query_set_bound(q, i, v.score);
+  if (v.score > limit) {
+    return true;
+  }
+  similar_topk_push(k, out, n, v);
+  return true;
+}
+
+// Adds the fonts of the block b of the batch index.
+// The lanes that survive the lower bound are scored by the batch scorer at once,
+// the fonts that are not coded by the alphabet go through similar_topk_add.
+static bool similar_topk_add_block(struct font_list const *const fl,
+                                   struct similar_query *const q,
+                                   size_t const b,
+                                   size_t const k,
+                                   struct font_similar *const out,
+                                   size_t *const n,
+                                   struct font_similar_stats *const st) {
+  size_t const first = b * font_batch_lanes;
+  size_t const lanes = fl->num - first < font_batch_lanes ? fl->num - first : font_batch_lanes;
+  int const limit = similar_topk_limit(q, k, out, *n);
+  uint32_t todo = 0;
+  for (size_t lane = 0; lane < lanes; ++lane) {
+    size_t const i = first + lane;
+    if (fl->batch.wide[b] & (1u << lane)) {
+      if (!similar_topk_add(fl, q, i, k, out, n, st)) {
+        return false;
+      }
+      continue;
+    }
+    if (similar_query_skip(q, i, st)) {
+      continue;
+    }
+    int const bound = limit == INT_MAX
+                          ? 0
+                          : similar_lower_bound(q->signature, (int)q->snlen, fl->signature[i], (int)fl->normlen[i]);
+    if (bound > limit) {
+      similar_query_set_bound(q, i, bound);
+      ++st->pruned;
+    } else {
+      todo |= 1u << lane;
+    }
+  }
+  if (!todo) {
+    return true;
+  }
+  uint16_t v[font_batch_lanes];
+  uint32_t const offset = fl->batch.offsets[b];
+  q->batch_fn(&q->batch, fl->batch.codes + offset, (fl->batch.offsets[b + 1] - offset) / font_batch_lanes, v);
+  for (; todo; todo &= todo - 1) {
+    size_t const lane = (size_t)__builtin_ctz(todo);
+    size_t const i = first + lane;
+    struct font_similar const s = {
+        .idx = (int)i,
+        .score = bitlcs_score(v[lane], (int)q->snlen, (int)fl->normlen[i]),
+    };
+    ++st->scored;
+    similar_query_set_bound(q, i, s.score);
+    if (s.score <= limit) {
+      similar_topk_push(k, out, n, s);
+    }
+  }
+  return true;
+}
+
+// Adds the fonts of the blocks first..last to the heap, by the batch scorer if the query supports it.
+// Checked once per block, so a cancelled scan stops after at most font_batch_lanes more fonts.
+static inline bool similar_query_cancelled(struct similar_query const *const q) {
+  return q->cancel && q->cancel->requested;
+}
+
+static bool similar_topk_add_range(struct font_list const *const fl,
+                                   struct similar_query *const q,
+                                   size_t const first,
+                                   size_t const last,
+                                   size_t const k,
+                                   struct font_similar *const out,
+                                   size_t *const n,
+                                   struct font_similar_stats *const st) {
+  if (q->batch_fn) {
+    for (size_t b = first; b < last; ++b) {
+      if (similar_query_cancelled(q) || !similar_topk_add_block(fl, q, b, k, out, n, st)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  size_t const end = last * font_batch_lanes < fl->num ? last * font_batch_lanes : fl->num;
+  for (size_t i = first * font_batch_lanes; i < end; ++i) {
+    if ((i % font_batch_lanes == 0 && similar_query_cancelled(q)) || !similar_topk_add(fl, q, i, k, out, n, st)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// The full scan of a large list is split into ranges of whole blocks that run on fl->pool.
+// Each range has its own heap and scratch buffers, and the heaps are merged after all ranges are done.
+struct similar_scan_range {
+  size_t first, last;
+  size_t k, n;
+  struct font_similar *out;
+  struct font_similar_stats st;
+  bool ok;
+};
+
+struct similar_scan {
+  struct font_list const *fl;
+  struct similar_query const *q;
+  struct similar_scan_range *ranges;
+};
+
+static size_t similar_scan_range_count(struct font_list const *const fl) {
+  size_t const threads = thread_pool_threads(fl->pool);
+  size_t const ranges = fl->num / font_similar_chunk_min;
+  return fl->pool && ranges > 1 ? (threads < ranges ? threads : ranges) : 1;
+}
+
+static void similar_scan_task(void *const userdata, size_t const idx) {
+  struct similar_scan const *const s = userdata;
+  struct similar_scan_range *const r = &s->ranges[idx];
+  // The copy refers to the normalized and coded query of the caller, so it must not be passed to similar_query_free.
+  struct similar_query q = *s->q;
+  q.diff = (struct diff){0};
+  q.cursor.next = 0;
+  r->ok = similar_topk_add_range(s->fl, &q, r->first, r->last, r->k, r->out, &r->n, &r->st);
+  if (q.diff.fpbuf) {
+    free(q.diff.fpbuf);
+  }
+}
+
+static bool similar_scan_parallel(struct font_list const *const fl,
+                                  struct similar_query const *const q,
+                                  size_t const nranges,
+                                  size_t const k,
+                                  struct font_similar *const out,
+                                  size_t *const n,
+                                  struct font_similar_stats *const st) {
+  bool ret = false;
+  struct similar_scan_range ranges[font_similar_max_threads] = {0};
+  struct font_similar *buf = NULL;
+  size_t const nblocks = font_batch_num_blocks(fl->num);
+  size_t total = 0;
+  for (size_t i = 0; i < nranges; ++i) {
+    struct similar_scan_range *const r = &ranges[i];
+    r->first = nblocks * i / nranges;
+    r->last = nblocks * (i + 1) / nranges;
+    size_t const end = r->last * font_batch_lanes < fl->num ? r->last * font_batch_lanes : fl->num;
+    size_t const fonts = end - r->first * font_batch_lanes;
+    r->k = k < fonts ? k : fonts;
+    total += r->k;
+  }
+  buf = realloc(NULL, total * sizeof(struct font_similar));
+  if (!buf) {
     ods(L"failed to allocate memory");
-    goto failed;
+    goto cleanup;
   }
-  for (size_t i = 0; i < fl->num; ++i) {
-    diff_init(&diff, sn, fl->sorted[i] + wcslen(fl->sorted[i]) + 1);
-    sim[i].idx = (int)i;
-    sim[i].score = diff_distance(&diff);
-    if (sim[i].score == -1) {
+  total = 0;
+  for (size_t i = 0; i < nranges; ++i) {
+    ranges[i].out = buf + total;
+    total += ranges[i].k;
+  }
+  struct similar_scan s = {
+      .fl = fl,
+      .q = q,
+      .ranges = ranges,
+  };
+  thread_pool_run(fl->pool, similar_scan_task, &s, nranges);
+  for (size_t i = 0; i < nranges; ++i) {
+    struct similar_scan_range const *const r = &ranges[i];
+    if (!r->ok) {
+      goto cleanup;
+    }
+    st->scored += r->st.scored;
+    st->pruned += r->st.pruned;
+    for (size_t j = 0; j < r->n; ++j) {
+      similar_topk_push(k, out, n, r->out[j]);
+    }
+  }
+  ret = true;
+
+cleanup:
+  if (buf) {
+    free(buf);
+  }
+  return ret;
+}
+
+// heap sort, the best entry comes first.
+static void similar_heap_sort(struct font_similar *const heap, size_t const n) {
+  for (size_t i = n; i > 1; --i) {
+    struct font_similar const v = heap[0];
+    heap[0] = heap[i - 1];
+    heap[i - 1] = v;
+    similar_heap_sift_down(heap, i - 1, 0);
+  }
+}
+
+// Adds all fonts to the heap, on the workers of fl->pool if the list is large enough.
+static bool similar_topk_scan(struct font_list const *const fl,
+                              struct similar_query *const q,
+                              size_t const k,
+                              struct font_similar *const out,
+                              size_t *const n,
+                              struct font_similar_stats *const st) {
+  size_t const nranges = similar_scan_range_count(fl);
+  return nranges > 1 ? similar_scan_parallel(fl, q, nranges, k, out, n, st)
+                     : similar_topk_add_range(fl, q, 0, font_batch_num_blocks(fl->num), k, out, n, st);
+}
+
+// Writes at most k entries of the most similar fonts for the encoded query to out, see font_get_similar_topk.
+static size_t similar_topk_query(struct font_list const *const fl,
+                                 struct similar_query *const q,
+                                 size_t const k,
+                                 struct font_similar *const out,
+                                 struct font_similar_stats *const st) {
+  size_t n = 0;
+  int const seed_limit = q->seed_limit;
+  // The fonts that share enough uncommon bigrams with the query are scored first. They are usually the most similar
+  // ones, so their k-th score seeds the limit of the full scan, which then rejects most of the other fonts by the
+  // lower bound without scoring them. A font can be more similar without sharing any bigram, so the scan is still
+  // needed. Scoring the candidates one by one is slower than the batch scorer of the scan, so they are capped at
+  // 1/32 of the fonts, and when the posting lists are longer than half of the fonts, merging them costs more than it
+  // saves.
+  if (k < fl->num && q->snlen >= 2 && q->snlen <= bitlcs_max_len && fl->qgram.keys) {
+    struct qgram_merge m;
+    qgram_merge_init(&m, &fl->qgram, q->sn, q->snlen, fl->num / 16);
+    uint32_t const threshold = (uint32_t)(1 + m.n / 4);
+    uint32_t idx, count;
+    size_t const max_candidates = fl->num / 32 > k ? fl->num / 32 : k;
+    while (m.postings <= fl->num / 2 && st->candidates < max_candidates && qgram_merge_next(&m, &idx, &count)) {
+      if (count < threshold) {
+        continue;
+      }
+      ++st->candidates;
+      if ((st->candidates % font_batch_lanes == 0 && similar_query_cancelled(q)) ||
+          !similar_topk_add(fl, q, idx, k, out, &n, st)) {
+        return 0;
+      }
+    }
+    if (n == k && out[0].score < q->seed_limit) {
+      q->seed_limit = out[0].score;
+    }
+    n = 0;
+  }
+  bool const ok = similar_topk_scan(fl, q, k, out, &n, st);
+  q->seed_limit = seed_limit;
+  if (!ok) {
+    return 0;
+  }
+  similar_heap_sort(out, n);
+  return n;
+}
+
+size_t font_get_similar_topk(struct font_list const *const fl,
+                             wchar_t const *const s,
+                             size_t const k,
+                             struct font_similar *const out,
+                             struct font_similar_stats *const stats) {
+  if (!fl || !s || !fl->num || !fl->text || !k || !out) {
+    ods(L"invalid parameter");
+    return 0;
+  }
+  struct similar_query q;
+  if (!similar_query_init(&q, s)) {
+    return 0;
+  }
+  struct font_similar_stats st = {0};
+  size_t const n = similar_query_encode(&q, fl) ? similar_topk_query(fl, &q, k, out, &st) : 0;
+  similar_query_free(&q);
+  if (stats) {
+    *stats = st;
+  }
+  return n;
+}
+
+enum {
+  // A code unit appended to the query extends its LCS with a name by at most one, which lowers the score by one
+  // while the query is shorter than the name and by 8 - 1 after that, see bitlcs_score.
+  similar_score_append_drop = 7,
+};
+
+// Rescores the fonts for the query, which extends the query of the cache, and writes the top k to cache->entries.
+// The previous top entries give an upper bound of the new k-th score, and the fonts whose bound for the previous query
+// minus the most that the appended code units can lower it is above that are skipped.
+static size_t similar_cache_refine(struct font_list const *const fl,
+                                   struct font_similar_cache *const cache,
+                                   struct similar_query *const q,
+                                   size_t const k,
+                                   struct font_similar_stats *const st) {
+  int const drop = (int)(q->snlen - cache->querylen) * similar_score_append_drop;
+  int threshold = INT_MAX;
+  if (cache->num >= k) {
+    int scores[font_similar_cache_size];
+    for (size_t i = 0; i < cache->num; ++i) {
+      int const score = similar_query_score_font(q, fl, (size_t)cache->entries[i].idx, INT_MAX);
+      if (score == -1) {
+        ods(L"failed to expand temporary buffer");
+        return 0;
+      }
+      size_t j = i;
+      for (; j > 0 && scores[j - 1] > score; --j) {
+        scores[j] = scores[j - 1];
+      }
+      scores[j] = score;
+    }
+    threshold = scores[k - 1];
+    q->cursor.next = 0;
+  }
+  q->refine_drop = drop;
+  q->refine_limit = threshold;
+  size_t n = 0;
+  if (!similar_topk_scan(fl, q, k, cache->entries, &n, st)) {
+    return 0;
+  }
+  similar_heap_sort(cache->entries, n);
+  return n;
+}
+
+// Returns the recent entry of the query, or NULL. The entries of another font list are dropped first.
+static struct font_similar_recent *similar_recent_find(struct font_similar_cache *const cache,
+                                                       struct font_list const *const fl,
+                                                       wchar_t const *const sn,
+                                                       size_t const snlen) {
+  if (cache->recent_generation != fl->generation) {
+    for (size_t i = 0; i < font_similar_recent_size; ++i) {
+      cache->recent[i].used = 0;
+    }
+    cache->recent_generation = fl->generation;
+  }
+  for (size_t i = 0; i < font_similar_recent_size; ++i) {
+    struct font_similar_recent *const r = &cache->recent[i];
+    if (r->used && r->querylen == snlen && wmemcmp(r->query, sn, snlen) == 0) {
+      return r;
+    }
+  }
+  return NULL;
+}
+
+static inline uint32_t similar_recent_tick(struct font_similar_cache *const cache) {
+  if (++cache->clock == 0) {
+    // Wrapped around, which only makes the order of the current entries arbitrary.
+    for (size_t i = 0; i < font_similar_recent_size; ++i) {
+      if (cache->recent[i].used) {
+        cache->recent[i].used = 1;
+      }
+    }
+    cache->clock = 2;
+  }
+  return cache->clock;
+}
+
+// Keeps the top entries of the query in place of the least recently used one.
+static void similar_recent_put(struct font_similar_cache *const cache,
+                               struct font_list const *const fl,
+                               wchar_t const *const sn,
+                               size_t const snlen,
+                               struct font_similar const *const entries,
+                               size_t const n) {
+  struct font_similar_recent *r = similar_recent_find(cache, fl, sn, snlen);
+  if (!r) {
+    r = &cache->recent[0];
+    for (size_t i = 1; i < font_similar_recent_size && r->used; ++i) {
+      if (cache->recent[i].used < r->used) {
+        r = &cache->recent[i];
+      }
+    }
+  }
+  wmemcpy(r->query, sn, snlen);
+  r->querylen = snlen;
+  r->num = n < font_similar_recent_topk ? n : font_similar_recent_topk;
+  memcpy(r->entries, entries, r->num * sizeof(struct font_similar));
+  r->used = similar_recent_tick(cache);
+}
+
+// Returns the position of idx in preferred, or font_similar_preferred_max if it is not there.
+static size_t similar_preferred_rank(struct font_similar_preferred const *const preferred, int const idx) {
+  for (size_t i = 0; i < preferred->num; ++i) {
+    if (preferred->idx[i] == idx) {
+      return i;
+    }
+  }
+  return font_similar_preferred_max;
+}
+
+// Scores the preferred fonts for the query and writes them to out ordered by similar_better.
+// Returns the number of entries, or SIZE_MAX on failure.
+static size_t similar_score_preferred(struct font_list const *const fl,
+                                      struct similar_query *const q,
+                                      struct font_similar_preferred const *const preferred,
+                                      struct font_similar *const out) {
+  size_t n = 0;
+  size_t const num = preferred->num < font_similar_preferred_max ? preferred->num : font_similar_preferred_max;
+  for (size_t i = 0; i < num; ++i) {
+    int const idx = preferred->idx[i];
+    if (idx < 0 || (size_t)idx >= fl->num || similar_preferred_rank(preferred, idx) != i) {
+      continue;
+    }
+    struct font_similar const v = {
+        .idx = idx,
+        .score = similar_query_score_font(q, fl, (size_t)idx, INT_MAX),
+    };
+    if (v.score == -1) {
       ods(L"failed to expand temporary buffer");
-      goto failed;
+      return SIZE_MAX;
     }
+    size_t j = n++;
+    for (; j > 0 && similar_better(v, out[j - 1]); --j) {
+      out[j] = out[j - 1];
+    }
+    out[j] = v;
   }
-  qsort(sim, (size_t)fl->num, sizeof(struct font_similar), compare_distance);
-  free(diff.fpbuf);
-  free(sn);
-  return sim;
+  q->cursor.next = 0;
+  return n;
+}
 
-failed:
-  if (diff.fpbuf) {
-    free(diff.fpbuf);
-    diff.fpbuf = NULL;
+// Merges the scored preferred fonts into the n entries of out, which are the top entries of the query,
+// and keeps the first k ordered by the score, then by the rank in preferred. Returns the number of entries.
+// A preferred font that ties with the last entry of out takes its place.
+static size_t similar_merge_preferred(struct font_similar_preferred const *const preferred,
+                                      struct font_similar const *const scored,
+                                      size_t const nscored,
+                                      size_t const k,
+                                      struct font_similar *const out,
+                                      size_t const n) {
+  struct font_similar buf[font_similar_cache_size + font_similar_preferred_max];
+  size_t rank[font_similar_cache_size + font_similar_preferred_max];
+  size_t num = 0;
+  for (size_t i = 0; i < n + nscored; ++i) {
+    struct font_similar const v = i < n ? out[i] : scored[i - n];
+    size_t j = 0;
+    while (j < num && buf[j].idx != v.idx) {
+      ++j;
+    }
+    if (j < num) {
+      continue;
+    }
+    size_t const r = similar_preferred_rank(preferred, v.idx);
+    for (j = num++; j > 0 && (buf[j - 1].score > v.score || (buf[j - 1].score == v.score && rank[j - 1] > r));
+         --j) {
+      buf[j] = buf[j - 1];
+      rank[j] = rank[j - 1];
+    }
+    buf[j] = v;
+    rank[j] = r;
+  }
+  num = num < k ? num : k;
+  memcpy(out, buf, num * sizeof(struct font_similar));
+  return num;
+}
+
+size_t font_get_similar_cached(struct font_list const *const fl,
+                               struct font_similar_cache *const cache,
+                               wchar_t const *const s,
+                               size_t const k,
+                               struct font_similar *const out,
+                               struct font_similar_stats *const stats,
+                               struct font_similar_cancel const *const cancel,
+                               struct font_similar_preferred const *const preferred) {
+  if (!fl || !cache || !s || !fl->num || !fl->text || !k || k > font_similar_cache_size || !out) {
+    ods(L"invalid parameter");
+    return 0;
+  }
+  struct similar_query q;
+  if (!similar_query_init(&q, s)) {
+    return 0;
+  }
+  q.cancel = cancel;
+  struct font_similar_stats st = {0};
+  size_t n = 0;
+  size_t const want = k < fl->num ? k : fl->num;
+  struct font_similar scored[font_similar_preferred_max];
+  size_t nscored = 0;
+  if (!similar_query_encode(&q, fl)) {
+    goto cleanup;
+  }
+  if (preferred) {
+    nscored = similar_score_preferred(fl, &q, preferred, scored);
+    if (nscored == SIZE_MAX) {
+      goto cleanup;
+    }
+    if (nscored >= want) {
+      q.seed_limit = scored[want - 1].score;
+    }
+  }
+  bool const same_list = cache->generation && cache->generation == fl->generation;
+  if (same_list && q.snlen == cache->querylen && wmemcmp(q.sn, cache->query, q.snlen) == 0 && want <= cache->num) {
+    ++cache->hits;
+    memcpy(out, cache->entries, want * sizeof(struct font_similar));
+    n = want;
+    goto prefer;
+  }
+  if (q.snlen <= font_similar_cache_query_len) {
+    struct font_similar_recent *const r = similar_recent_find(cache, fl, q.sn, q.snlen);
+    if (r && want <= r->num) {
+      ++cache->recent_hits;
+      r->used = similar_recent_tick(cache);
+      memcpy(out, r->entries, want * sizeof(struct font_similar));
+      n = want;
+      goto prefer;
+    }
+  }
+  if (q.snlen > font_similar_cache_query_len) {
+    ++cache->misses;
+    cache->generation = 0;
+    n = similar_topk_query(fl, &q, k, out, &st);
+    goto prefer;
+  }
+  if (cache->bounds_len < fl->num) {
+    cache->generation = 0;
+    if (!my_realloc(&cache->bounds, fl->num * sizeof(uint16_t))) {
+      ods(L"failed to allocate memory");
+      cache->bounds_len = 0;
+      goto cleanup;
+    }
+    cache->bounds_len = fl->num;
+  }
+  q.bounds = cache->bounds;
+  bool const refine = same_list && q.snlen > cache->querylen && wmemcmp(q.sn, cache->query, cache->querylen) == 0;
+  // The bounds are overwritten from here, the cache is valid again only after all fonts are visited.
+  cache->generation = 0;
+  if (refine) {
+    ++cache->refines;
+    cache->num = similar_cache_refine(fl, cache, &q, want, &st);
+  } else {
+    // The bigram candidates only seed the limit of the full scan, which still gives every font its bound.
+    ++cache->misses;
+    cache->num = similar_topk_query(fl, &q, want, cache->entries, &st);
+  }
+  if (!cache->num) {
+    goto cleanup;
+  }
+  wmemcpy(cache->query, q.sn, q.snlen);
+  cache->querylen = q.snlen;
+  cache->generation = fl->generation;
+  similar_recent_put(cache, fl, q.sn, q.snlen, cache->entries, cache->num);
+  memcpy(out, cache->entries, cache->num * sizeof(struct font_similar));
+  n = cache->num;
+
+prefer:
+  if (n && nscored) {
+    n = similar_merge_preferred(preferred, scored, nscored, want, out, n);
+  }
+
+cleanup:
+  similar_query_free(&q);
+  if (stats) {
+    *stats = st;
+  }
+  return n;
+}
+
+void font_similar_cache_free(struct font_similar_cache *const cache) {
+  if (!cache) {
+    return;
+  }
+  if (cache->bounds) {
+    free(cache->bounds);
+  }
+  *cache = (struct font_similar_cache){0};
+}
+
+struct font_similar *font_get_similar(struct font_list const *const fl, wchar_t const *const s) {
+  return font_get_similar_ranked(fl, s, NULL, NULL);
+}
+
+// Moves the preferred fonts to the front of each run of the same score in the ranking, ordered by their rank,
+// which is the order of similar_merge_preferred.
+static void similar_prefer_ties(struct font_similar_preferred const *const preferred,
+                                struct font_similar *const sim,
+                                size_t const n) {
+  size_t const num = preferred->num < font_similar_preferred_max ? preferred->num : font_similar_preferred_max;
+  size_t last = 0;
+  for (size_t first = 0; first < n; first = last) {
+    last = first + 1;
+    while (last < n && sim[last].score == sim[first].score) {
+      ++last;
+    }
+    size_t front = first;
+    for (size_t r = 0; r < num && front < last; ++r) {
+      for (size_t i = front; i < last; ++i) {
+        if (sim[i].idx != preferred->idx[r]) {
+          continue;
+        }
+        struct font_similar const v = sim[i];
+        memmove(sim + front + 1, sim + front, (i - front) * sizeof(struct font_similar));
+        sim[front++] = v;
+        break;
+      }
+    }
+  }
+}
+
+struct font_similar *font_get_similar_ranked(struct font_list const *const fl,
+                                             wchar_t const *const s,
+                                             struct font_similar_cancel const *const cancel,
+                                             struct font_similar_preferred const *const preferred) {
+  if (!fl || !s || !fl->num || !fl->text) {
+    ods(L"invalid parameter");
+    return NULL;
+  }
+  struct similar_query q;
+  if (!similar_query_init(&q, s)) {
+    return NULL;
+  }
+  q.cancel = cancel;
+  struct font_similar_stats st = {0};
+  size_t n = 0;
+  struct font_similar *sim = realloc(NULL, fl->num * sizeof(struct font_similar));
+  if (!sim) {
+    ods(L"failed to allocate memory");
+    goto cleanup;
   }
-  if (sim) {
+  if (!similar_query_encode(&q, fl) || !similar_topk_scan(fl, &q, fl->num, sim, &n, &st) || n != fl->num) {
     free(sim);
     sim = NULL;
+    goto cleanup;
   }
-  if (sn) {
-    free(sn);
-    sn = NULL;
+  similar_heap_sort(sim, n);
+  if (preferred) {
+    similar_prefer_ties(preferred, sim, n);
+  }
+
+cleanup:
+  similar_query_free(&q);
+  return sim;
+}
+
+// Font usage table.
+//
+// The counts are in fixed point. A use adds font_usage_increment and each record takes 1 / 2^font_usage_decay_shift
+// off all counts, so a font used every time converges to font_usage_increment << font_usage_decay_shift,
+// and a font that is no longer used falls below font_usage_min after about 90 records and is dropped.
+// The file is the header followed by the entries as they are in memory.
+
+enum {
+  font_usage_magic = 0x55464154, // "TAFU"
+  font_usage_version = 1,
+  font_usage_increment = 1024,
+  font_usage_decay_shift = 5,
+  font_usage_min = 64,
+};
+
+struct font_usage_file {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t wchar_size;
+  uint32_t num;
+  uint32_t checksum; // of the entries
+  struct font_usage_entry entries[font_usage_capacity];
+};
+
+static bool font_usage_validate(struct font_usage_file const *const f, size_t const size) {
+  size_t const header = offsetof(struct font_usage_file, entries);
+  if (size < header || f->magic != font_usage_magic || f->version != font_usage_version ||
+      f->wchar_size != sizeof(wchar_t) || f->num > font_usage_capacity ||
+      size != header + f->num * sizeof(struct font_usage_entry) ||
+      font_cache_checksum(f->entries, f->num * sizeof(struct font_usage_entry)) != f->checksum) {
+    return false;
+  }
+  for (size_t i = 0; i < f->num; ++i) {
+    struct font_usage_entry const *const e = &f->entries[i];
+    if (!e->name[0] || wmemchr(e->name, L'\0', font_name_buffer_len) == NULL ||
+        (i > 0 && e->count > f->entries[i - 1].count)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool font_usage_load(struct font_usage *const u, wchar_t const *const path) {
+  if (!u || !path) {
+    ods(L"invalid parameter");
+    return false;
+  }
+  *u = (struct font_usage){0};
+  HANDLE h = CreateFileW(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (h == INVALID_HANDLE_VALUE) {
+    DWORD const err = GetLastError();
+    if (err == ERROR_FILE_NOT_FOUND) {
+      return true;
+    }
+    odshr(HRESULT_FROM_WIN32(err), L"CreateFileW failed: %s", path);
+    return false;
+  }
+  struct font_usage_file f;
+  DWORD read = 0;
+  BOOL const ok = ReadFile(h, &f, (DWORD)sizeof(f), &read, NULL);
+  CloseHandle(h);
+  if (!ok) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"ReadFile failed: %s", path);
+    return false;
+  }
+  if (!font_usage_validate(&f, read)) {
+    ods(L"font usage file is broken");
+    return false;
+  }
+  memcpy(u->entries, f.entries, f.num * sizeof(struct font_usage_entry));
+  u->num = f.num;
+  return true;
+}
+
+bool font_usage_save(struct font_usage *const u, wchar_t const *const path) {
+  if (!u || !path) {
+    ods(L"invalid parameter");
+    return false;
+  }
+  wchar_t tmp[MAX_PATH];
+  if (wcslen(path) + 5 > MAX_PATH) {
+    ods(L"font usage path is too long");
+    return false;
+  }
+  wcscpy(tmp, path);
+  wcscat(tmp, L".tmp");
+
+  struct font_usage_file f = {
+      .magic = font_usage_magic,
+      .version = font_usage_version,
+      .wchar_size = sizeof(wchar_t),
+      .num = (uint32_t)u->num,
+  };
+  memcpy(f.entries, u->entries, u->num * sizeof(struct font_usage_entry));
+  f.checksum = font_cache_checksum(f.entries, u->num * sizeof(struct font_usage_entry));
+  DWORD const size = (DWORD)(offsetof(struct font_usage_file, entries) + u->num * sizeof(struct font_usage_entry));
+
+  HANDLE h = CreateFileW(tmp, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (h == INVALID_HANDLE_VALUE) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateFileW failed: %s", tmp);
+    return false;
+  }
+  DWORD written = 0;
+  BOOL const ok = WriteFile(h, &f, size, &written, NULL) && written == size;
+  if (!ok) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"WriteFile failed: %s", tmp);
+  }
+  CloseHandle(h);
+  if (!ok || !MoveFileExW(tmp, path, MOVEFILE_REPLACE_EXISTING)) {
+    if (ok) {
+      odshr(HRESULT_FROM_WIN32(GetLastError()), L"MoveFileExW failed: %s", path);
+    }
+    DeleteFileW(tmp);
+    return false;
+  }
+  u->dirty = false;
+  return true;
+}
+
+void font_usage_record(struct font_usage *const u, wchar_t const *const name) {
+  if (!u || !name || !name[0] || wcslen(name) >= font_name_buffer_len) {
+    ods(L"invalid parameter");
+    return;
+  }
+  size_t found = SIZE_MAX;
+  size_t num = 0;
+  for (size_t i = 0; i < u->num; ++i) {
+    struct font_usage_entry e = u->entries[i];
+    e.count -= e.count >> font_usage_decay_shift;
+    if (wcscmp(e.name, name) == 0) {
+      found = num;
+    } else if (e.count < font_usage_min) {
+      continue;
+    }
+    u->entries[num++] = e;
+  }
+  if (found == SIZE_MAX) {
+    if (num == font_usage_capacity) {
+      --num; // the least used entry makes room
+    }
+    found = num++;
+    u->entries[found] = (struct font_usage_entry){0};
+    wcscpy(u->entries[found].name, name);
+  }
+  // Decaying keeps the order of the others, so only the recorded entry moves up.
+  struct font_usage_entry e = u->entries[found];
+  e.count += font_usage_increment;
+  size_t i = found;
+  for (; i > 0 && u->entries[i - 1].count <= e.count; --i) {
+    u->entries[i] = u->entries[i - 1];
+  }
+  u->entries[i] = e;
+  u->num = num;
+  u->dirty = true;
+}
+
+void font_usage_preferred(struct font_usage const *const u,
+                          struct font_list const *const fl,
+                          struct font_similar_preferred *const preferred) {
+  if (!preferred) {
+    ods(L"invalid parameter");
+    return;
+  }
+  preferred->num = 0;
+  if (!u || !fl || !fl->num) {
+    return;
+  }
+  for (size_t i = 0; i < u->num && preferred->num < font_similar_preferred_max; ++i) {
+    int const idx = font_list_index_of(fl, u->entries[i].name);
+    if (idx != -1) {
+      preferred->idx[preferred->num++] = idx;
+    }
   }
-  return NULL;
 }
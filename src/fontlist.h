@@ -1,11 +1,88 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <wchar.h>
 
+enum {
+  // Display names come from LOGFONTW::lfFaceName, so they fit in LF_FACESIZE with the null character.
+  font_name_buffer_len = 32,
+  // Normalized names are coded in bytes when all of their code units are in the alphabet of the font list.
+  font_alphabet_size = 255,
+  // See struct font_similar_cache.
+  font_similar_cache_size = 64,
+  font_similar_cache_query_len = 64,
+  font_similar_recent_size = 32,
+  font_similar_recent_topk = 16,
+  // See struct font_similar_preferred and struct font_usage.
+  font_similar_preferred_max = 16,
+  font_usage_capacity = 32,
+};
+
+struct thread_pool;
+
+struct font_qgram_index {
+  size_t mask;
+  uint32_t *keys;
+  uint32_t *offsets; // offsets of the posting lists in postings, UINT32_MAX means an empty slot
+  uint8_t *postings; // delta + varint encoded posting lists
+  size_t postings_size;
+};
+
+// Coded normalized names transposed in blocks of font_batch_lanes fonts for the batch scorer.
+// The pos-th code of the lane-th font of the block b is at codes[offsets[b] + pos * font_batch_lanes + lane],
+// shorter names are padded with a code that matches nothing.
+// The bit lane of wide[b] is set if the font is not coded by the alphabet.
+struct font_batch_index {
+  uint32_t *offsets; // followed by wide
+  uint16_t *wide;
+  uint8_t *codes;
+  size_t codes_size;
+};
+
+// The fonts grouped by family, the name without the trailing style words such as "Bold" or "W3".
+// It is a two-level trie of family and weight flattened into arrays, families are in the order of their first font
+// in the list and the fonts of a family are ordered by weight.
+struct font_family_index {
+  uint32_t *members; // font indices grouped by family, followed by family, slot and weight
+  uint32_t *family;  // family of each font
+  uint32_t *slot;    // position of each font in members
+  uint16_t *weight;  // weight class of each font, 400 for regular, plus one for italic
+  uint32_t *offsets; // num + 1 positions in members where the families start
+  size_t num;        // number of families
+};
+
 struct font_list {
   size_t num;
-  wchar_t **sorted;
+  // Front-coded display names and normalized names in the sorted order.
+  // Each entry stores the part that differs from the previous entry, and every
+  // font_dict_restart_interval-th entry is stored in full at the position in restarts.
+  // A normalized name is stored as the indices in alphabet packed two per code unit,
+  // or as it is if it has a code unit that is not in alphabet.
+  wchar_t *text;
+  size_t textlen;
+  uint32_t *restarts;
+  // The most frequent code units in the normalized names in ascending order.
+  wchar_t alphabet[font_alphabet_size];
+  size_t alphabet_len;
+  // Per-font 64-bit character set signature and length of the normalized names,
+  // used to reject candidates in font_get_similar_topk without scoring them.
+  uint64_t *signature;
+  uint16_t *normlen;
+  // Bigram inverted index over the normalized names to collect the candidates that seed the limit of the full scan.
+  // A font can be as similar as the candidates without sharing a bigram, so the index does not make the query
+  // sublinear and only narrows the limit early; the full scan stays for exact results. That saves about 5 to 20 percent
+  // of the scans that find candidates for about 24 bytes per font, and the index is built only when the cache file
+  // is stale.
+  struct font_qgram_index qgram;
+  struct font_batch_index batch;
+  struct font_family_index family;
+  // Workers that split the full scan of font_get_similar_topk, NULL for small lists.
+  struct thread_pool *pool;
+  // Unique among the lists built or loaded by the process, caches of query results are keyed by it.
+  uint32_t generation;
+  // Non-NULL if the list is loaded from the cache file, the tables point into this view.
+  void *cache_view;
 };
 
 struct font_similar {
@@ -13,8 +90,140 @@ struct font_similar {
   int score;
 };
 
-bool font_list_create(struct font_list *const fl);
+struct font_similar_stats {
+  size_t scored;     // fonts that were scored
+  size_t pruned;     // fonts rejected by the lower bound without scoring
+  size_t candidates; // fonts taken from the bigram index to seed the limit of the full scan, which are visited twice
+};
+
+// Lets another thread stop a query of font_get_similar_cached in flight by setting requested to nonzero.
+// The scans read it once per block of fonts, and a stopped query returns 0 and leaves the cache empty.
+struct font_similar_cancel {
+  long volatile requested;
+};
+
+// A query answered by a scan of font_get_similar_cached and its top entries.
+struct font_similar_recent {
+  wchar_t query[font_similar_cache_query_len]; // normalized
+  size_t querylen;
+  uint32_t used; // font_similar_cache::clock when it was last used, 0 if empty
+  struct font_similar entries[font_similar_recent_topk];
+  size_t num;
+};
+
+// The last query of font_get_similar_cached and its result, owned by the caller and zero-initialized.
+// The same query again is answered from the entries. For a query that extends the last one, only the fonts whose
+// score can still reach the top k by the bound kept for each font are rescored.
+struct font_similar_cache {
+  uint32_t generation; // of the font list the cache belongs to, 0 if empty
+  wchar_t query[font_similar_cache_query_len]; // normalized
+  size_t querylen;
+  struct font_similar entries[font_similar_cache_size]; // the best entry first
+  size_t num;
+  // The score or a lower bound of the score of each font for query.
+  uint16_t *bounds;
+  size_t bounds_len;
+  // The recent queries of the font list of recent_generation, the least recently used one is replaced.
+  // A query asked again after others is answered from here while it wants at most font_similar_recent_topk entries.
+  struct font_similar_recent recent[font_similar_recent_size];
+  uint32_t recent_generation;
+  uint32_t clock;
+  size_t hits;        // queries answered from the entries
+  size_t recent_hits; // queries answered from recent
+  size_t refines;     // queries answered by rescoring the fonts that are still viable
+  size_t misses;      // queries that scored all fonts
+};
+
+// Fonts the user chooses often, the most used first, see font_usage_preferred.
+// font_get_similar_cached ranks them before the other fonts of the same score, and scores them before the scan so
+// that, when they are at least k, the k-th of their scores bounds the scores that can still enter the top k.
+struct font_similar_preferred {
+  int idx[font_similar_preferred_max];
+  size_t num;
+};
+
+// Decayed counts of the fonts the user committed, keyed by the display name so that they outlive the font list.
+// Each record decays all counts, so recent use weighs more, and a new name replaces the least used entry when full.
+struct font_usage_entry {
+  wchar_t name[font_name_buffer_len];
+  uint32_t count;
+};
+
+struct font_usage {
+  struct font_usage_entry entries[font_usage_capacity]; // the most used first
+  size_t num;
+  bool dirty; // changed since it was loaded or saved
+};
+
+// Bytes used by each component of a font list.
+struct font_list_memory_usage {
+  size_t text;
+  size_t restarts;
+  size_t signature; // signature and normlen
+  size_t qgram;     // bigram index
+  size_t batch;     // transposed codes for the batch scorer
+  size_t family;    // family index
+  size_t total;
+  bool mapped; // everything but the struct itself lives in the mapped cache file
+};
+
+// cache_path is optional, if given the list is loaded from and saved to the cache file.
+// While the file is mapped by another list, cache_path with ".1" appended is used instead.
+bool font_list_create(struct font_list *const fl, wchar_t const *const cache_path);
 void font_list_destroy(struct font_list *const fl);
 
 int font_list_index_of(struct font_list const *const fl, wchar_t const *const s);
+// Sets [*first, *last) to the range of the names that start with prefix in the collation order of the list,
+// which ignores case like font_list_index_of. Takes two binary searches, whatever the number of fonts.
+bool font_list_prefix_range(struct font_list const *const fl,
+                            wchar_t const *const prefix,
+                            size_t *const first,
+                            size_t *const last);
+// Copies the display name of the idx-th font to buf, which must hold font_name_buffer_len characters.
+void font_list_get_name(struct font_list const *const fl, size_t const idx, wchar_t *const buf);
+// Returns the index of the font delta steps away from the idx-th font within its family, clamped at the ends.
+size_t font_list_step_in_family(struct font_list const *const fl, size_t const idx, int const delta);
+// Returns the index of the font whose weight is the closest to the idx-th font in the family delta families away,
+// clamped at the first and the last family.
+size_t font_list_step_family(struct font_list const *const fl, size_t const idx, int const delta);
+void font_list_memory_usage(struct font_list const *const fl, struct font_list_memory_usage *const usage);
 struct font_similar *font_get_similar(struct font_list const *const fl, wchar_t const *const s);
+// Ranks all fonts like font_get_similar, with the fonts of preferred first among the fonts of the same score in the
+// order of font_get_similar_cached. Returns NULL on failure or when cancel is requested.
+// cancel and preferred are optional, see struct font_similar_cancel and struct font_similar_preferred.
+struct font_similar *font_get_similar_ranked(struct font_list const *const fl,
+                                             wchar_t const *const s,
+                                             struct font_similar_cancel const *const cancel,
+                                             struct font_similar_preferred const *const preferred);
+
+// Writes at most k entries of the most similar fonts to out, ordered from the most similar one.
+// Returns the number of written entries, 0 on failure.
+// stats is optional and receives how many candidates were pruned.
+size_t font_get_similar_topk(struct font_list const *const fl,
+                             wchar_t const *const s,
+                             size_t const k,
+                             struct font_similar *const out,
+                             struct font_similar_stats *const stats);
+// Writes the top k fonts like font_get_similar_topk and keeps the state in cache for the next query.
+// The result is the same as the one of font_get_similar_topk.
+// k must not exceed font_similar_cache_size. cancel is optional, see struct font_similar_cancel.
+// preferred is optional, see struct font_similar_preferred. The cache holds the result without it.
+size_t font_get_similar_cached(struct font_list const *const fl,
+                               struct font_similar_cache *const cache,
+                               wchar_t const *const s,
+                               size_t const k,
+                               struct font_similar *const out,
+                               struct font_similar_stats *const stats,
+                               struct font_similar_cancel const *const cancel,
+                               struct font_similar_preferred const *const preferred);
+void font_similar_cache_free(struct font_similar_cache *const cache);
+
+// Loads the table saved by font_usage_save. A missing file leaves the table empty and is not an error.
+bool font_usage_load(struct font_usage *const u, wchar_t const *const path);
+bool font_usage_save(struct font_usage *const u, wchar_t const *const path);
+// Counts one more use of the font name and decays the others.
+void font_usage_record(struct font_usage *const u, wchar_t const *const name);
+// Writes the most used fonts that are in the list to preferred.
+void font_usage_preferred(struct font_usage const *const u,
+                          struct font_list const *const fl,
+                          struct font_similar_preferred *const preferred);
@@ -0,0 +1,207 @@
+#include "nfkc.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nfkc_table.h"
+
+enum {
+  hangul_s_base = 0xac00,
+  hangul_l_base = 0x1100,
+  hangul_v_base = 0x1161,
+  hangul_t_base = 0x11a7,
+  hangul_l_count = 19,
+  hangul_v_count = 21,
+  hangul_t_count = 28,
+  hangul_n_count = hangul_v_count * hangul_t_count,
+  hangul_s_count = hangul_l_count * hangul_n_count,
+  // Decomposed code points that fit on the stack, longer strings use the heap.
+  nfkc_stack_buffer_len = 256,
+};
+
+static inline uint32_t nfkc_ccc(uint32_t const cp) {
+  if (cp >= nfkc_ccc_limit) {
+    return 0;
+  }
+  return nfkc_ccc_data[((uint32_t)nfkc_ccc_index[cp >> nfkc_ccc_shift] << nfkc_ccc_shift) +
+                       (cp & ((1u << nfkc_ccc_shift) - 1))];
+}
+
+static inline uint16_t const *nfkc_decomposition(uint32_t const cp) {
+  if (cp >= nfkc_decomp_limit) {
+    return NULL;
+  }
+  uint16_t const offset = nfkc_decomp_data[((uint32_t)nfkc_decomp_index[cp >> nfkc_decomp_shift] << nfkc_decomp_shift) +
+                                           (cp & ((1u << nfkc_decomp_shift) - 1))];
+  return offset ? nfkc_decomp_units + offset : NULL;
+}
+
+static inline uint32_t read_utf16(uint16_t const *const s, size_t const len, size_t *const pos) {
+  uint32_t const c = s[(*pos)++];
+  if (c - 0xd800 < 0x400 && *pos < len && (uint32_t)(s[*pos] - 0xdc00) < 0x400) {
+    return 0x10000 + ((c - 0xd800) << 10) + (uint32_t)(s[(*pos)++] - 0xdc00);
+  }
+  return c;
+}
+
+static inline uint32_t read_code_point(wchar_t const *const s, size_t const len, size_t *const pos) {
+#if WCHAR_MAX == 0xffff
+  return read_utf16((uint16_t const *)s, len, pos);
+#else
+  (void)len;
+  return (uint32_t)s[(*pos)++];
+#endif
+}
+
+static inline size_t push(uint32_t *const buf, size_t const len, size_t const cap, uint32_t const cp) {
+  if (len < cap) {
+    buf[len] = cp;
+  }
+  return len + 1;
+}
+
+// Appends the full compatibility decomposition of cp to buf and returns the new length, which can exceed cap.
+static size_t decompose(uint32_t const cp, uint32_t *const buf, size_t len, size_t const cap) {
+  if (cp - hangul_s_base < hangul_s_count) {
+    uint32_t const s = cp - hangul_s_base;
+    len = push(buf, len, cap, hangul_l_base + s / hangul_n_count);
+    len = push(buf, len, cap, hangul_v_base + (s % hangul_n_count) / hangul_t_count);
+    if (s % hangul_t_count) {
+      len = push(buf, len, cap, hangul_t_base + s % hangul_t_count);
+    }
+    return len;
+  }
+  uint16_t const *const d = nfkc_decomposition(cp);
+  if (!d) {
+    return push(buf, len, cap, cp);
+  }
+  for (size_t pos = 0; pos < d[0];) {
+    len = push(buf, len, cap, read_utf16(d + 1, d[0], &pos));
+  }
+  return len;
+}
+
+// Stable sort of each run of non-starters by canonical combining class.
+static void reorder(uint32_t *const buf, size_t const len) {
+  for (size_t i = 1; i < len; ++i) {
+    uint32_t const cp = buf[i];
+    uint32_t const ccc = nfkc_ccc(cp);
+    if (!ccc) {
+      continue;
+    }
+    size_t j = i;
+    for (; j > 0 && nfkc_ccc(buf[j - 1]) > ccc; --j) {
+      buf[j] = buf[j - 1];
+    }
+    buf[j] = cp;
+  }
+}
+
+static uint32_t compose_pair(uint32_t const a, uint32_t const b) {
+  if (a - hangul_l_base < hangul_l_count && b - hangul_v_base < hangul_v_count) {
+    return hangul_s_base + ((a - hangul_l_base) * hangul_v_count + (b - hangul_v_base)) * hangul_t_count;
+  }
+  if (a - hangul_s_base < hangul_s_count && (a - hangul_s_base) % hangul_t_count == 0 &&
+      b - hangul_t_base - 1 < hangul_t_count - 1) {
+    return a + (b - hangul_t_base);
+  }
+  size_t lo = 0, hi = nfkc_composition_count;
+  while (lo < hi) {
+    size_t const mid = (lo + hi) / 2;
+    uint32_t const *const c = nfkc_compositions[mid];
+    if (c[0] < a || (c[0] == a && c[1] < b)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < nfkc_composition_count && nfkc_compositions[lo][0] == a && nfkc_compositions[lo][1] == b) {
+    return nfkc_compositions[lo][2];
+  }
+  return 0;
+}
+
+// Canonical composition in place, returns the new length.
+static size_t compose(uint32_t *const buf, size_t const len) {
+  size_t starter = 0, n = 1;
+  uint32_t starter_cp = buf[0];
+  // A leading non-starter has no starter to compose with, 256 blocks it.
+  uint32_t last_ccc = nfkc_ccc(starter_cp) ? 256 : 0;
+  for (size_t i = 1; i < len; ++i) {
+    uint32_t const cp = buf[i];
+    uint32_t const ccc = nfkc_ccc(cp);
+    if (last_ccc < ccc || last_ccc == 0) {
+      uint32_t const composite = compose_pair(starter_cp, cp);
+      if (composite) {
+        buf[starter] = starter_cp = composite;
+        continue;
+      }
+    }
+    if (!ccc) {
+      starter = n;
+      starter_cp = cp;
+    }
+    last_ccc = ccc;
+    buf[n++] = cp;
+  }
+  return n;
+}
+
+static size_t write_code_point(wchar_t *const dest, size_t const destlen, size_t pos, uint32_t const cp) {
+#if WCHAR_MAX == 0xffff
+  if (cp >= 0x10000) {
+    pos = write_code_point(dest, destlen, pos, 0xd800 + ((cp - 0x10000) >> 10));
+    return write_code_point(dest, destlen, pos, 0xdc00 + ((cp - 0x10000) & 0x3ff));
+  }
+#endif
+  if (pos < destlen) {
+    dest[pos] = (wchar_t)cp;
+  }
+  return pos + 1;
+}
+
+size_t nfkc(wchar_t const *const src, size_t const srclen, wchar_t *const dest, size_t const destlen) {
+  // ASCII is never changed by NFKC, and only the last ASCII character
+  // before the other characters can be composed with them.
+  size_t ascii = 0;
+  while (ascii < srclen && (uint32_t)src[ascii] < 0x80) {
+    ++ascii;
+  }
+  size_t const prefix = ascii == srclen ? srclen : ascii ? ascii - 1 : 0;
+  if (prefix && destlen) {
+    memcpy(dest, src, (prefix < destlen ? prefix : destlen) * sizeof(wchar_t));
+  }
+  if (prefix == srclen) {
+    return srclen;
+  }
+
+  uint32_t stack[nfkc_stack_buffer_len];
+  uint32_t *buf = stack;
+  size_t len = 0;
+  for (size_t pos = prefix; pos < srclen;) {
+    len = decompose(read_code_point(src, srclen, &pos), buf, len, nfkc_stack_buffer_len);
+  }
+  if (len > nfkc_stack_buffer_len) {
+    buf = realloc(NULL, len * sizeof(uint32_t));
+    if (!buf) {
+      return 0;
+    }
+    size_t const cap = len;
+    len = 0;
+    for (size_t pos = prefix; pos < srclen;) {
+      len = decompose(read_code_point(src, srclen, &pos), buf, len, cap);
+    }
+  }
+  reorder(buf, len);
+  len = compose(buf, len);
+
+  size_t r = prefix;
+  for (size_t i = 0; i < len; ++i) {
+    r = write_code_point(dest, destlen, r, buf[i]);
+  }
+  if (buf != stack) {
+    free(buf);
+  }
+  return r;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <stddef.h>
+#include <wchar.h>
+
+// Writes the Unicode normalization form KC of src to dest and returns its length in code units.
+// The result is not null-terminated. When the return value is larger than destlen,
+// only the first destlen code units are written and the caller can retry with a larger buffer.
+// Returns 0 when src is empty or memory can not be allocated.
+size_t nfkc(wchar_t const *const src, size_t const srclen, wchar_t *const dest, size_t const destlen);
@@ -0,0 +1,3125 @@
+#pragma once
+// Generated by tools/nfkc_table.py from Unicode 14.0.0, do not edit.
+
+#include <stdint.h>
+
+// clang-format off
+enum {
+  nfkc_ccc_shift = 5,
+  nfkc_ccc_limit = 0x1e960,
+  nfkc_decomp_shift = 6,
+  nfkc_decomp_limit = 0x2fa40,
+  nfkc_composition_count = 941,
+};
+
+// Two-stage tables: data[(index[cp >> shift] << shift) + (cp & ((1 << shift) - 1))] for cp < limit.
+
+// Canonical combining class.
+static uint8_t const nfkc_ccc_index[3915] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 6, 7, 8, 0, 9, 0, 10, 11, 0, 0, 12, 13, 14, 15, 16, 0,
+    0, 0, 0, 17, 18, 19, 20, 0, 21, 0, 22, 23, 0, 24, 25, 0, 0, 24, 26, 27,
+    0, 24, 26, 0, 0, 24, 26, 0, 0, 24, 26, 0, 0, 0, 26, 0, 0, 24, 28, 0,
+    0, 24, 26, 0, 0, 29, 26, 0, 0, 0, 30, 0, 0, 31, 32, 0, 0, 33, 34, 0,
+    35, 36, 0, 37, 38, 0, 39, 0, 0, 40, 0, 0, 41, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 43, 44, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 46, 0, 0,
+    0, 47, 0, 0, 0, 0, 0, 0, 48, 0, 0, 49, 0, 50, 51, 0, 0, 52, 53, 54,
+    0, 55, 0, 56, 0, 57, 0, 0, 0, 0, 58, 59, 0, 0, 0, 0, 0, 0, 60, 61,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 62, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+    0, 0, 0, 65, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 67, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 70, 0, 0, 71, 0, 0, 0, 0,
+    0, 0, 0, 0, 72, 73, 0, 0, 0, 0, 53, 74, 0, 75, 76, 0, 0, 77, 78, 0,
+    0, 0, 0, 0, 0, 79, 80, 81, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 86, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 87, 88, 0, 0, 0, 0, 0, 89, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 90, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 91, 0, 0, 0, 0, 92, 0, 93, 0, 0, 0, 0, 0, 72, 94,
+    0, 95, 0, 0, 96, 97, 0, 77, 0, 0, 98, 0, 0, 99, 0, 0, 0, 0, 0, 100,
+    0, 101, 26, 102, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 104, 0, 0, 0, 0, 0,
+    0, 65, 105, 0, 0, 65, 0, 0, 0, 106, 0, 0, 0, 107, 0, 0, 0, 0, 0, 0,
+    0, 95, 0, 0, 0, 0, 0, 0, 0, 108, 109, 0, 0, 0, 0, 78, 0, 44, 110, 0,
+    111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 65, 0, 0, 0, 0, 0, 0,
+    0, 0, 112, 0, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 114, 0, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 118, 119, 120, 0, 0, 0, 0, 121, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    122, 123, 0, 0, 0, 0, 0, 0, 0, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 124, 0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 127,
+};
+static uint8_t const nfkc_ccc_data[4096] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 232, 220, 220, 220, 220, 232, 216,
+    220, 220, 220, 220, 220, 202, 202, 220, 220, 220, 220, 202, 202, 220, 220, 220, 220, 220, 220, 220,
+    220, 220, 220, 220, 1, 1, 1, 1, 1, 220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230,
+    230, 240, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0, 230, 230, 230, 220, 220, 220, 220, 230,
+    232, 220, 220, 230, 233, 234, 234, 233, 234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 230, 230, 230, 230, 220, 230, 230, 230, 222, 220,
+    230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23, 0, 24, 25, 0,
+    230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31, 32, 33, 34, 230,
+    230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 220,
+    230, 0, 0, 230, 230, 0, 220, 230, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230,
+    220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230, 230, 230, 220, 230, 220, 230, 220, 230,
+    220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220,
+    220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 220,
+    230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220, 27, 28, 29, 230, 230, 230, 220, 230,
+    230, 220, 220, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 230, 220, 230,
+    230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 84, 91, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    118, 118, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 129, 130, 0, 132, 0, 0, 0, 0, 0, 130, 130, 130, 130, 0, 0, 130, 0, 230, 230,
+    9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    220, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+    230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220, 220, 230, 230, 220, 220, 230, 230, 230,
+    230, 230, 220, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    220, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 1, 220, 220, 220,
+    220, 220, 230, 230, 220, 220, 220, 220, 230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 220, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+    230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220, 202, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230,
+    233, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 1, 1, 230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0, 0, 230, 0, 0,
+    0, 1, 1, 230, 220, 230, 1, 1, 220, 220, 220, 220, 230, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 0, 230, 230, 220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230,
+    0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 230, 230, 230, 230,
+    230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 1, 220, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220,
+    230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0,
+    230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+    0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+    230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216, 216, 216, 216, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 220, 220, 220, 220, 220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 230,
+    230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220, 220, 220, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+// Offset in nfkc_decomp_units of the full compatibility decomposition, 0 if there is none.
+static uint16_t const nfkc_decomp_index[3049] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 0, 10, 11, 12,
+    13, 14, 0, 15, 0, 0, 16, 0, 17, 18, 0, 19, 0, 0, 0, 0,
+    0, 0, 0, 0, 20, 21, 0, 22, 23, 24, 0, 0, 0, 25, 26, 27,
+    0, 28, 0, 29, 0, 30, 0, 31, 32, 0, 33, 34, 35, 36, 37, 0,
+    38, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 0, 0,
+    0, 0, 0, 0, 42, 43, 44, 0, 45, 46, 47, 48, 49, 50, 51, 52,
+    53, 54, 55, 0, 56, 57, 58, 59, 60, 61, 62, 63, 64, 0, 0, 0,
+    0, 65, 66, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 68, 69, 0, 70, 0, 0, 0, 0,
+    0, 71, 0, 0, 0, 72, 0, 0, 0, 0, 73, 74, 75, 76, 77, 78,
+    79, 80, 81, 82, 83, 84, 85, 0, 86, 87, 88, 89, 90, 91, 92, 93,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 0, 0, 95, 0, 96,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+    110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 127, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 129, 0, 0,
+    0, 0, 130, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 133, 134, 135, 0, 0, 0, 0, 0, 0, 0, 0,
+    136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 152, 153, 154, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 155, 156, 157, 0, 158, 159, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 160,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    161, 162, 163, 164, 165, 166, 167, 168, 169,
+};
+static uint16_t const nfkc_decomp_data[10880] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 6, 0, 0, 0, 0, 8,
+    0, 0, 11, 13, 15, 18, 0, 0, 20, 23, 25, 0, 27, 31, 35, 0,
+    39, 42, 45, 48, 51, 54, 0, 57, 60, 63, 66, 69, 72, 75, 78, 81,
+    0, 84, 87, 90, 93, 96, 99, 0, 0, 102, 105, 108, 111, 114, 0, 0,
+    117, 120, 123, 126, 129, 132, 0, 135, 138, 141, 144, 147, 150, 153, 156, 159,
+    0, 162, 165, 168, 171, 174, 177, 0, 0, 180, 183, 186, 189, 192, 0, 195,
+    198, 201, 204, 207, 210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243,
+    0, 0, 246, 249, 252, 255, 258, 261, 264, 267, 270, 273, 276, 279, 282, 285,
+    288, 291, 294, 297, 300, 303, 0, 0, 306, 309, 312, 315, 318, 321, 324, 327,
+    330, 0, 333, 336, 339, 342, 345, 348, 0, 351, 354, 357, 360, 363, 366, 369,
+    372, 0, 0, 375, 378, 381, 384, 387, 390, 393, 0, 0, 396, 399, 402, 405,
+    408, 411, 0, 0, 414, 417, 420, 423, 426, 429, 432, 435, 438, 441, 444, 447,
+    450, 453, 456, 459, 462, 465, 0, 0, 468, 471, 474, 477, 480, 483, 486, 489,
+    492, 495, 498, 501, 504, 507, 510, 513, 516, 519, 522, 525, 528, 531, 534, 537,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    539, 542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 545,
+    548, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 551, 555, 559, 563, 566, 569, 572, 575, 578, 581, 584, 587,
+    590, 593, 596, 599, 602, 605, 609, 613, 617, 621, 625, 629, 633, 0, 637, 641,
+    645, 649, 653, 656, 0, 0, 659, 662, 665, 668, 671, 674, 677, 681, 685, 688,
+    691, 694, 697, 700, 703, 706, 0, 0, 709, 712, 715, 719, 723, 726, 729, 732,
+    735, 738, 741, 744, 747, 750, 753, 756, 759, 762, 765, 768, 771, 774, 777, 780,
+    783, 786, 789, 792, 795, 798, 801, 804, 807, 810, 813, 816, 0, 0, 819, 822,
+    0, 0, 0, 0, 0, 0, 825, 828, 831, 834, 837, 841, 845, 849, 853, 856,
+    859, 863, 867, 870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    873, 875, 877, 879, 881, 883, 885, 887, 889, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 891, 894, 897, 900, 903, 906, 0, 0,
+    909, 911, 537, 913, 915, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    917, 919, 0, 921, 923, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 926, 0, 0, 0, 0, 0, 928, 0, 0, 0, 931, 0,
+    0, 0, 0, 0, 15, 933, 937, 940, 942, 945, 948, 0, 951, 0, 954, 957,
+    960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 964, 967, 970, 973, 976, 979,
+    982, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 986, 989, 992, 995, 998, 0,
+    1001, 1003, 1005, 954, 967, 1007, 1009, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1011, 1013, 1015, 0, 1017, 1019, 0, 0, 0, 1021, 0, 0, 0, 0, 0, 0,
+    1023, 1026, 0, 1029, 0, 0, 0, 1032, 0, 0, 0, 0, 1035, 1038, 1041, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1044, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1047, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1050, 1053, 0, 1056, 0, 0, 0, 1059, 0, 0, 0, 0, 1062, 1065, 1068, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1071, 1074, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1077, 1080, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1083, 1086, 1089, 1092, 0, 0, 1095, 1098, 0, 0, 1101, 1104, 1107, 1110, 1113, 1116,
+    0, 0, 1119, 1122, 1125, 1128, 1131, 1134, 0, 0, 1137, 1140, 1143, 1146, 1149, 1152,
+    1155, 1158, 1161, 1164, 1167, 1170, 0, 0, 1173, 1176, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1179, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1182, 1185, 1188, 1191, 1194, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1197, 1200, 1203, 1206, 0, 0, 0, 0, 0, 0, 0,
+    1209, 0, 1212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1218, 0, 0, 0, 0, 0, 0,
+    0, 1221, 0, 0, 1224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1227, 1230, 1233, 1236, 1239, 1242, 1245, 1248,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251, 1254, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1257, 1260, 0, 1263,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1266, 0, 0, 1269, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1272, 1275, 1278, 0, 0, 1281, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1284, 0, 0, 1287, 1290, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1293, 1296, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1302, 1305, 1308, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1311, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1314, 0, 0, 0, 0, 0, 0, 1317, 1320, 0, 1323, 1326, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1330, 1333, 1336, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1339, 0, 1342, 1345, 1349, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1355, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1358, 1361, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1364, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1369, 0, 0,
+    0, 0, 1372, 0, 0, 0, 0, 1375, 0, 0, 0, 0, 1378, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1381, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1384, 0, 1387, 1390, 1393, 1397, 1400, 0, 0, 0, 0, 0, 0,
+    0, 1404, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1407, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1410, 0, 0,
+    0, 0, 1413, 0, 0, 0, 0, 1416, 0, 0, 0, 0, 1419, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1422, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1425, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1428, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1430, 0, 1433, 0, 1436, 0, 1439, 0, 1442, 0,
+    0, 0, 1445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1448, 0, 1451, 0, 0,
+    1454, 1457, 0, 1460, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1463, 1465, 1467, 0,
+    1469, 1471, 1473, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 0, 1491, 1493, 1495, 1497,
+    1499, 1501, 1503, 6, 1505, 1507, 1509, 1511, 1513, 1515, 1517, 1519, 1521, 1523, 0, 1525,
+    1527, 1529, 25, 1531, 1533, 1535, 1537, 1539, 1541, 1543, 1545, 1547, 1549, 1001, 1551, 1553,
+    1007, 1555, 1557, 879, 1541, 1547, 1001, 1551, 1013, 1007, 1555, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1559, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1561, 1563, 1565, 1567, 1521,
+    1569, 1571, 1573, 1575, 1577, 1579, 1581, 1583, 1585, 1587, 1589, 1591, 1593, 1595, 1597, 1599,
+    1601, 1603, 1605, 1607, 1609, 1611, 1613, 1615, 1617, 1619, 1621, 1623, 1625, 1627, 1629, 1003,
+    1631, 1634, 1637, 1640, 1643, 1646, 1649, 1652, 1655, 1659, 1663, 1666, 1669, 1672, 1675, 1678,
+    1681, 1684, 1687, 1690, 1693, 1697, 1701, 1705, 1709, 1712, 1715, 1718, 1721, 1725, 1729, 1732,
+    1735, 1738, 1741, 1744, 1747, 1750, 1753, 1756, 1759, 1762, 1765, 1768, 1771, 1774, 1777, 1781,
+    1785, 1788, 1791, 1794, 1797, 1800, 1803, 1806, 1809, 1813, 1817, 1820, 1823, 1826, 1829, 1832,
+    1835, 1838, 1841, 1844, 1847, 1850, 1853, 1856, 1859, 1862, 1865, 1868, 1871, 1875, 1879, 1883,
+    1887, 1891, 1895, 1899, 1903, 1906, 1909, 1912, 1915, 1918, 1921, 1924, 1927, 1931, 1935, 1938,
+    1941, 1944, 1947, 1950, 1953, 1957, 1961, 1965, 1969, 1973, 1977, 1980, 1983, 1986, 1989, 1992,
+    1995, 1998, 2001, 2004, 2007, 2010, 2013, 2016, 2019, 2023, 2027, 2031, 2035, 2038, 2041, 2044,
+    2047, 2050, 2053, 2056, 2059, 2062, 2065, 2068, 2071, 2074, 2077, 2080, 2083, 2086, 2089, 2092,
+    2095, 2098, 2101, 2104, 2107, 2110, 2113, 2116, 2119, 2122, 2125, 1944, 0, 0, 0, 0,
+    2128, 2131, 2134, 2137, 2140, 2144, 2148, 2152, 2156, 2160, 2164, 2168, 2172, 2176, 2180, 2184,
+    2188, 2192, 2196, 2200, 2204, 2208, 2212, 2216, 2220, 2223, 2226, 2229, 2232, 2235, 2238, 2242,
+    2246, 2250, 2254, 2258, 2262, 2266, 2270, 2274, 2278, 2281, 2284, 2287, 2290, 2293, 2296, 2299,
+    2302, 2306, 2310, 2314, 2318, 2322, 2326, 2330, 2334, 2338, 2342, 2346, 2350, 2354, 2358, 2362,
+    2366, 2370, 2374, 2378, 2382, 2385, 2388, 2391, 2394, 2398, 2402, 2406, 2410, 2414, 2418, 2422,
+    2426, 2430, 2434, 2437, 2440, 2443, 2446, 2449, 2452, 2455, 0, 0, 0, 0, 0, 0,
+    2458, 2461, 2464, 2468, 2472, 2476, 2480, 2484, 2488, 2491, 2494, 2498, 2502, 2506, 2510, 2514,
+    2518, 2521, 2524, 2528, 2532, 2536, 0, 0, 2540, 2543, 2546, 2550, 2554, 2558, 0, 0,
+    2562, 2565, 2568, 2572, 2576, 2580, 2584, 2588, 2592, 2595, 2598, 2602, 2606, 2610, 2614, 2618,
+    2622, 2625, 2628, 2632, 2636, 2640, 2644, 2648, 2652, 2655, 2658, 2662, 2666, 2670, 2674, 2678,
+    2682, 2685, 2688, 2692, 2696, 2700, 0, 0, 2704, 2707, 2710, 2714, 2718, 2722, 0, 0,
+    2726, 2729, 2732, 2736, 2740, 2744, 2748, 2752, 0, 2756, 0, 2759, 0, 2763, 0, 2767,
+    2771, 2774, 2777, 2781, 2785, 2789, 2793, 2797, 2801, 2804, 2807, 2811, 2815, 2819, 2823, 2827,
+    2831, 970, 2834, 973, 2837, 976, 2840, 979, 2843, 992, 2846, 995, 2849, 998, 0, 0,
+    2852, 2856, 2860, 2865, 2870, 2875, 2880, 2885, 2890, 2894, 2898, 2903, 2908, 2913, 2918, 2923,
+    2928, 2932, 2936, 2941, 2946, 2951, 2956, 2961, 2966, 2970, 2974, 2979, 2984, 2989, 2994, 2999,
+    3004, 3008, 3012, 3017, 3022, 3027, 3032, 3037, 3042, 3046, 3050, 3055, 3060, 3065, 3070, 3075,
+    3080, 3083, 3086, 3090, 3093, 0, 3097, 3100, 3104, 3107, 3110, 937, 3113, 3116, 3119, 3116,
+    3121, 3124, 3128, 3132, 3135, 0, 3139, 3142, 3146, 942, 3149, 945, 3152, 3155, 3159, 3163,
+    3167, 3170, 3173, 960, 0, 0, 3177, 3180, 3184, 3187, 3190, 948, 0, 3193, 3197, 3201,
+    3205, 3208, 3211, 982, 3215, 3218, 3221, 3224, 3228, 3231, 3234, 954, 3237, 3240, 933, 3244,
+    0, 0, 3246, 3250, 3253, 0, 3257, 3260, 3264, 951, 3267, 957, 3270, 15, 3273, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 3276, 0, 0, 0, 0, 0, 3278, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3281, 3283, 3286, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 3290, 3293, 0, 3297, 3300, 0, 0, 0, 0, 3304, 0, 3307, 0,
+    0, 0, 0, 0, 0, 0, 0, 3310, 3313, 3316, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 3319, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3324, 1557, 0, 0, 3326, 3328, 3330, 3332, 3334, 3336, 3338, 3340, 3342, 3344, 3346, 3348,
+    3324, 23, 11, 13, 3326, 3328, 3330, 3332, 3334, 3336, 3338, 3340, 3342, 3344, 3346, 0,
+    6, 1515, 25, 913, 1517, 873, 1525, 911, 1527, 3348, 1537, 537, 1539, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3350, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3353, 3357, 3361, 3363, 0, 3366, 3370, 3374, 0, 3376, 1523, 1477, 1477, 1477, 873, 3379,
+    1479, 1479, 1485, 911, 0, 1489, 3381, 0, 0, 1495, 3384, 1497, 1497, 1497, 0, 0,
+    3386, 3389, 3393, 0, 3396, 0, 3398, 0, 3396, 0, 1483, 54, 1467, 3361, 0, 1515,
+    1471, 3400, 0, 1487, 25, 3402, 3404, 3406, 3408, 1557, 0, 3410, 1009, 1551, 3414, 3416,
+    3418, 0, 0, 0, 0, 1469, 1513, 1515, 1557, 877, 0, 0, 0, 0, 0, 0,
+    3420, 3424, 3428, 3433, 3437, 3441, 3445, 3449, 3453, 3457, 3461, 3465, 3469, 3473, 3477, 3481,
+    1479, 3484, 3487, 3491, 3494, 3496, 3499, 3503, 3508, 3511, 3513, 3516, 1485, 3361, 1469, 1487,
+    1557, 3520, 3523, 3527, 1547, 3530, 3533, 3537, 3542, 913, 3545, 3548, 911, 1563, 1513, 1527,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3552, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3556, 3559, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3562, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3565, 3568, 3571,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3574, 0, 0, 0, 0, 3577, 0, 0, 3580, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3583, 0, 3586, 0, 0, 0, 0, 0, 3589, 3592, 0, 3596,
+    3599, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3603, 0, 0, 3606, 0, 0, 3609, 0, 3612, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3615, 0, 3618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3621, 3624, 3627,
+    3630, 3633, 0, 0, 3636, 3639, 0, 0, 3642, 3645, 0, 0, 0, 0, 0, 0,
+    3648, 3651, 0, 0, 3654, 3657, 0, 0, 3660, 3663, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3666, 3669, 3672, 3675,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3678, 3681, 3684, 3687, 0, 0, 0, 0, 0, 0, 3690, 3693, 3696, 3699, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3702, 3704, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    23, 11, 13, 3326, 3328, 3330, 3332, 3334, 3336, 3706, 3709, 3712, 3715, 3718, 3721, 3724,
+    3727, 3730, 3733, 3736, 3739, 3743, 3747, 3751, 3755, 3759, 3763, 3767, 3771, 3775, 3780, 3785,
+    3790, 3795, 3800, 3805, 3810, 3815, 3820, 3825, 3830, 3833, 3836, 3839, 3842, 3845, 3848, 3851,
+    3854, 3857, 3861, 3865, 3869, 3873, 3877, 3881, 3885, 3889, 3893, 3897, 3901, 3905, 3909, 3913,
+    3917, 3921, 3925, 3929, 3933, 3937, 3941, 3945, 3949, 3953, 3957, 3961, 3965, 3969, 3973, 3977,
+    3981, 3985, 3989, 3993, 3997, 4001, 1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481,
+    1483, 1485, 1487, 1489, 1491, 1495, 3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396,
+    6, 1511, 1563, 1513, 1515, 1569, 1523, 873, 1557, 877, 1525, 911, 1527, 3348, 25, 1537,
+    4009, 879, 537, 1539, 1541, 1547, 887, 913, 889, 1623, 3324, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4011, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4016, 4020, 4023, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4027, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 877, 3494, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4030,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4032,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4034, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4036, 4038, 4040, 4042, 4044, 4046, 4048, 4050, 4052, 4054, 4056, 4058, 4060, 4062, 4064, 4066,
+    4068, 4070, 4072, 4074, 4076, 4078, 4080, 4082, 4084, 4086, 4088, 4090, 4092, 4094, 4096, 4098,
+    4100, 4102, 4104, 4106, 4108, 4110, 4112, 4114, 4116, 4118, 4120, 4122, 4124, 4126, 4128, 4130,
+    4132, 4134, 4136, 4138, 4140, 4142, 4144, 4146, 4148, 4150, 4152, 4154, 4156, 4158, 4160, 4162,
+    4164, 4166, 4168, 4170, 4172, 4174, 4176, 4178, 4180, 4182, 4184, 4186, 4188, 4190, 4192, 4194,
+    4196, 4198, 4200, 4202, 4204, 4206, 4208, 4210, 4212, 4214, 4216, 4218, 4220, 4222, 4224, 4226,
+    4228, 4230, 4232, 4234, 4236, 4238, 4240, 4242, 4244, 4246, 4248, 4250, 4252, 4254, 4256, 4258,
+    4260, 4262, 4264, 4266, 4268, 4270, 4272, 4274, 4276, 4278, 4280, 4282, 4284, 4286, 4288, 4290,
+    4292, 4294, 4296, 4298, 4300, 4302, 4304, 4306, 4308, 4310, 4312, 4314, 4316, 4318, 4320, 4322,
+    4324, 4326, 4328, 4330, 4332, 4334, 4336, 4338, 4340, 4342, 4344, 4346, 4348, 4350, 4352, 4354,
+    4356, 4358, 4360, 4362, 4364, 4366, 4368, 4370, 4372, 4374, 4376, 4378, 4380, 4382, 4384, 4386,
+    4388, 4390, 4392, 4394, 4396, 4398, 4400, 4402, 4404, 4406, 4408, 4410, 4412, 4414, 4416, 4418,
+    4420, 4422, 4424, 4426, 4428, 4430, 4432, 4434, 4436, 4438, 4440, 4442, 4444, 4446, 4448, 4450,
+    4452, 4454, 4456, 4458, 4460, 4462, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4464, 0, 4082, 4466, 4468, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4470, 0, 4473, 0,
+    4476, 0, 4479, 0, 4482, 0, 4485, 0, 4488, 0, 4491, 0, 4494, 0, 4497, 0,
+    4500, 0, 4503, 0, 0, 4506, 0, 4509, 0, 4512, 0, 0, 0, 0, 0, 0,
+    4515, 4518, 0, 4521, 4524, 0, 4527, 4530, 0, 4533, 4536, 0, 4539, 4542, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4545, 0, 0, 0, 0, 0, 0, 4548, 4551, 0, 4554, 4557,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4560, 0, 4563, 0,
+    4566, 0, 4569, 0, 4572, 0, 4575, 0, 4578, 0, 4581, 0, 4584, 0, 4587, 0,
+    4590, 0, 4593, 0, 0, 4596, 0, 4599, 0, 4602, 0, 0, 0, 0, 0, 0,
+    4605, 4608, 0, 4611, 4614, 0, 4617, 4620, 0, 4623, 4626, 0, 4629, 4632, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4635, 0, 0, 4638, 4641, 4644, 4647, 0, 0, 0, 4650, 4653,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4656, 4658, 4660, 4662, 4664, 4666, 4668, 4670, 4672, 4674, 4676, 4678, 4680, 4682, 4684,
+    4686, 4688, 4690, 4692, 4694, 4696, 4698, 4700, 4702, 4704, 4706, 4708, 4710, 4712, 4714, 4716,
+    4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734, 4736, 4738, 4740, 4742, 4744, 4746, 4748,
+    4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764, 4766, 4768, 4770, 4772, 4774, 4776, 4778, 4780,
+    4782, 4784, 4786, 4788, 4790, 4792, 4794, 4796, 4798, 4800, 4802, 4804, 4806, 4808, 4810, 4812,
+    4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830, 4832, 4834, 4836, 4838, 4840, 4842, 0,
+    0, 0, 4036, 4048, 4844, 4846, 4848, 4850, 4852, 4854, 4044, 4856, 4858, 4860, 4862, 4052,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4864, 4868, 4872, 4876, 4880, 4884, 4888, 4892, 4896, 4900, 4904, 4908, 4912, 4916, 4920, 4925,
+    4930, 4935, 4940, 4945, 4950, 4955, 4960, 4965, 4970, 4975, 4980, 4985, 4990, 4995, 5003, 0,
+    5010, 5014, 5018, 5022, 5026, 5030, 5034, 5038, 5042, 5046, 5050, 5054, 5058, 5062, 5066, 5070,
+    5074, 5078, 5082, 5086, 5090, 5094, 5098, 5102, 5106, 5110, 5114, 5118, 5122, 5126, 5130, 5134,
+    5138, 5142, 5146, 5150, 5154, 5156, 4168, 5158, 0, 0, 0, 0, 0, 0, 0, 0,
+    5160, 5164, 5167, 5170, 5173, 5176, 5179, 5182, 5185, 5188, 5191, 5194, 5197, 5200, 5203, 5206,
+    4656, 4662, 4668, 4672, 4688, 4690, 4696, 4700, 4702, 4706, 4708, 4710, 4712, 4714, 5209, 5212,
+    5215, 5218, 5221, 5224, 5227, 5230, 5233, 5236, 5239, 5242, 5245, 5248, 5251, 5257, 5262, 0,
+    4036, 4048, 4844, 4846, 5265, 5267, 5269, 4058, 5271, 4082, 4182, 4206, 4204, 4184, 4368, 4098,
+    4178, 5273, 5275, 5277, 5279, 5281, 5283, 5285, 5287, 5289, 5291, 4110, 5293, 5295, 5297, 5299,
+    5301, 5303, 5305, 5307, 4848, 4850, 4852, 5309, 5311, 5313, 5315, 5317, 5319, 5321, 5323, 5325,
+    5327, 5329, 5332, 5335, 5338, 5341, 5344, 5347, 5350, 5353, 5356, 5359, 5362, 5365, 5368, 5371,
+    5374, 5377, 5380, 5383, 5386, 5389, 5392, 5395, 5398, 5401, 5405, 5409, 5413, 5416, 5420, 5423,
+    5427, 5429, 5431, 5433, 5435, 5437, 5439, 5441, 5443, 5445, 5447, 5449, 5451, 5453, 5455, 5457,
+    5459, 5461, 5463, 5465, 5467, 5469, 5471, 5473, 5475, 5477, 5479, 5481, 5483, 5485, 5487, 5489,
+    5491, 5493, 5495, 5497, 5499, 5501, 5503, 5505, 5507, 5509, 5511, 5513, 5515, 5517, 5519, 5521,
+    5524, 5530, 5535, 5541, 5545, 5551, 5555, 5559, 5566, 5571, 5575, 5579, 5583, 5588, 5593, 5598,
+    5603, 5608, 5613, 5618, 5625, 5628, 5635, 5642, 5648, 5653, 5660, 5667, 5672, 5676, 5680, 5685,
+    5690, 5696, 5702, 5706, 5710, 5715, 5719, 5723, 5726, 5729, 5733, 5737, 5744, 5749, 5755, 5762,
+    5767, 5771, 5775, 5782, 5787, 5794, 5798, 5804, 5808, 5813, 5817, 5822, 5828, 5833, 5839, 5844,
+    5847, 5853, 5857, 5861, 5866, 5870, 5874, 5878, 5884, 5889, 5892, 5899, 5903, 5909, 5914, 5919,
+    5923, 5927, 5932, 5935, 5940, 5946, 5949, 5956, 5960, 5963, 5966, 5969, 5972, 5975, 5978, 5981,
+    5984, 5987, 5990, 5994, 5998, 6002, 6006, 6010, 6014, 6018, 6022, 6026, 6030, 6034, 6038, 6042,
+    6046, 6050, 6054, 6057, 6060, 6064, 6067, 6070, 6073, 6077, 6081, 6084, 6087, 6090, 6093, 6096,
+    6101, 6104, 6107, 6110, 6113, 6116, 6119, 6122, 6125, 6129, 6134, 6137, 6140, 6143, 6146, 6149,
+    6152, 6155, 6159, 6163, 6167, 6171, 6174, 6177, 6180, 6183, 6186, 6189, 6192, 6195, 6198, 6201,
+    6205, 6209, 6212, 6216, 6220, 6224, 6227, 6231, 6235, 6240, 6243, 6247, 6251, 6255, 6259, 6265,
+    6272, 6275, 6278, 6281, 6284, 6287, 6290, 6293, 6296, 6299, 6302, 6305, 6308, 6311, 6314, 6317,
+    6320, 6323, 6326, 6331, 6334, 6337, 6340, 6345, 6349, 6352, 6355, 6358, 6361, 6364, 6367, 6370,
+    6373, 6376, 6379, 6383, 6386, 6389, 6393, 6397, 6400, 6405, 6409, 6412, 6415, 6418, 6421, 6425,
+    6429, 6432, 6435, 6438, 6441, 6444, 6447, 6450, 6453, 6456, 6460, 6464, 6468, 6472, 6476, 6480,
+    6484, 6488, 6492, 6496, 6500, 6504, 6508, 6512, 6516, 6520, 6524, 6528, 6532, 6536, 6540, 6544,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6548, 6550, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6552, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3361, 3400, 3384, 0, 0, 0, 6554, 6556, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6558, 6560, 6562, 6564,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6566, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6568, 6570, 4352, 6572, 6574, 6576, 6578, 4460, 4460, 6580, 4368, 6582, 6584, 6586, 6588, 6590,
+    6592, 6594, 6596, 6598, 6600, 6602, 6604, 6606, 6608, 6610, 6612, 6614, 6616, 6618, 6620, 6622,
+    6624, 6626, 6628, 6630, 6632, 6634, 6636, 6638, 6640, 6642, 6644, 6646, 6648, 6650, 6652, 6654,
+    6656, 6658, 6660, 6662, 4284, 6664, 6666, 6668, 6670, 6672, 6674, 6676, 6678, 6680, 6682, 6684,
+    4430, 6686, 6688, 6690, 6692, 6694, 6696, 6698, 6700, 6702, 6704, 6706, 6708, 6710, 6712, 6714,
+    6716, 6718, 6720, 6722, 6724, 6726, 6728, 6730, 6732, 6734, 6736, 6738, 6600, 6740, 6742, 6744,
+    6746, 6748, 6750, 6752, 6754, 6756, 6758, 6760, 6762, 6764, 6766, 6768, 6770, 6772, 6774, 6776,
+    6778, 4356, 6780, 6782, 6784, 6786, 6788, 6790, 6792, 6794, 6796, 6798, 6800, 6802, 6804, 6806,
+    6808, 4110, 6810, 6812, 6814, 6816, 6818, 6820, 6822, 6824, 4072, 6826, 6828, 6830, 6832, 6834,
+    6836, 6838, 6840, 6842, 6844, 6846, 6848, 6850, 6852, 6854, 6856, 6858, 6860, 6862, 6864, 6866,
+    6868, 6776, 6870, 6872, 6874, 6876, 6878, 6880, 6882, 6884, 6744, 6886, 6888, 6890, 6892, 6894,
+    6896, 6898, 6900, 6902, 6904, 6906, 6908, 6910, 6912, 6914, 6916, 6918, 6920, 6922, 6924, 6600,
+    6926, 6928, 6930, 6932, 4458, 6934, 6936, 6938, 6940, 6942, 6944, 6946, 6948, 6950, 6952, 6954,
+    6956, 5267, 6958, 6960, 6962, 6964, 6966, 6968, 6970, 6972, 6974, 6748, 6976, 6978, 6980, 6982,
+    6984, 6986, 6988, 6990, 6992, 6994, 6996, 6998, 7000, 4366, 7002, 7004, 7006, 7008, 7010, 7012,
+    7014, 7016, 7018, 7020, 7022, 7024, 7026, 4268, 7028, 7030, 7032, 7034, 7036, 7038, 7040, 7042,
+    7044, 7046, 7048, 7050, 7052, 7054, 7056, 7058, 4322, 7060, 4328, 7062, 7064, 7066, 0, 0,
+    7068, 0, 7070, 0, 0, 7072, 7074, 7076, 7078, 7080, 7082, 7084, 7086, 7088, 4282, 0,
+    7090, 0, 7092, 0, 0, 7094, 7096, 0, 0, 0, 7098, 7100, 7102, 7104, 7106, 7108,
+    7110, 7112, 7114, 7116, 7118, 7120, 7122, 7124, 7126, 7128, 7130, 7132, 4124, 7134, 7136, 7138,
+    7140, 7142, 7144, 7146, 7148, 7150, 7152, 7154, 7156, 7158, 7160, 7162, 5277, 7164, 7166, 7168,
+    7170, 5285, 7172, 7174, 7176, 7178, 7180, 6848, 7182, 7184, 7186, 7188, 7190, 7192, 7192, 7194,
+    7196, 7198, 7200, 7202, 7204, 7206, 7208, 7094, 7210, 7212, 7214, 7216, 7218, 7221, 0, 0,
+    7223, 7225, 7227, 7229, 7231, 7233, 7235, 7237, 7122, 7239, 7241, 7243, 7068, 7245, 7247, 7249,
+    7251, 7253, 7255, 7257, 7259, 7261, 7263, 7265, 7267, 7138, 7269, 7140, 7271, 7273, 7275, 7277,
+    7279, 7070, 6642, 7281, 7283, 4190, 6778, 6944, 7285, 7287, 7154, 7289, 7156, 7291, 7293, 7295,
+    7074, 7297, 7299, 7301, 7303, 7305, 7076, 7307, 7309, 7311, 7313, 7315, 7317, 7180, 7319, 7321,
+    6848, 7323, 7188, 7325, 7327, 7329, 7331, 7333, 7198, 7335, 7092, 7337, 7200, 6740, 7339, 7202,
+    7341, 7206, 7343, 7345, 7347, 7349, 7351, 7210, 7086, 7353, 7212, 7355, 7214, 7357, 4460, 7359,
+    7362, 7365, 7368, 7370, 7372, 7374, 7377, 7380, 7383, 7385, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7387, 7390, 7393, 7396, 7400, 7404, 7404, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7407, 7410, 7413, 7416, 7419, 0, 0, 0, 0, 0, 7422, 0, 7425,
+    7428, 3402, 3408, 7430, 7432, 7434, 7436, 7438, 7440, 3338, 7442, 7445, 7448, 7452, 7456, 7459,
+    7462, 7465, 7468, 7471, 7474, 7477, 7480, 0, 7483, 7486, 7489, 7492, 7495, 0, 7498, 0,
+    7501, 7504, 0, 7507, 7510, 0, 7513, 7516, 7519, 7522, 7525, 7528, 7531, 7534, 7537, 7540,
+    7543, 7543, 7545, 7545, 7545, 7545, 7547, 7547, 7547, 7547, 7549, 7549, 7549, 7549, 7551, 7551,
+    7551, 7551, 7553, 7553, 7553, 7553, 7555, 7555, 7555, 7555, 7557, 7557, 7557, 7557, 7559, 7559,
+    7559, 7559, 7561, 7561, 7561, 7561, 7563, 7563, 7563, 7563, 7565, 7565, 7565, 7565, 7567, 7567,
+    7567, 7567, 7569, 7569, 7571, 7571, 7573, 7573, 7575, 7575, 7577, 7577, 7579, 7579, 7581, 7581,
+    7581, 7581, 7583, 7583, 7583, 7583, 7585, 7585, 7585, 7585, 7587, 7587, 7587, 7587, 7589, 7589,
+    7591, 7591, 7591, 7591, 1209, 1209, 7593, 7593, 7593, 7593, 7595, 7595, 7595, 7595, 7597, 7597,
+    1215, 1215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7599, 7599, 7599, 7599, 7601, 7601, 7603, 7603, 7605, 7605, 1203, 7607, 7607,
+    7609, 7609, 7611, 7611, 7613, 7613, 7613, 7613, 7615, 7615, 7617, 7617, 7621, 7621, 7625, 7625,
+    7629, 7629, 7633, 7633, 7637, 7637, 7641, 7641, 7641, 7645, 7645, 7645, 7649, 7649, 7649, 7649,
+    7651, 7655, 7659, 7645, 7663, 7667, 7670, 7673, 7676, 7679, 7682, 7685, 7688, 7691, 7694, 7697,
+    7700, 7703, 7706, 7709, 7712, 7715, 7718, 7721, 7724, 7727, 7730, 7733, 7736, 7739, 7742, 7745,
+    7748, 7751, 7754, 7757, 7760, 7763, 7766, 7769, 7772, 7775, 7778, 7781, 7784, 7787, 7790, 7793,
+    7796, 7799, 7802, 7805, 7808, 7811, 7814, 7817, 7820, 7823, 7826, 7829, 7832, 7835, 7838, 7841,
+    7844, 7847, 7850, 7853, 7856, 7859, 7862, 7865, 7868, 7871, 7874, 7877, 7880, 7883, 7886, 7889,
+    7892, 7895, 7898, 7901, 7904, 7907, 7910, 7913, 7916, 7919, 7922, 7925, 7928, 7931, 7934, 7938,
+    7942, 7946, 7950, 7954, 7958, 7962, 7659, 7966, 7645, 7663, 7970, 7973, 7676, 7976, 7679, 7682,
+    7979, 7982, 7694, 7985, 7697, 7700, 7988, 7991, 7706, 7994, 7709, 7712, 7799, 7802, 7811, 7814,
+    7817, 7829, 7832, 7835, 7838, 7850, 7853, 7856, 7997, 7868, 8000, 8003, 7886, 8006, 7889, 7892,
+    7931, 8009, 8012, 7916, 8015, 7919, 7922, 7651, 7655, 8018, 7659, 8022, 7667, 7670, 7673, 7676,
+    8026, 7685, 7688, 7691, 7694, 8029, 7706, 7715, 7718, 7721, 7724, 7727, 7733, 7736, 7739, 7742,
+    7745, 7748, 8032, 7751, 7754, 7757, 7760, 7763, 7766, 7772, 7775, 7778, 7781, 7784, 7787, 7790,
+    7793, 7796, 7805, 7808, 7820, 7823, 7826, 7829, 7832, 7841, 7844, 7847, 7850, 8035, 7859, 7862,
+    7865, 7868, 7877, 7880, 7883, 7886, 8038, 7895, 7898, 8041, 7907, 7910, 7913, 7916, 8044, 7659,
+    8022, 7676, 8026, 7694, 8029, 7706, 8047, 7745, 8050, 8053, 8056, 7829, 7832, 7850, 7886, 8038,
+    7916, 8044, 8059, 8063, 8067, 8071, 8074, 8077, 8080, 8083, 8086, 8089, 8092, 8095, 8098, 8101,
+    8104, 8107, 8110, 8113, 8116, 8119, 8122, 8125, 8128, 8131, 8134, 8137, 8053, 8140, 8143, 8146,
+    8149, 8071, 8074, 8077, 8080, 8083, 8086, 8089, 8092, 8095, 8098, 8101, 8104, 8107, 8110, 8113,
+    8116, 8119, 8122, 8125, 8128, 8131, 8134, 8137, 8053, 8140, 8143, 8146, 8149, 8131, 8134, 8137,
+    8053, 8050, 8056, 7769, 7736, 7739, 7742, 8131, 8134, 8137, 7769, 7772, 8152, 8152, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8155, 8159, 8159, 8163, 8167, 8171, 8175, 8179, 8183, 8183, 8187, 8191, 8195, 8199, 8203, 8207,
+    8207, 8211, 8215, 8215, 8219, 8219, 8223, 8227, 8227, 8231, 8235, 8235, 8239, 8239, 8243, 8247,
+    8247, 8251, 8251, 8255, 8259, 8263, 8267, 8267, 8271, 8275, 8279, 8283, 8287, 8287, 8291, 8295,
+    8299, 8303, 8307, 8311, 8311, 8315, 8315, 8319, 8319, 8323, 8327, 8331, 8335, 8339, 8343, 8347,
+    0, 0, 8351, 8355, 8359, 8363, 8367, 8371, 8371, 8375, 8379, 8383, 8387, 8387, 8391, 8395,
+    8399, 8403, 8407, 8411, 8415, 8419, 8423, 8427, 8431, 8435, 8439, 8443, 8447, 8451, 8455, 8459,
+    8463, 8467, 8471, 8475, 8291, 8299, 8479, 8483, 8487, 8491, 8495, 8499, 8495, 8487, 8503, 8507,
+    8511, 8515, 8519, 8499, 8263, 8223, 8523, 8527, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8531, 8535, 8539, 8544, 8549, 8554, 8559, 8564, 8569, 8574, 8578, 8597, 8606, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8611, 8613, 8615, 8617, 931, 8619, 8621, 8623, 8625, 3286, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3283, 8627, 8629, 8631, 8631, 3344, 3346, 8633, 8635, 8637, 8639, 8641, 8643, 8645, 8647, 3702,
+    3704, 8649, 8651, 8653, 8655, 0, 0, 8657, 8659, 3307, 3307, 3307, 3307, 8631, 8631, 8631,
+    8611, 8613, 3281, 0, 931, 8617, 8621, 8619, 8627, 3344, 3346, 8633, 8635, 8637, 8639, 8661,
+    8663, 8665, 3338, 8667, 8669, 8671, 3342, 0, 8673, 8675, 8677, 8679, 0, 0, 0, 0,
+    8681, 8684, 8687, 0, 8690, 0, 8693, 8696, 8699, 8702, 8705, 8708, 8711, 8714, 8717, 8720,
+    8723, 1182, 1182, 1185, 1185, 1188, 1188, 1191, 1191, 1194, 1194, 1194, 1194, 8725, 8725, 8727,
+    8727, 8727, 8727, 8729, 8729, 8731, 8731, 8731, 8731, 8733, 8733, 8733, 8733, 8735, 8735, 8735,
+    8735, 8737, 8737, 8737, 8737, 8739, 8739, 8739, 8739, 8741, 8741, 8743, 8743, 8745, 8745, 8747,
+    8747, 8749, 8749, 8749, 8749, 8751, 8751, 8751, 8751, 8753, 8753, 8753, 8753, 8755, 8755, 8755,
+    8755, 8757, 8757, 8757, 8757, 8759, 8759, 8759, 8759, 8761, 8761, 8761, 8761, 8763, 8763, 8763,
+    8763, 8765, 8765, 8765, 8765, 8767, 8767, 8767, 8767, 8769, 8769, 8769, 8769, 8771, 8771, 8771,
+    8771, 8773, 8773, 8773, 8773, 8775, 8775, 8775, 8775, 8777, 8777, 8777, 8777, 8779, 8779, 7615,
+    7615, 8781, 8781, 8781, 8781, 8783, 8783, 8787, 8787, 8791, 8791, 8795, 8795, 0, 0, 0,
+    0, 8619, 8798, 8661, 8675, 8677, 8663, 8800, 3344, 3346, 8665, 3338, 8611, 8667, 3281, 8802,
+    3324, 23, 11, 13, 3326, 3328, 3330, 3332, 3334, 3336, 8617, 931, 8669, 3342, 8671, 8621,
+    8679, 1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 1491,
+    1495, 3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396, 8657, 8673, 8659, 8804, 8631,
+    3244, 6, 1511, 1563, 1513, 1515, 1569, 1523, 873, 1557, 877, 1525, 911, 1527, 3348, 25,
+    1537, 4009, 879, 537, 1539, 1541, 1547, 887, 913, 889, 1623, 8633, 8806, 8635, 8808, 8810,
+    8812, 8615, 8649, 8651, 8613, 8814, 5519, 8816, 8818, 8820, 8822, 8824, 8826, 8828, 8830, 8832,
+    8834, 5427, 5429, 5431, 5433, 5435, 5437, 5439, 5441, 5443, 5445, 5447, 5449, 5451, 5453, 5455,
+    5457, 5459, 5461, 5463, 5465, 5467, 5469, 5471, 5473, 5475, 5477, 5479, 5481, 5483, 5485, 5487,
+    5489, 5491, 5493, 5495, 5497, 5499, 5501, 5503, 5505, 5507, 5509, 5511, 5513, 8836, 8838, 8840,
+    4758, 4656, 4658, 4660, 4662, 4664, 4666, 4668, 4670, 4672, 4674, 4676, 4678, 4680, 4682, 4684,
+    4686, 4688, 4690, 4692, 4694, 4696, 4698, 4700, 4702, 4704, 4706, 4708, 4710, 4712, 4714, 0,
+    0, 0, 4716, 4718, 4720, 4722, 4724, 4726, 0, 0, 4728, 4730, 4732, 4734, 4736, 4738,
+    0, 0, 4740, 4742, 4744, 4746, 4748, 4750, 0, 0, 4752, 4754, 4756, 0, 0, 0,
+    8842, 8844, 8846, 8, 8848, 8850, 8852, 0, 8854, 8856, 8858, 8860, 8862, 8864, 8866, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8868, 8870, 8872, 8874, 8876, 0, 8878, 8880, 8882, 8884, 8886, 8888, 8890, 8892, 8894,
+    8896, 8898, 8900, 8902, 8904, 3379, 8906, 8908, 8910, 8912, 8914, 8916, 8918, 8921, 8923, 8925,
+    8928, 8930, 8933, 8935, 8937, 4009, 8939, 8941, 8944, 8946, 8948, 8950, 8952, 8954, 8956, 8958,
+    8960, 0, 8962, 8964, 8966, 8968, 8970, 8972, 8974, 8976, 8979, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8982, 0, 8987, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8992, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8997, 9002,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9007, 9012, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9017, 9022, 0, 9027, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9032, 9037, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 9042, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9047, 9052,
+    9057, 9064, 9071, 9078, 9085, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9092, 9097, 9102, 9109, 9116,
+    9123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495,
+    3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396, 6, 1511, 1563, 1513, 1515, 1569,
+    1523, 873, 1557, 877, 1525, 911, 1527, 3348, 25, 1537, 4009, 879, 537, 1539, 1541, 1547,
+    887, 913, 889, 1623, 1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485,
+    1487, 1489, 1491, 1495, 3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396, 6, 1511,
+    1563, 1513, 1515, 1569, 1523, 0, 1557, 877, 1525, 911, 1527, 3348, 25, 1537, 4009, 879,
+    537, 1539, 1541, 1547, 887, 913, 889, 1623, 1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477,
+    1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495, 3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511,
+    4007, 3396, 6, 1511, 1563, 1513, 1515, 1569, 1523, 873, 1557, 877, 1525, 911, 1527, 3348,
+    25, 1537, 4009, 879, 537, 1539, 1541, 1547, 887, 913, 889, 1623, 1463, 0, 3361, 1469,
+    0, 0, 1475, 0, 0, 1481, 1483, 0, 0, 1489, 1491, 1495, 3384, 0, 4005, 1499,
+    1501, 3494, 1503, 3511, 4007, 3396, 6, 1511, 1563, 1513, 0, 1569, 0, 873, 1557, 877,
+    1525, 911, 1527, 3348, 0, 1537, 4009, 879, 537, 1539, 1541, 1547, 887, 913, 889, 1623,
+    1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495,
+    3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396, 6, 1511, 1563, 1513, 1515, 1569,
+    1523, 873, 1557, 877, 1525, 911, 1527, 3348, 25, 1537, 4009, 879, 537, 1539, 1541, 1547,
+    887, 913, 889, 1623, 1463, 1467, 0, 1469, 1471, 3400, 1475, 0, 0, 1481, 1483, 1485,
+    1487, 1489, 1491, 1495, 3384, 0, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 0, 6, 1511,
+    1563, 1513, 1515, 1569, 1523, 873, 1557, 877, 1525, 911, 1527, 3348, 25, 1537, 4009, 879,
+    537, 1539, 1541, 1547, 887, 913, 889, 1623, 1463, 1467, 0, 1469, 1471, 3400, 1475, 0,
+    1479, 1481, 1483, 1485, 1487, 0, 1491, 0, 0, 0, 4005, 1499, 1501, 3494, 1503, 3511,
+    4007, 0, 6, 1511, 1563, 1513, 1515, 1569, 1523, 873, 1557, 877, 1525, 911, 1527, 3348,
+    25, 1537, 4009, 879, 537, 1539, 1541, 1547, 887, 913, 889, 1623, 1463, 1467, 3361, 1469,
+    1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495, 3384, 1497, 4005, 1499,
+    1501, 3494, 1503, 3511, 4007, 3396, 6, 1511, 1563, 1513, 1515, 1569, 1523, 873, 1557, 877,
+    1525, 911, 1527, 3348, 25, 1537, 4009, 879, 537, 1539, 1541, 1547, 887, 913, 889, 1623,
+    1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495,
+    3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396, 6, 1511, 1563, 1513, 1515, 1569,
+    1523, 873, 1557, 877, 1525, 911, 1527, 3348, 25, 1537, 4009, 879, 537, 1539, 1541, 1547,
+    887, 913, 889, 1623, 1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485,
+    1487, 1489, 1491, 1495, 3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396, 6, 1511,
+    1563, 1513, 1515, 1569, 1523, 873, 1557, 877, 1525, 911, 1527, 3348, 25, 1537, 4009, 879,
+    537, 1539, 1541, 1547, 887, 913, 889, 1623, 1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477,
+    1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495, 3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511,
+    4007, 3396, 6, 1511, 1563, 1513, 1515, 1569, 1523, 873, 1557, 877, 1525, 911, 1527, 3348,
+    25, 1537, 4009, 879, 537, 1539, 1541, 1547, 887, 913, 889, 1623, 1463, 1467, 3361, 1469,
+    1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495, 3384, 1497, 4005, 1499,
+    1501, 3494, 1503, 3511, 4007, 3396, 6, 1511, 1563, 1513, 1515, 1569, 1523, 873, 1557, 877,
+    1525, 911, 1527, 3348, 25, 1537, 4009, 879, 537, 1539, 1541, 1547, 887, 913, 889, 1623,
+    1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495,
+    3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396, 6, 1511, 1563, 1513, 1515, 1569,
+    1523, 873, 1557, 877, 1525, 911, 1527, 3348, 25, 1537, 4009, 879, 537, 1539, 1541, 1547,
+    887, 913, 889, 1623, 9130, 9132, 0, 0, 9134, 9136, 3414, 9138, 9140, 9142, 9144, 1017,
+    9146, 9148, 9150, 9152, 9154, 9156, 9158, 3416, 9160, 1017, 1021, 9162, 1005, 9164, 9166, 9168,
+    3398, 9170, 9172, 1001, 1551, 1553, 1019, 9174, 9176, 1003, 3119, 1011, 9178, 18, 9180, 9182,
+    9184, 1009, 1013, 1015, 9186, 9188, 9190, 1007, 1555, 9192, 9194, 9196, 1019, 1003, 1011, 1007,
+    1013, 1009, 9134, 9136, 3414, 9138, 9140, 9142, 9144, 1017, 9146, 9148, 9150, 9152, 9154, 9156,
+    9158, 3416, 9160, 1017, 1021, 9162, 1005, 9164, 9166, 9168, 3398, 9170, 9172, 1001, 1551, 1553,
+    1019, 9174, 9176, 1003, 3119, 1011, 9178, 18, 9180, 9182, 9184, 1009, 1013, 1015, 9186, 9188,
+    9190, 1007, 1555, 9192, 9194, 9196, 1019, 1003, 1011, 1007, 1013, 1009, 9134, 9136, 3414, 9138,
+    9140, 9142, 9144, 1017, 9146, 9148, 9150, 9152, 9154, 9156, 9158, 3416, 9160, 1017, 1021, 9162,
+    1005, 9164, 9166, 9168, 3398, 9170, 9172, 1001, 1551, 1553, 1019, 9174, 9176, 1003, 3119, 1011,
+    9178, 18, 9180, 9182, 9184, 1009, 1013, 1015, 9186, 9188, 9190, 1007, 1555, 9192, 9194, 9196,
+    1019, 1003, 1011, 1007, 1013, 1009, 9134, 9136, 3414, 9138, 9140, 9142, 9144, 1017, 9146, 9148,
+    9150, 9152, 9154, 9156, 9158, 3416, 9160, 1017, 1021, 9162, 1005, 9164, 9166, 9168, 3398, 9170,
+    9172, 1001, 1551, 1553, 1019, 9174, 9176, 1003, 3119, 1011, 9178, 18, 9180, 9182, 9184, 1009,
+    1013, 1015, 9186, 9188, 9190, 1007, 1555, 9192, 9194, 9196, 1019, 1003, 1011, 1007, 1013, 1009,
+    9134, 9136, 3414, 9138, 9140, 9142, 9144, 1017, 9146, 9148, 9150, 9152, 9154, 9156, 9158, 3416,
+    9160, 1017, 1021, 9162, 1005, 9164, 9166, 9168, 3398, 9170, 9172, 1001, 1551, 1553, 1019, 9174,
+    9176, 1003, 3119, 1011, 9178, 18, 9180, 9182, 9184, 1009, 1013, 1015, 9186, 9188, 9190, 1007,
+    1555, 9192, 9194, 9196, 1019, 1003, 1011, 1007, 1013, 1009, 9198, 9200, 0, 0, 3324, 23,
+    11, 13, 3326, 3328, 3330, 3332, 3334, 3336, 3324, 23, 11, 13, 3326, 3328, 3330, 3332,
+    3334, 3336, 3324, 23, 11, 13, 3326, 3328, 3330, 3332, 3334, 3336, 3324, 23, 11, 13,
+    3326, 3328, 3330, 3332, 3334, 3336, 3324, 23, 11, 13, 3326, 3328, 3330, 3332, 3334, 3336,
+    8725, 8727, 8735, 8741, 0, 8779, 8747, 8737, 8757, 8781, 8769, 8771, 8773, 8775, 8749, 8761,
+    8765, 8753, 8767, 8745, 8751, 8731, 8733, 8739, 8743, 8755, 8759, 8763, 9202, 7589, 9204, 9206,
+    0, 8727, 8735, 0, 8777, 0, 0, 8737, 0, 8781, 8769, 8771, 8773, 8775, 8749, 8761,
+    8765, 8753, 8767, 0, 8751, 8731, 8733, 8739, 0, 8755, 0, 8763, 0, 0, 0, 0,
+    0, 0, 8735, 0, 0, 0, 0, 8737, 0, 8781, 0, 8771, 0, 8775, 8749, 8761,
+    0, 8753, 8767, 0, 8751, 0, 0, 8739, 0, 8755, 0, 8763, 0, 7589, 0, 9206,
+    0, 8727, 8735, 0, 8777, 0, 0, 8737, 8757, 8781, 8769, 0, 8773, 8775, 8749, 8761,
+    8765, 8753, 8767, 0, 8751, 8731, 8733, 8739, 0, 8755, 8759, 8763, 9202, 0, 9204, 0,
+    8725, 8727, 8735, 8741, 8777, 8779, 8747, 8737, 8757, 8781, 0, 8771, 8773, 8775, 8749, 8761,
+    8765, 8753, 8767, 8745, 8751, 8731, 8733, 8739, 8743, 8755, 8759, 8763, 0, 0, 0, 0,
+    0, 8727, 8735, 8741, 0, 8779, 8747, 8737, 8757, 8781, 0, 8771, 8773, 8775, 8749, 8761,
+    8765, 8753, 8767, 8745, 8751, 8731, 8733, 8739, 8743, 8755, 8759, 8763, 0, 0, 0, 0,
+    9208, 9211, 9214, 9217, 9220, 9223, 9226, 9229, 9232, 9235, 9238, 0, 0, 0, 0, 0,
+    9241, 9245, 9249, 9253, 9257, 9261, 9265, 9269, 9273, 9277, 9281, 9285, 9289, 9293, 9297, 9301,
+    9305, 9309, 9313, 9317, 9321, 9325, 9329, 9333, 9337, 9341, 9345, 3361, 1497, 9349, 9352, 0,
+    1463, 1467, 3361, 1469, 1471, 3400, 1475, 1477, 1479, 1481, 1483, 1485, 1487, 1489, 1491, 1495,
+    3384, 1497, 4005, 1499, 1501, 3494, 1503, 3511, 4007, 3396, 9355, 6299, 9358, 9361, 9364, 9368,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9371, 9374, 9377, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9383, 9386, 5447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4162, 9389, 9391, 4599, 4048, 9393, 9395, 4860, 9397, 9399, 9401, 6924, 9403, 9405, 9407, 9409,
+    9411, 9413, 4234, 9415, 9417, 9419, 9421, 9423, 9425, 4036, 4844, 9427, 5309, 4850, 5311, 9429,
+    4346, 9431, 9433, 9435, 9437, 9439, 5275, 4182, 9441, 9443, 9445, 9447, 0, 0, 0, 0,
+    9449, 9453, 9457, 9461, 9465, 9469, 9473, 9477, 9481, 0, 0, 0, 0, 0, 0, 0,
+    9485, 9487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3324, 23, 11, 13, 3326, 3328, 3330, 3332, 3334, 3336, 0, 0, 0, 0, 0, 0,
+    9489, 9491, 9493, 9495, 9498, 7110, 9500, 9502, 9504, 9506, 7112, 9508, 9510, 9512, 7114, 9515,
+    9517, 9519, 9521, 9524, 9526, 9407, 9528, 9531, 9533, 9535, 9537, 7225, 9539, 4068, 9542, 9544,
+    9546, 9548, 9443, 9550, 9552, 7235, 7116, 7118, 7237, 9554, 9556, 6752, 9558, 7120, 9560, 9562,
+    9564, 9566, 9566, 9566, 9568, 9571, 9573, 9575, 9577, 9580, 9582, 9584, 9586, 9588, 9590, 9592,
+    9594, 9596, 9598, 9600, 9602, 9604, 9604, 7241, 9606, 9608, 9610, 9612, 7124, 9614, 9616, 9618,
+    7044, 9620, 9622, 9624, 9626, 9628, 9630, 9632, 9634, 9636, 9639, 9641, 9643, 9393, 9645, 9647,
+    9649, 9652, 9655, 9657, 9659, 9661, 9663, 9665, 9667, 9669, 9671, 9671, 9673, 9676, 9678, 6744,
+    9680, 9682, 9685, 9687, 9689, 4120, 9691, 9693, 4124, 9695, 9697, 9699, 9702, 9704, 9707, 9709,
+    9711, 9713, 9715, 9717, 9719, 9721, 9723, 9725, 9727, 9729, 9732, 9734, 9736, 9738, 6640, 9740,
+    4144, 9743, 9743, 9746, 9748, 9748, 9750, 9752, 9755, 9758, 9760, 9762, 9764, 9766, 9768, 9770,
+    9772, 9774, 9776, 7134, 9778, 9781, 9783, 9785, 7265, 9785, 9787, 7138, 9789, 9791, 9793, 9795,
+    7140, 6586, 9797, 9799, 9801, 9803, 9805, 9807, 9809, 9812, 9814, 9816, 9818, 9820, 9822, 9825,
+    9827, 9829, 9831, 9833, 9835, 9837, 9839, 9841, 7142, 9843, 9845, 9848, 9850, 9852, 9854, 7146,
+    9856, 9858, 9860, 9862, 9864, 9866, 9868, 9870, 6642, 7281, 9872, 9874, 9876, 9878, 9881, 9883,
+    9885, 9887, 7148, 9889, 9892, 9894, 9896, 7368, 9898, 9900, 9902, 9904, 9906, 9909, 9911, 9913,
+    9915, 9918, 9920, 9922, 9924, 6778, 9926, 9928, 9931, 9934, 9937, 9939, 9942, 9944, 9946, 9948,
+    9950, 7150, 6944, 9952, 9954, 9956, 9958, 9961, 9963, 9965, 9967, 7287, 9969, 9971, 9974, 9976,
+    9978, 9981, 9984, 9986, 7289, 9988, 9990, 9992, 9994, 9996, 9998, 10000, 10003, 10005, 10008, 10010,
+    10013, 7293, 10015, 10017, 10020, 10022, 10024, 10027, 10030, 10032, 10034, 10036, 10038, 10038, 10040, 10042,
+    7297, 10044, 10046, 10048, 10050, 10052, 10055, 10057, 6750, 10060, 10063, 10065, 10068, 10071, 10074, 10076,
+    7309, 10078, 10081, 10084, 10087, 10090, 10092, 10092, 7311, 7372, 10094, 10096, 10098, 10100, 10103, 6676,
+    7315, 10105, 10107, 7170, 10110, 10113, 7084, 10116, 10118, 7176, 10120, 10122, 10124, 10127, 10127, 10130,
+    10132, 10134, 10137, 10139, 10141, 10143, 10146, 10148, 10150, 10152, 10154, 10156, 10159, 10161, 10163, 10165,
+    10167, 10169, 10171, 10174, 10177, 10179, 10182, 10184, 10187, 10189, 7188, 10191, 10194, 10197, 10199, 10202,
+    10204, 10207, 10209, 10211, 10213, 10215, 10217, 10219, 10222, 10225, 10228, 9746, 10231, 10233, 10235, 10237,
+    10239, 10241, 10243, 10245, 10247, 10249, 10251, 10253, 6784, 10256, 10258, 10260, 10262, 10264, 10266, 7194,
+    10268, 10270, 10272, 10274, 10276, 10279, 10282, 10285, 10287, 10289, 10291, 10293, 10296, 10298, 10301, 10303,
+    10305, 10308, 10311, 10313, 6666, 10315, 10317, 10319, 10321, 10323, 10325, 7329, 10327, 10329, 10331, 10333,
+    10335, 10337, 10339, 10341, 4324, 10343, 10346, 10348, 10350, 10352, 10354, 10356, 10359, 10362, 10364, 10366,
+    7339, 7341, 4338, 10368, 10371, 10373, 10375, 10377, 10379, 10382, 10385, 10387, 10389, 10391, 10394, 7343,
+    10396, 10399, 10402, 10404, 10406, 10408, 10411, 10413, 10415, 10417, 10419, 10421, 10423, 10425, 10428, 10430,
+    10432, 10434, 10437, 10439, 10441, 10443, 10445, 10448, 10451, 10453, 10455, 10457, 10460, 10462, 7355, 7355,
+    10465, 10467, 10470, 10472, 10474, 10476, 10478, 10480, 10482, 10484, 7357, 10487, 10489, 10491, 10493, 10495,
+    10497, 10500, 10502, 10505, 10508, 4434, 10511, 4442, 10513, 10515, 10517, 10519, 4452, 10521, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+// The length in UTF-16 code units followed by the code units.
+static uint16_t const nfkc_decomp_units[10524] = {
+    0, 1, 32, 2, 32, 776, 1, 97, 2, 32, 772, 1,
+    50, 1, 51, 2, 32, 769, 1, 956, 2, 32, 807, 1,
+    49, 1, 111, 3, 49, 8260, 52, 3, 49, 8260, 50, 3,
+    51, 8260, 52, 2, 65, 768, 2, 65, 769, 2, 65, 770,
+    2, 65, 771, 2, 65, 776, 2, 65, 778, 2, 67, 807,
+    2, 69, 768, 2, 69, 769, 2, 69, 770, 2, 69, 776,
+    2, 73, 768, 2, 73, 769, 2, 73, 770, 2, 73, 776,
+    2, 78, 771, 2, 79, 768, 2, 79, 769, 2, 79, 770,
+    2, 79, 771, 2, 79, 776, 2, 85, 768, 2, 85, 769,
+    2, 85, 770, 2, 85, 776, 2, 89, 769, 2, 97, 768,
+    2, 97, 769, 2, 97, 770, 2, 97, 771, 2, 97, 776,
+    2, 97, 778, 2, 99, 807, 2, 101, 768, 2, 101, 769,
+    2, 101, 770, 2, 101, 776, 2, 105, 768, 2, 105, 769,
+    2, 105, 770, 2, 105, 776, 2, 110, 771, 2, 111, 768,
+    2, 111, 769, 2, 111, 770, 2, 111, 771, 2, 111, 776,
+    2, 117, 768, 2, 117, 769, 2, 117, 770, 2, 117, 776,
+    2, 121, 769, 2, 121, 776, 2, 65, 772, 2, 97, 772,
+    2, 65, 774, 2, 97, 774, 2, 65, 808, 2, 97, 808,
+    2, 67, 769, 2, 99, 769, 2, 67, 770, 2, 99, 770,
+    2, 67, 775, 2, 99, 775, 2, 67, 780, 2, 99, 780,
+    2, 68, 780, 2, 100, 780, 2, 69, 772, 2, 101, 772,
+    2, 69, 774, 2, 101, 774, 2, 69, 775, 2, 101, 775,
+    2, 69, 808, 2, 101, 808, 2, 69, 780, 2, 101, 780,
+    2, 71, 770, 2, 103, 770, 2, 71, 774, 2, 103, 774,
+    2, 71, 775, 2, 103, 775, 2, 71, 807, 2, 103, 807,
+    2, 72, 770, 2, 104, 770, 2, 73, 771, 2, 105, 771,
+    2, 73, 772, 2, 105, 772, 2, 73, 774, 2, 105, 774,
+    2, 73, 808, 2, 105, 808, 2, 73, 775, 2, 73, 74,
+    2, 105, 106, 2, 74, 770, 2, 106, 770, 2, 75, 807,
+    2, 107, 807, 2, 76, 769, 2, 108, 769, 2, 76, 807,
+    2, 108, 807, 2, 76, 780, 2, 108, 780, 2, 76, 183,
+    2, 108, 183, 2, 78, 769, 2, 110, 769, 2, 78, 807,
+    2, 110, 807, 2, 78, 780, 2, 110, 780, 2, 700, 110,
+    2, 79, 772, 2, 111, 772, 2, 79, 774, 2, 111, 774,
+    2, 79, 779, 2, 111, 779, 2, 82, 769, 2, 114, 769,
+    2, 82, 807, 2, 114, 807, 2, 82, 780, 2, 114, 780,
+    2, 83, 769, 2, 115, 769, 2, 83, 770, 2, 115, 770,
+    2, 83, 807, 2, 115, 807, 2, 83, 780, 2, 115, 780,
+    2, 84, 807, 2, 116, 807, 2, 84, 780, 2, 116, 780,
+    2, 85, 771, 2, 117, 771, 2, 85, 772, 2, 117, 772,
+    2, 85, 774, 2, 117, 774, 2, 85, 778, 2, 117, 778,
+    2, 85, 779, 2, 117, 779, 2, 85, 808, 2, 117, 808,
+    2, 87, 770, 2, 119, 770, 2, 89, 770, 2, 121, 770,
+    2, 89, 776, 2, 90, 769, 2, 122, 769, 2, 90, 775,
+    2, 122, 775, 2, 90, 780, 2, 122, 780, 1, 115, 2,
+    79, 795, 2, 111, 795, 2, 85, 795, 2, 117, 795, 3,
+    68, 90, 780, 3, 68, 122, 780, 3, 100, 122, 780, 2,
+    76, 74, 2, 76, 106, 2, 108, 106, 2, 78, 74, 2,
+    78, 106, 2, 110, 106, 2, 65, 780, 2, 97, 780, 2,
+    73, 780, 2, 105, 780, 2, 79, 780, 2, 111, 780, 2,
+    85, 780, 2, 117, 780, 3, 85, 776, 772, 3, 117, 776,
+    772, 3, 85, 776, 769, 3, 117, 776, 769, 3, 85, 776,
+    780, 3, 117, 776, 780, 3, 85, 776, 768, 3, 117, 776,
+    768, 3, 65, 776, 772, 3, 97, 776, 772, 3, 65, 775,
+    772, 3, 97, 775, 772, 2, 198, 772, 2, 230, 772, 2,
+    71, 780, 2, 103, 780, 2, 75, 780, 2, 107, 780, 2,
+    79, 808, 2, 111, 808, 3, 79, 808, 772, 3, 111, 808,
+    772, 2, 439, 780, 2, 658, 780, 2, 106, 780, 2, 68,
+    90, 2, 68, 122, 2, 100, 122, 2, 71, 769, 2, 103,
+    769, 2, 78, 768, 2, 110, 768, 3, 65, 778, 769, 3,
+    97, 778, 769, 2, 198, 769, 2, 230, 769, 2, 216, 769,
+    2, 248, 769, 2, 65, 783, 2, 97, 783, 2, 65, 785,
+    2, 97, 785, 2, 69, 783, 2, 101, 783, 2, 69, 785,
+    2, 101, 785, 2, 73, 783, 2, 105, 783, 2, 73, 785,
+    2, 105, 785, 2, 79, 783, 2, 111, 783, 2, 79, 785,
+    2, 111, 785, 2, 82, 783, 2, 114, 783, 2, 82, 785,
+    2, 114, 785, 2, 85, 783, 2, 117, 783, 2, 85, 785,
+    2, 117, 785, 2, 83, 806, 2, 115, 806, 2, 84, 806,
+    2, 116, 806, 2, 72, 780, 2, 104, 780, 2, 65, 775,
+    2, 97, 775, 2, 69, 807, 2, 101, 807, 3, 79, 776,
+    772, 3, 111, 776, 772, 3, 79, 771, 772, 3, 111, 771,
+    772, 2, 79, 775, 2, 111, 775, 3, 79, 775, 772, 3,
+    111, 775, 772, 2, 89, 772, 2, 121, 772, 1, 104, 1,
+    614, 1, 106, 1, 114, 1, 633, 1, 635, 1, 641, 1,
+    119, 1, 121, 2, 32, 774, 2, 32, 775, 2, 32, 778,
+    2, 32, 808, 2, 32, 771, 2, 32, 779, 1, 611, 1,
+    108, 1, 120, 1, 661, 1, 768, 1, 769, 1, 787, 2,
+    776, 769, 1, 697, 2, 32, 837, 1, 59, 3, 32, 776,
+    769, 2, 913, 769, 1, 183, 2, 917, 769, 2, 919, 769,
+    2, 921, 769, 2, 927, 769, 2, 933, 769, 2, 937, 769,
+    3, 953, 776, 769, 2, 921, 776, 2, 933, 776, 2, 945,
+    769, 2, 949, 769, 2, 951, 769, 2, 953, 769, 3, 965,
+    776, 769, 2, 953, 776, 2, 965, 776, 2, 959, 769, 2,
+    965, 769, 2, 969, 769, 1, 946, 1, 952, 1, 933, 1,
+    966, 1, 960, 1, 954, 1, 961, 1, 962, 1, 920, 1,
+    949, 1, 931, 2, 1045, 768, 2, 1045, 776, 2, 1043, 769,
+    2, 1030, 776, 2, 1050, 769, 2, 1048, 768, 2, 1059, 774,
+    2, 1048, 774, 2, 1080, 774, 2, 1077, 768, 2, 1077, 776,
+    2, 1075, 769, 2, 1110, 776, 2, 1082, 769, 2, 1080, 768,
+    2, 1091, 774, 2, 1140, 783, 2, 1141, 783, 2, 1046, 774,
+    2, 1078, 774, 2, 1040, 774, 2, 1072, 774, 2, 1040, 776,
+    2, 1072, 776, 2, 1045, 774, 2, 1077, 774, 2, 1240, 776,
+    2, 1241, 776, 2, 1046, 776, 2, 1078, 776, 2, 1047, 776,
+    2, 1079, 776, 2, 1048, 772, 2, 1080, 772, 2, 1048, 776,
+    2, 1080, 776, 2, 1054, 776, 2, 1086, 776, 2, 1256, 776,
+    2, 1257, 776, 2, 1069, 776, 2, 1101, 776, 2, 1059, 772,
+    2, 1091, 772, 2, 1059, 776, 2, 1091, 776, 2, 1059, 779,
+    2, 1091, 779, 2, 1063, 776, 2, 1095, 776, 2, 1067, 776,
+    2, 1099, 776, 2, 1381, 1410, 2, 1575, 1619, 2, 1575, 1620,
+    2, 1608, 1620, 2, 1575, 1621, 2, 1610, 1620, 2, 1575, 1652,
+    2, 1608, 1652, 2, 1735, 1652, 2, 1610, 1652, 2, 1749, 1620,
+    2, 1729, 1620, 2, 1746, 1620, 2, 2344, 2364, 2, 2352, 2364,
+    2, 2355, 2364, 2, 2325, 2364, 2, 2326, 2364, 2, 2327, 2364,
+    2, 2332, 2364, 2, 2337, 2364, 2, 2338, 2364, 2, 2347, 2364,
+    2, 2351, 2364, 2, 2503, 2494, 2, 2503, 2519, 2, 2465, 2492,
+    2, 2466, 2492, 2, 2479, 2492, 2, 2610, 2620, 2, 2616, 2620,
+    2, 2582, 2620, 2, 2583, 2620, 2, 2588, 2620, 2, 2603, 2620,
+    2, 2887, 2902, 2, 2887, 2878, 2, 2887, 2903, 2, 2849, 2876,
+    2, 2850, 2876, 2, 2962, 3031, 2, 3014, 3006, 2, 3015, 3006,
+    2, 3014, 3031, 2, 3142, 3158, 2, 3263, 3285, 2, 3270, 3285,
+    2, 3270, 3286, 2, 3270, 3266, 3, 3270, 3266, 3285, 2, 3398,
+    3390, 2, 3399, 3390, 2, 3398, 3415, 2, 3545, 3530, 2, 3545,
+    3535, 3, 3545, 3535, 3530, 2, 3545, 3551, 2, 3661, 3634, 2,
+    3789, 3762, 2, 3755, 3737, 2, 3755, 3745, 1, 3851, 2, 3906,
+    4023, 2, 3916, 4023, 2, 3921, 4023, 2, 3926, 4023, 2, 3931,
+    4023, 2, 3904, 4021, 2, 3953, 3954, 2, 3953, 3956, 2, 4018,
+    3968, 3, 4018, 3953, 3968, 2, 4019, 3968, 3, 4019, 3953, 3968,
+    2, 3953, 3968, 2, 3986, 4023, 2, 3996, 4023, 2, 4001, 4023,
+    2, 4006, 4023, 2, 4011, 4023, 2, 3984, 4021, 2, 4133, 4142,
+    1, 4316, 2, 6917, 6965, 2, 6919, 6965, 2, 6921, 6965, 2,
+    6923, 6965, 2, 6925, 6965, 2, 6929, 6965, 2, 6970, 6965, 2,
+    6972, 6965, 2, 6974, 6965, 2, 6975, 6965, 2, 6978, 6965, 1,
+    65, 1, 198, 1, 66, 1, 68, 1, 69, 1, 398, 1,
+    71, 1, 72, 1, 73, 1, 74, 1, 75, 1, 76, 1,
+    77, 1, 78, 1, 79, 1, 546, 1, 80, 1, 82, 1,
+    84, 1, 85, 1, 87, 1, 592, 1, 593, 1, 7426, 1,
+    98, 1, 100, 1, 101, 1, 601, 1, 603, 1, 604, 1,
+    103, 1, 107, 1, 109, 1, 331, 1, 596, 1, 7446, 1,
+    7447, 1, 112, 1, 116, 1, 117, 1, 7453, 1, 623, 1,
+    118, 1, 7461, 1, 947, 1, 948, 1, 967, 1, 105, 1,
+    1085, 1, 594, 1, 99, 1, 597, 1, 240, 1, 102, 1,
+    607, 1, 609, 1, 613, 1, 616, 1, 617, 1, 618, 1,
+    7547, 1, 669, 1, 621, 1, 7557, 1, 671, 1, 625, 1,
+    624, 1, 626, 1, 627, 1, 628, 1, 629, 1, 632, 1,
+    642, 1, 643, 1, 427, 1, 649, 1, 650, 1, 7452, 1,
+    651, 1, 652, 1, 122, 1, 656, 1, 657, 1, 658, 2,
+    65, 805, 2, 97, 805, 2, 66, 775, 2, 98, 775, 2,
+    66, 803, 2, 98, 803, 2, 66, 817, 2, 98, 817, 3,
+    67, 807, 769, 3, 99, 807, 769, 2, 68, 775, 2, 100,
+    775, 2, 68, 803, 2, 100, 803, 2, 68, 817, 2, 100,
+    817, 2, 68, 807, 2, 100, 807, 2, 68, 813, 2, 100,
+    813, 3, 69, 772, 768, 3, 101, 772, 768, 3, 69, 772,
+    769, 3, 101, 772, 769, 2, 69, 813, 2, 101, 813, 2,
+    69, 816, 2, 101, 816, 3, 69, 807, 774, 3, 101, 807,
+    774, 2, 70, 775, 2, 102, 775, 2, 71, 772, 2, 103,
+    772, 2, 72, 775, 2, 104, 775, 2, 72, 803, 2, 104,
+    803, 2, 72, 776, 2, 104, 776, 2, 72, 807, 2, 104,
+    807, 2, 72, 814, 2, 104, 814, 2, 73, 816, 2, 105,
+    816, 3, 73, 776, 769, 3, 105, 776, 769, 2, 75, 769,
+    2, 107, 769, 2, 75, 803, 2, 107, 803, 2, 75, 817,
+    2, 107, 817, 2, 76, 803, 2, 108, 803, 3, 76, 803,
+    772, 3, 108, 803, 772, 2, 76, 817, 2, 108, 817, 2,
+    76, 813, 2, 108, 813, 2, 77, 769, 2, 109, 769, 2,
+    77, 775, 2, 109, 775, 2, 77, 803, 2, 109, 803, 2,
+    78, 775, 2, 110, 775, 2, 78, 803, 2, 110, 803, 2,
+    78, 817, 2, 110, 817, 2, 78, 813, 2, 110, 813, 3,
+    79, 771, 769, 3, 111, 771, 769, 3, 79, 771, 776, 3,
+    111, 771, 776, 3, 79, 772, 768, 3, 111, 772, 768, 3,
+    79, 772, 769, 3, 111, 772, 769, 2, 80, 769, 2, 112,
+    769, 2, 80, 775, 2, 112, 775, 2, 82, 775, 2, 114,
+    775, 2, 82, 803, 2, 114, 803, 3, 82, 803, 772, 3,
+    114, 803, 772, 2, 82, 817, 2, 114, 817, 2, 83, 775,
+    2, 115, 775, 2, 83, 803, 2, 115, 803, 3, 83, 769,
+    775, 3, 115, 769, 775, 3, 83, 780, 775, 3, 115, 780,
+    775, 3, 83, 803, 775, 3, 115, 803, 775, 2, 84, 775,
+    2, 116, 775, 2, 84, 803, 2, 116, 803, 2, 84, 817,
+    2, 116, 817, 2, 84, 813, 2, 116, 813, 2, 85, 804,
+    2, 117, 804, 2, 85, 816, 2, 117, 816, 2, 85, 813,
+    2, 117, 813, 3, 85, 771, 769, 3, 117, 771, 769, 3,
+    85, 772, 776, 3, 117, 772, 776, 2, 86, 771, 2, 118,
+    771, 2, 86, 803, 2, 118, 803, 2, 87, 768, 2, 119,
+    768, 2, 87, 769, 2, 119, 769, 2, 87, 776, 2, 119,
+    776, 2, 87, 775, 2, 119, 775, 2, 87, 803, 2, 119,
+    803, 2, 88, 775, 2, 120, 775, 2, 88, 776, 2, 120,
+    776, 2, 89, 775, 2, 121, 775, 2, 90, 770, 2, 122,
+    770, 2, 90, 803, 2, 122, 803, 2, 90, 817, 2, 122,
+    817, 2, 104, 817, 2, 116, 776, 2, 119, 778, 2, 121,
+    778, 2, 97, 702, 2, 65, 803, 2, 97, 803, 2, 65,
+    777, 2, 97, 777, 3, 65, 770, 769, 3, 97, 770, 769,
+    3, 65, 770, 768, 3, 97, 770, 768, 3, 65, 770, 777,
+    3, 97, 770, 777, 3, 65, 770, 771, 3, 97, 770, 771,
+    3, 65, 803, 770, 3, 97, 803, 770, 3, 65, 774, 769,
+    3, 97, 774, 769, 3, 65, 774, 768, 3, 97, 774, 768,
+    3, 65, 774, 777, 3, 97, 774, 777, 3, 65, 774, 771,
+    3, 97, 774, 771, 3, 65, 803, 774, 3, 97, 803, 774,
+    2, 69, 803, 2, 101, 803, 2, 69, 777, 2, 101, 777,
+    2, 69, 771, 2, 101, 771, 3, 69, 770, 769, 3, 101,
+    770, 769, 3, 69, 770, 768, 3, 101, 770, 768, 3, 69,
+    770, 777, 3, 101, 770, 777, 3, 69, 770, 771, 3, 101,
+    770, 771, 3, 69, 803, 770, 3, 101, 803, 770, 2, 73,
+    777, 2, 105, 777, 2, 73, 803, 2, 105, 803, 2, 79,
+    803, 2, 111, 803, 2, 79, 777, 2, 111, 777, 3, 79,
+    770, 769, 3, 111, 770, 769, 3, 79, 770, 768, 3, 111,
+    770, 768, 3, 79, 770, 777, 3, 111, 770, 777, 3, 79,
+    770, 771, 3, 111, 770, 771, 3, 79, 803, 770, 3, 111,
+    803, 770, 3, 79, 795, 769, 3, 111, 795, 769, 3, 79,
+    795, 768, 3, 111, 795, 768, 3, 79, 795, 777, 3, 111,
+    795, 777, 3, 79, 795, 771, 3, 111, 795, 771, 3, 79,
+    795, 803, 3, 111, 795, 803, 2, 85, 803, 2, 117, 803,
+    2, 85, 777, 2, 117, 777, 3, 85, 795, 769, 3, 117,
+    795, 769, 3, 85, 795, 768, 3, 117, 795, 768, 3, 85,
+    795, 777, 3, 117, 795, 777, 3, 85, 795, 771, 3, 117,
+    795, 771, 3, 85, 795, 803, 3, 117, 795, 803, 2, 89,
+    768, 2, 121, 768, 2, 89, 803, 2, 121, 803, 2, 89,
+    777, 2, 121, 777, 2, 89, 771, 2, 121, 771, 2, 945,
+    787, 2, 945, 788, 3, 945, 787, 768, 3, 945, 788, 768,
+    3, 945, 787, 769, 3, 945, 788, 769, 3, 945, 787, 834,
+    3, 945, 788, 834, 2, 913, 787, 2, 913, 788, 3, 913,
+    787, 768, 3, 913, 788, 768, 3, 913, 787, 769, 3, 913,
+    788, 769, 3, 913, 787, 834, 3, 913, 788, 834, 2, 949,
+    787, 2, 949, 788, 3, 949, 787, 768, 3, 949, 788, 768,
+    3, 949, 787, 769, 3, 949, 788, 769, 2, 917, 787, 2,
+    917, 788, 3, 917, 787, 768, 3, 917, 788, 768, 3, 917,
+    787, 769, 3, 917, 788, 769, 2, 951, 787, 2, 951, 788,
+    3, 951, 787, 768, 3, 951, 788, 768, 3, 951, 787, 769,
+    3, 951, 788, 769, 3, 951, 787, 834, 3, 951, 788, 834,
+    2, 919, 787, 2, 919, 788, 3, 919, 787, 768, 3, 919,
+    788, 768, 3, 919, 787, 769, 3, 919, 788, 769, 3, 919,
+    787, 834, 3, 919, 788, 834, 2, 953, 787, 2, 953, 788,
+    3, 953, 787, 768, 3, 953, 788, 768, 3, 953, 787, 769,
+    3, 953, 788, 769, 3, 953, 787, 834, 3, 953, 788, 834,
+    2, 921, 787, 2, 921, 788, 3, 921, 787, 768, 3, 921,
+    788, 768, 3, 921, 787, 769, 3, 921, 788, 769, 3, 921,
+    787, 834, 3, 921, 788, 834, 2, 959, 787, 2, 959, 788,
+    3, 959, 787, 768, 3, 959, 788, 768, 3, 959, 787, 769,
+    3, 959, 788, 769, 2, 927, 787, 2, 927, 788, 3, 927,
+    787, 768, 3, 927, 788, 768, 3, 927, 787, 769, 3, 927,
+    788, 769, 2, 965, 787, 2, 965, 788, 3, 965, 787, 768,
+    3, 965, 788, 768, 3, 965, 787, 769, 3, 965, 788, 769,
+    3, 965, 787, 834, 3, 965, 788, 834, 2, 933, 788, 3,
+    933, 788, 768, 3, 933, 788, 769, 3, 933, 788, 834, 2,
+    969, 787, 2, 969, 788, 3, 969, 787, 768, 3, 969, 788,
+    768, 3, 969, 787, 769, 3, 969, 788, 769, 3, 969, 787,
+    834, 3, 969, 788, 834, 2, 937, 787, 2, 937, 788, 3,
+    937, 787, 768, 3, 937, 788, 768, 3, 937, 787, 769, 3,
+    937, 788, 769, 3, 937, 787, 834, 3, 937, 788, 834, 2,
+    945, 768, 2, 949, 768, 2, 951, 768, 2, 953, 768, 2,
+    959, 768, 2, 965, 768, 2, 969, 768, 3, 945, 787, 837,
+    3, 945, 788, 837, 4, 945, 787, 768, 837, 4, 945, 788,
+    768, 837, 4, 945, 787, 769, 837, 4, 945, 788, 769, 837,
+    4, 945, 787, 834, 837, 4, 945, 788, 834, 837, 3, 913,
+    787, 837, 3, 913, 788, 837, 4, 913, 787, 768, 837, 4,
+    913, 788, 768, 837, 4, 913, 787, 769, 837, 4, 913, 788,
+    769, 837, 4, 913, 787, 834, 837, 4, 913, 788, 834, 837,
+    3, 951, 787, 837, 3, 951, 788, 837, 4, 951, 787, 768,
+    837, 4, 951, 788, 768, 837, 4, 951, 787, 769, 837, 4,
+    951, 788, 769, 837, 4, 951, 787, 834, 837, 4, 951, 788,
+    834, 837, 3, 919, 787, 837, 3, 919, 788, 837, 4, 919,
+    787, 768, 837, 4, 919, 788, 768, 837, 4, 919, 787, 769,
+    837, 4, 919, 788, 769, 837, 4, 919, 787, 834, 837, 4,
+    919, 788, 834, 837, 3, 969, 787, 837, 3, 969, 788, 837,
+    4, 969, 787, 768, 837, 4, 969, 788, 768, 837, 4, 969,
+    787, 769, 837, 4, 969, 788, 769, 837, 4, 969, 787, 834,
+    837, 4, 969, 788, 834, 837, 3, 937, 787, 837, 3, 937,
+    788, 837, 4, 937, 787, 768, 837, 4, 937, 788, 768, 837,
+    4, 937, 787, 769, 837, 4, 937, 788, 769, 837, 4, 937,
+    787, 834, 837, 4, 937, 788, 834, 837, 2, 945, 774, 2,
+    945, 772, 3, 945, 768, 837, 2, 945, 837, 3, 945, 769,
+    837, 2, 945, 834, 3, 945, 834, 837, 2, 913, 774, 2,
+    913, 772, 2, 913, 768, 2, 913, 837, 2, 32, 787, 1,
+    953, 2, 32, 834, 3, 32, 776, 834, 3, 951, 768, 837,
+    2, 951, 837, 3, 951, 769, 837, 2, 951, 834, 3, 951,
+    834, 837, 2, 917, 768, 2, 919, 768, 2, 919, 837, 3,
+    32, 787, 768, 3, 32, 787, 769, 3, 32, 787, 834, 2,
+    953, 774, 2, 953, 772, 3, 953, 776, 768, 2, 953, 834,
+    3, 953, 776, 834, 2, 921, 774, 2, 921, 772, 2, 921,
+    768, 3, 32, 788, 768, 3, 32, 788, 769, 3, 32, 788,
+    834, 2, 965, 774, 2, 965, 772, 3, 965, 776, 768, 2,
+    961, 787, 2, 961, 788, 2, 965, 834, 3, 965, 776, 834,
+    2, 933, 774, 2, 933, 772, 2, 933, 768, 2, 929, 788,
+    3, 32, 776, 768, 1, 96, 3, 969, 768, 837, 2, 969,
+    837, 3, 969, 769, 837, 2, 969, 834, 3, 969, 834, 837,
+    2, 927, 768, 2, 937, 768, 2, 937, 837, 2, 32, 788,
+    1, 8208, 2, 32, 819, 1, 46, 2, 46, 46, 3, 46,
+    46, 46, 2, 8242, 8242, 3, 8242, 8242, 8242, 2, 8245, 8245,
+    3, 8245, 8245, 8245, 2, 33, 33, 2, 32, 773, 2, 63,
+    63, 2, 63, 33, 2, 33, 63, 4, 8242, 8242, 8242, 8242,
+    1, 48, 1, 52, 1, 53, 1, 54, 1, 55, 1, 56,
+    1, 57, 1, 43, 1, 8722, 1, 61, 1, 40, 1, 41,
+    1, 110, 2, 82, 115, 3, 97, 47, 99, 3, 97, 47,
+    115, 1, 67, 2, 176, 67, 3, 99, 47, 111, 3, 99,
+    47, 117, 1, 400, 2, 176, 70, 1, 295, 2, 78, 111,
+    1, 81, 2, 83, 77, 3, 84, 69, 76, 2, 84, 77,
+    1, 90, 1, 937, 1, 70, 1, 1488, 1, 1489, 1, 1490,
+    1, 1491, 3, 70, 65, 88, 1, 915, 1, 928, 1, 8721,
+    3, 49, 8260, 55, 3, 49, 8260, 57, 4, 49, 8260, 49,
+    48, 3, 49, 8260, 51, 3, 50, 8260, 51, 3, 49, 8260,
+    53, 3, 50, 8260, 53, 3, 51, 8260, 53, 3, 52, 8260,
+    53, 3, 49, 8260, 54, 3, 53, 8260, 54, 3, 49, 8260,
+    56, 3, 51, 8260, 56, 3, 53, 8260, 56, 3, 55, 8260,
+    56, 2, 49, 8260, 2, 73, 73, 3, 73, 73, 73, 2,
+    73, 86, 1, 86, 2, 86, 73, 3, 86, 73, 73, 4,
+    86, 73, 73, 73, 2, 73, 88, 1, 88, 2, 88, 73,
+    3, 88, 73, 73, 2, 105, 105, 3, 105, 105, 105, 2,
+    105, 118, 2, 118, 105, 3, 118, 105, 105, 4, 118, 105,
+    105, 105, 2, 105, 120, 2, 120, 105, 3, 120, 105, 105,
+    3, 48, 8260, 51, 2, 8592, 824, 2, 8594, 824, 2, 8596,
+    824, 2, 8656, 824, 2, 8660, 824, 2, 8658, 824, 2, 8707,
+    824, 2, 8712, 824, 2, 8715, 824, 2, 8739, 824, 2, 8741,
+    824, 2, 8747, 8747, 3, 8747, 8747, 8747, 2, 8750, 8750, 3,
+    8750, 8750, 8750, 2, 8764, 824, 2, 8771, 824, 2, 8773, 824,
+    2, 8776, 824, 2, 61, 824, 2, 8801, 824, 2, 8781, 824,
+    2, 60, 824, 2, 62, 824, 2, 8804, 824, 2, 8805, 824,
+    2, 8818, 824, 2, 8819, 824, 2, 8822, 824, 2, 8823, 824,
+    2, 8826, 824, 2, 8827, 824, 2, 8834, 824, 2, 8835, 824,
+    2, 8838, 824, 2, 8839, 824, 2, 8866, 824, 2, 8872, 824,
+    2, 8873, 824, 2, 8875, 824, 2, 8828, 824, 2, 8829, 824,
+    2, 8849, 824, 2, 8850, 824, 2, 8882, 824, 2, 8883, 824,
+    2, 8884, 824, 2, 8885, 824, 1, 12296, 1, 12297, 2, 49,
+    48, 2, 49, 49, 2, 49, 50, 2, 49, 51, 2, 49,
+    52, 2, 49, 53, 2, 49, 54, 2, 49, 55, 2, 49,
+    56, 2, 49, 57, 2, 50, 48, 3, 40, 49, 41, 3,
+    40, 50, 41, 3, 40, 51, 41, 3, 40, 52, 41, 3,
+    40, 53, 41, 3, 40, 54, 41, 3, 40, 55, 41, 3,
+    40, 56, 41, 3, 40, 57, 41, 4, 40, 49, 48, 41,
+    4, 40, 49, 49, 41, 4, 40, 49, 50, 41, 4, 40,
+    49, 51, 41, 4, 40, 49, 52, 41, 4, 40, 49, 53,
+    41, 4, 40, 49, 54, 41, 4, 40, 49, 55, 41, 4,
+    40, 49, 56, 41, 4, 40, 49, 57, 41, 4, 40, 50,
+    48, 41, 2, 49, 46, 2, 50, 46, 2, 51, 46, 2,
+    52, 46, 2, 53, 46, 2, 54, 46, 2, 55, 46, 2,
+    56, 46, 2, 57, 46, 3, 49, 48, 46, 3, 49, 49,
+    46, 3, 49, 50, 46, 3, 49, 51, 46, 3, 49, 52,
+    46, 3, 49, 53, 46, 3, 49, 54, 46, 3, 49, 55,
+    46, 3, 49, 56, 46, 3, 49, 57, 46, 3, 50, 48,
+    46, 3, 40, 97, 41, 3, 40, 98, 41, 3, 40, 99,
+    41, 3, 40, 100, 41, 3, 40, 101, 41, 3, 40, 102,
+    41, 3, 40, 103, 41, 3, 40, 104, 41, 3, 40, 105,
+    41, 3, 40, 106, 41, 3, 40, 107, 41, 3, 40, 108,
+    41, 3, 40, 109, 41, 3, 40, 110, 41, 3, 40, 111,
+    41, 3, 40, 112, 41, 3, 40, 113, 41, 3, 40, 114,
+    41, 3, 40, 115, 41, 3, 40, 116, 41, 3, 40, 117,
+    41, 3, 40, 118, 41, 3, 40, 119, 41, 3, 40, 120,
+    41, 3, 40, 121, 41, 3, 40, 122, 41, 1, 83, 1,
+    89, 1, 113, 4, 8747, 8747, 8747, 8747, 3, 58, 58, 61,
+    2, 61, 61, 3, 61, 61, 61, 2, 10973, 824, 1, 11617,
+    1, 27597, 1, 40863, 1, 19968, 1, 20008, 1, 20022, 1, 20031,
+    1, 20057, 1, 20101, 1, 20108, 1, 20128, 1, 20154, 1, 20799,
+    1, 20837, 1, 20843, 1, 20866, 1, 20886, 1, 20907, 1, 20960,
+    1, 20981, 1, 20992, 1, 21147, 1, 21241, 1, 21269, 1, 21274,
+    1, 21304, 1, 21313, 1, 21340, 1, 21353, 1, 21378, 1, 21430,
+    1, 21448, 1, 21475, 1, 22231, 1, 22303, 1, 22763, 1, 22786,
+    1, 22794, 1, 22805, 1, 22823, 1, 22899, 1, 23376, 1, 23424,
+    1, 23544, 1, 23567, 1, 23586, 1, 23608, 1, 23662, 1, 23665,
+    1, 24027, 1, 24037, 1, 24049, 1, 24062, 1, 24178, 1, 24186,
+    1, 24191, 1, 24308, 1, 24318, 1, 24331, 1, 24339, 1, 24400,
+    1, 24417, 1, 24435, 1, 24515, 1, 25096, 1, 25142, 1, 25163,
+    1, 25903, 1, 25908, 1, 25991, 1, 26007, 1, 26020, 1, 26041,
+    1, 26080, 1, 26085, 1, 26352, 1, 26376, 1, 26408, 1, 27424,
+    1, 27490, 1, 27513, 1, 27571, 1, 27595, 1, 27604, 1, 27611,
+    1, 27663, 1, 27668, 1, 27700, 1, 28779, 1, 29226, 1, 29238,
+    1, 29243, 1, 29247, 1, 29255, 1, 29273, 1, 29275, 1, 29356,
+    1, 29572, 1, 29577, 1, 29916, 1, 29926, 1, 29976, 1, 29983,
+    1, 29992, 1, 30000, 1, 30091, 1, 30098, 1, 30326, 1, 30333,
+    1, 30382, 1, 30399, 1, 30446, 1, 30683, 1, 30690, 1, 30707,
+    1, 31034, 1, 31160, 1, 31166, 1, 31348, 1, 31435, 1, 31481,
+    1, 31859, 1, 31992, 1, 32566, 1, 32593, 1, 32650, 1, 32701,
+    1, 32769, 1, 32780, 1, 32786, 1, 32819, 1, 32895, 1, 32905,
+    1, 33251, 1, 33258, 1, 33267, 1, 33276, 1, 33292, 1, 33307,
+    1, 33311, 1, 33390, 1, 33394, 1, 33400, 1, 34381, 1, 34411,
+    1, 34880, 1, 34892, 1, 34915, 1, 35198, 1, 35211, 1, 35282,
+    1, 35328, 1, 35895, 1, 35910, 1, 35925, 1, 35960, 1, 35997,
+    1, 36196, 1, 36208, 1, 36275, 1, 36523, 1, 36554, 1, 36763,
+    1, 36784, 1, 36789, 1, 37009, 1, 37193, 1, 37318, 1, 37324,
+    1, 37329, 1, 38263, 1, 38272, 1, 38428, 1, 38582, 1, 38585,
+    1, 38632, 1, 38737, 1, 38750, 1, 38754, 1, 38761, 1, 38859,
+    1, 38893, 1, 38899, 1, 38913, 1, 39080, 1, 39131, 1, 39135,
+    1, 39318, 1, 39321, 1, 39340, 1, 39592, 1, 39640, 1, 39647,
+    1, 39717, 1, 39727, 1, 39730, 1, 39740, 1, 39770, 1, 40165,
+    1, 40565, 1, 40575, 1, 40613, 1, 40635, 1, 40643, 1, 40653,
+    1, 40657, 1, 40697, 1, 40701, 1, 40718, 1, 40723, 1, 40736,
+    1, 40763, 1, 40778, 1, 40786, 1, 40845, 1, 40860, 1, 40864,
+    1, 12306, 1, 21316, 1, 21317, 2, 12363, 12441, 2, 12365, 12441,
+    2, 12367, 12441, 2, 12369, 12441, 2, 12371, 12441, 2, 12373, 12441,
+    2, 12375, 12441, 2, 12377, 12441, 2, 12379, 12441, 2, 12381, 12441,
+    2, 12383, 12441, 2, 12385, 12441, 2, 12388, 12441, 2, 12390, 12441,
+    2, 12392, 12441, 2, 12399, 12441, 2, 12399, 12442, 2, 12402, 12441,
+    2, 12402, 12442, 2, 12405, 12441, 2, 12405, 12442, 2, 12408, 12441,
+    2, 12408, 12442, 2, 12411, 12441, 2, 12411, 12442, 2, 12358, 12441,
+    2, 32, 12441, 2, 32, 12442, 2, 12445, 12441, 2, 12424, 12426,
+    2, 12459, 12441, 2, 12461, 12441, 2, 12463, 12441, 2, 12465, 12441,
+    2, 12467, 12441, 2, 12469, 12441, 2, 12471, 12441, 2, 12473, 12441,
+    2, 12475, 12441, 2, 12477, 12441, 2, 12479, 12441, 2, 12481, 12441,
+    2, 12484, 12441, 2, 12486, 12441, 2, 12488, 12441, 2, 12495, 12441,
+    2, 12495, 12442, 2, 12498, 12441, 2, 12498, 12442, 2, 12501, 12441,
+    2, 12501, 12442, 2, 12504, 12441, 2, 12504, 12442, 2, 12507, 12441,
+    2, 12507, 12442, 2, 12454, 12441, 2, 12527, 12441, 2, 12528, 12441,
+    2, 12529, 12441, 2, 12530, 12441, 2, 12541, 12441, 2, 12467, 12488,
+    1, 4352, 1, 4353, 1, 4522, 1, 4354, 1, 4524, 1, 4525,
+    1, 4355, 1, 4356, 1, 4357, 1, 4528, 1, 4529, 1, 4530,
+    1, 4531, 1, 4532, 1, 4533, 1, 4378, 1, 4358, 1, 4359,
+    1, 4360, 1, 4385, 1, 4361, 1, 4362, 1, 4363, 1, 4364,
+    1, 4365, 1, 4366, 1, 4367, 1, 4368, 1, 4369, 1, 4370,
+    1, 4449, 1, 4450, 1, 4451, 1, 4452, 1, 4453, 1, 4454,
+    1, 4455, 1, 4456, 1, 4457, 1, 4458, 1, 4459, 1, 4460,
+    1, 4461, 1, 4462, 1, 4463, 1, 4464, 1, 4465, 1, 4466,
+    1, 4467, 1, 4468, 1, 4469, 1, 4448, 1, 4372, 1, 4373,
+    1, 4551, 1, 4552, 1, 4556, 1, 4558, 1, 4563, 1, 4567,
+    1, 4569, 1, 4380, 1, 4573, 1, 4575, 1, 4381, 1, 4382,
+    1, 4384, 1, 4386, 1, 4387, 1, 4391, 1, 4393, 1, 4395,
+    1, 4396, 1, 4397, 1, 4398, 1, 4399, 1, 4402, 1, 4406,
+    1, 4416, 1, 4423, 1, 4428, 1, 4593, 1, 4594, 1, 4439,
+    1, 4440, 1, 4441, 1, 4484, 1, 4485, 1, 4488, 1, 4497,
+    1, 4498, 1, 4500, 1, 4510, 1, 4513, 1, 19977, 1, 22235,
+    1, 19978, 1, 20013, 1, 19979, 1, 30002, 1, 19993, 1, 19969,
+    1, 22825, 1, 22320, 3, 40, 4352, 41, 3, 40, 4354, 41,
+    3, 40, 4355, 41, 3, 40, 4357, 41, 3, 40, 4358, 41,
+    3, 40, 4359, 41, 3, 40, 4361, 41, 3, 40, 4363, 41,
+    3, 40, 4364, 41, 3, 40, 4366, 41, 3, 40, 4367, 41,
+    3, 40, 4368, 41, 3, 40, 4369, 41, 3, 40, 4370, 41,
+    4, 40, 4352, 4449, 41, 4, 40, 4354, 4449, 41, 4, 40,
+    4355, 4449, 41, 4, 40, 4357, 4449, 41, 4, 40, 4358, 4449,
+    41, 4, 40, 4359, 4449, 41, 4, 40, 4361, 4449, 41, 4,
+    40, 4363, 4449, 41, 4, 40, 4364, 4449, 41, 4, 40, 4366,
+    4449, 41, 4, 40, 4367, 4449, 41, 4, 40, 4368, 4449, 41,
+    4, 40, 4369, 4449, 41, 4, 40, 4370, 4449, 41, 4, 40,
+    4364, 4462, 41, 7, 40, 4363, 4457, 4364, 4453, 4523, 41, 6,
+    40, 4363, 4457, 4370, 4462, 41, 3, 40, 19968, 41, 3, 40,
+    20108, 41, 3, 40, 19977, 41, 3, 40, 22235, 41, 3, 40,
+    20116, 41, 3, 40, 20845, 41, 3, 40, 19971, 41, 3, 40,
+    20843, 41, 3, 40, 20061, 41, 3, 40, 21313, 41, 3, 40,
+    26376, 41, 3, 40, 28779, 41, 3, 40, 27700, 41, 3, 40,
+    26408, 41, 3, 40, 37329, 41, 3, 40, 22303, 41, 3, 40,
+    26085, 41, 3, 40, 26666, 41, 3, 40, 26377, 41, 3, 40,
+    31038, 41, 3, 40, 21517, 41, 3, 40, 29305, 41, 3, 40,
+    36001, 41, 3, 40, 31069, 41, 3, 40, 21172, 41, 3, 40,
+    20195, 41, 3, 40, 21628, 41, 3, 40, 23398, 41, 3, 40,
+    30435, 41, 3, 40, 20225, 41, 3, 40, 36039, 41, 3, 40,
+    21332, 41, 3, 40, 31085, 41, 3, 40, 20241, 41, 3, 40,
+    33258, 41, 3, 40, 33267, 41, 1, 21839, 1, 24188, 1, 31631,
+    3, 80, 84, 69, 2, 50, 49, 2, 50, 50, 2, 50,
+    51, 2, 50, 52, 2, 50, 53, 2, 50, 54, 2, 50,
+    55, 2, 50, 56, 2, 50, 57, 2, 51, 48, 2, 51,
+    49, 2, 51, 50, 2, 51, 51, 2, 51, 52, 2, 51,
+    53, 2, 4352, 4449, 2, 4354, 4449, 2, 4355, 4449, 2, 4357,
+    4449, 2, 4358, 4449, 2, 4359, 4449, 2, 4361, 4449, 2, 4363,
+    4449, 2, 4364, 4449, 2, 4366, 4449, 2, 4367, 4449, 2, 4368,
+    4449, 2, 4369, 4449, 2, 4370, 4449, 5, 4366, 4449, 4535, 4352,
+    4457, 4, 4364, 4462, 4363, 4468, 2, 4363, 4462, 1, 20116, 1,
+    20845, 1, 19971, 1, 20061, 1, 26666, 1, 26377, 1, 31038, 1,
+    21517, 1, 29305, 1, 36001, 1, 31069, 1, 21172, 1, 31192, 1,
+    30007, 1, 36969, 1, 20778, 1, 21360, 1, 27880, 1, 38917, 1,
+    20241, 1, 20889, 1, 27491, 1, 24038, 1, 21491, 1, 21307, 1,
+    23447, 1, 23398, 1, 30435, 1, 20225, 1, 36039, 1, 21332, 1,
+    22812, 2, 51, 54, 2, 51, 55, 2, 51, 56, 2, 51,
+    57, 2, 52, 48, 2, 52, 49, 2, 52, 50, 2, 52,
+    51, 2, 52, 52, 2, 52, 53, 2, 52, 54, 2, 52,
+    55, 2, 52, 56, 2, 52, 57, 2, 53, 48, 2, 49,
+    26376, 2, 50, 26376, 2, 51, 26376, 2, 52, 26376, 2, 53,
+    26376, 2, 54, 26376, 2, 55, 26376, 2, 56, 26376, 2, 57,
+    26376, 3, 49, 48, 26376, 3, 49, 49, 26376, 3, 49, 50,
+    26376, 2, 72, 103, 3, 101, 114, 103, 2, 101, 86, 3,
+    76, 84, 68, 1, 12450, 1, 12452, 1, 12454, 1, 12456, 1,
+    12458, 1, 12459, 1, 12461, 1, 12463, 1, 12465, 1, 12467, 1,
+    12469, 1, 12471, 1, 12473, 1, 12475, 1, 12477, 1, 12479, 1,
+    12481, 1, 12484, 1, 12486, 1, 12488, 1, 12490, 1, 12491, 1,
+    12492, 1, 12493, 1, 12494, 1, 12495, 1, 12498, 1, 12501, 1,
+    12504, 1, 12507, 1, 12510, 1, 12511, 1, 12512, 1, 12513, 1,
+    12514, 1, 12516, 1, 12518, 1, 12520, 1, 12521, 1, 12522, 1,
+    12523, 1, 12524, 1, 12525, 1, 12527, 1, 12528, 1, 12529, 1,
+    12530, 2, 20196, 21644, 5, 12450, 12495, 12442, 12540, 12488, 4, 12450,
+    12523, 12501, 12449, 5, 12450, 12531, 12504, 12442, 12450, 3, 12450, 12540,
+    12523, 5, 12452, 12491, 12531, 12463, 12441, 3, 12452, 12531, 12481, 3,
+    12454, 12457, 12531, 6, 12456, 12473, 12463, 12540, 12488, 12441, 4, 12456,
+    12540, 12459, 12540, 3, 12458, 12531, 12473, 3, 12458, 12540, 12512, 3,
+    12459, 12452, 12522, 4, 12459, 12521, 12483, 12488, 4, 12459, 12525, 12522,
+    12540, 4, 12459, 12441, 12525, 12531, 4, 12459, 12441, 12531, 12510, 4,
+    12461, 12441, 12459, 12441, 4, 12461, 12441, 12491, 12540, 4, 12461, 12517,
+    12522, 12540, 6, 12461, 12441, 12523, 12479, 12441, 12540, 2, 12461, 12525,
+    6, 12461, 12525, 12463, 12441, 12521, 12512, 6, 12461, 12525, 12513, 12540,
+    12488, 12523, 5, 12461, 12525, 12527, 12483, 12488, 4, 12463, 12441, 12521,
+    12512, 6, 12463, 12441, 12521, 12512, 12488, 12531, 6, 12463, 12523, 12475,
+    12441, 12452, 12525, 4, 12463, 12525, 12540, 12493, 3, 12465, 12540, 12473,
+    3, 12467, 12523, 12490, 4, 12467, 12540, 12507, 12442, 4, 12469, 12452,
+    12463, 12523, 5, 12469, 12531, 12481, 12540, 12512, 5, 12471, 12522, 12531,
+    12463, 12441, 3, 12475, 12531, 12481, 3, 12475, 12531, 12488, 4, 12479,
+    12441, 12540, 12473, 3, 12486, 12441, 12471, 3, 12488, 12441, 12523, 2,
+    12488, 12531, 2, 12490, 12494, 3, 12494, 12483, 12488, 3, 12495, 12452,
+    12484, 6, 12495, 12442, 12540, 12475, 12531, 12488, 4, 12495, 12442, 12540,
+    12484, 5, 12495, 12441, 12540, 12524, 12523, 6, 12498, 12442, 12450, 12473,
+    12488, 12523, 4, 12498, 12442, 12463, 12523, 3, 12498, 12442, 12467, 3,
+    12498, 12441, 12523, 6, 12501, 12449, 12521, 12483, 12488, 12441, 4, 12501,
+    12451, 12540, 12488, 6, 12501, 12441, 12483, 12471, 12455, 12523, 3, 12501,
+    12521, 12531, 5, 12504, 12463, 12479, 12540, 12523, 3, 12504, 12442, 12477,
+    4, 12504, 12442, 12491, 12498, 3, 12504, 12523, 12484, 4, 12504, 12442,
+    12531, 12473, 5, 12504, 12442, 12540, 12471, 12441, 4, 12504, 12441, 12540,
+    12479, 5, 12507, 12442, 12452, 12531, 12488, 4, 12507, 12441, 12523, 12488,
+    2, 12507, 12531, 5, 12507, 12442, 12531, 12488, 12441, 3, 12507, 12540,
+    12523, 3, 12507, 12540, 12531, 4, 12510, 12452, 12463, 12525, 3, 12510,
+    12452, 12523, 3, 12510, 12483, 12495, 3, 12510, 12523, 12463, 5, 12510,
+    12531, 12471, 12519, 12531, 4, 12511, 12463, 12525, 12531, 2, 12511, 12522,
+    6, 12511, 12522, 12495, 12441, 12540, 12523, 3, 12513, 12459, 12441, 5,
+    12513, 12459, 12441, 12488, 12531, 4, 12513, 12540, 12488, 12523, 4, 12516,
+    12540, 12488, 12441, 3, 12516, 12540, 12523, 3, 12518, 12450, 12531, 4,
+    12522, 12483, 12488, 12523, 2, 12522, 12521, 4, 12523, 12498, 12442, 12540,
+    5, 12523, 12540, 12501, 12441, 12523, 2, 12524, 12512, 6, 12524, 12531,
+    12488, 12465, 12441, 12531, 3, 12527, 12483, 12488, 2, 48, 28857, 2,
+    49, 28857, 2, 50, 28857, 2, 51, 28857, 2, 52, 28857, 2,
+    53, 28857, 2, 54, 28857, 2, 55, 28857, 2, 56, 28857, 2,
+    57, 28857, 3, 49, 48, 28857, 3, 49, 49, 28857, 3, 49,
+    50, 28857, 3, 49, 51, 28857, 3, 49, 52, 28857, 3, 49,
+    53, 28857, 3, 49, 54, 28857, 3, 49, 55, 28857, 3, 49,
+    56, 28857, 3, 49, 57, 28857, 3, 50, 48, 28857, 3, 50,
+    49, 28857, 3, 50, 50, 28857, 3, 50, 51, 28857, 3, 50,
+    52, 28857, 3, 104, 80, 97, 2, 100, 97, 2, 65, 85,
+    3, 98, 97, 114, 2, 111, 86, 2, 112, 99, 2, 100,
+    109, 3, 100, 109, 50, 3, 100, 109, 51, 2, 73, 85,
+    2, 24179, 25104, 2, 26157, 21644, 2, 22823, 27491, 2, 26126, 27835,
+    4, 26666, 24335, 20250, 31038, 2, 112, 65, 2, 110, 65, 2,
+    956, 65, 2, 109, 65, 2, 107, 65, 2, 75, 66, 2,
+    77, 66, 2, 71, 66, 3, 99, 97, 108, 4, 107, 99,
+    97, 108, 2, 112, 70, 2, 110, 70, 2, 956, 70, 2,
+    956, 103, 2, 109, 103, 2, 107, 103, 2, 72, 122, 3,
+    107, 72, 122, 3, 77, 72, 122, 3, 71, 72, 122, 3,
+    84, 72, 122, 2, 956, 108, 2, 109, 108, 2, 100, 108,
+    2, 107, 108, 2, 102, 109, 2, 110, 109, 2, 956, 109,
+    2, 109, 109, 2, 99, 109, 2, 107, 109, 3, 109, 109,
+    50, 3, 99, 109, 50, 2, 109, 50, 3, 107, 109, 50,
+    3, 109, 109, 51, 3, 99, 109, 51, 2, 109, 51, 3,
+    107, 109, 51, 3, 109, 8725, 115, 4, 109, 8725, 115, 50,
+    2, 80, 97, 3, 107, 80, 97, 3, 77, 80, 97, 3,
+    71, 80, 97, 3, 114, 97, 100, 5, 114, 97, 100, 8725,
+    115, 6, 114, 97, 100, 8725, 115, 50, 2, 112, 115, 2,
+    110, 115, 2, 956, 115, 2, 109, 115, 2, 112, 86, 2,
+    110, 86, 2, 956, 86, 2, 109, 86, 2, 107, 86, 2,
+    77, 86, 2, 112, 87, 2, 110, 87, 2, 956, 87, 2,
+    109, 87, 2, 107, 87, 2, 77, 87, 2, 107, 937, 2,
+    77, 937, 4, 97, 46, 109, 46, 2, 66, 113, 2, 99,
+    99, 2, 99, 100, 4, 67, 8725, 107, 103, 3, 67, 111,
+    46, 2, 100, 66, 2, 71, 121, 2, 104, 97, 2, 72,
+    80, 2, 105, 110, 2, 75, 75, 2, 75, 77, 2, 107,
+    116, 2, 108, 109, 2, 108, 110, 3, 108, 111, 103, 2,
+    108, 120, 2, 109, 98, 3, 109, 105, 108, 3, 109, 111,
+    108, 2, 80, 72, 4, 112, 46, 109, 46, 3, 80, 80,
+    77, 2, 80, 82, 2, 115, 114, 2, 83, 118, 2, 87,
+    98, 3, 86, 8725, 109, 3, 65, 8725, 109, 2, 49, 26085,
+    2, 50, 26085, 2, 51, 26085, 2, 52, 26085, 2, 53, 26085,
+    2, 54, 26085, 2, 55, 26085, 2, 56, 26085, 2, 57, 26085,
+    3, 49, 48, 26085, 3, 49, 49, 26085, 3, 49, 50, 26085,
+    3, 49, 51, 26085, 3, 49, 52, 26085, 3, 49, 53, 26085,
+    3, 49, 54, 26085, 3, 49, 55, 26085, 3, 49, 56, 26085,
+    3, 49, 57, 26085, 3, 50, 48, 26085, 3, 50, 49, 26085,
+    3, 50, 50, 26085, 3, 50, 51, 26085, 3, 50, 52, 26085,
+    3, 50, 53, 26085, 3, 50, 54, 26085, 3, 50, 55, 26085,
+    3, 50, 56, 26085, 3, 50, 57, 26085, 3, 51, 48, 26085,
+    3, 51, 49, 26085, 3, 103, 97, 108, 1, 1098, 1, 1100,
+    1, 42863, 1, 294, 1, 339, 1, 42791, 1, 43831, 1, 619,
+    1, 43858, 1, 653, 1, 35912, 1, 26356, 1, 36040, 1, 28369,
+    1, 20018, 1, 21477, 1, 22865, 1, 21895, 1, 22856, 1, 25078,
+    1, 30313, 1, 32645, 1, 34367, 1, 34746, 1, 35064, 1, 37007,
+    1, 27138, 1, 27931, 1, 28889, 1, 29662, 1, 33853, 1, 37226,
+    1, 39409, 1, 20098, 1, 21365, 1, 27396, 1, 29211, 1, 34349,
+    1, 40478, 1, 23888, 1, 28651, 1, 34253, 1, 35172, 1, 25289,
+    1, 33240, 1, 34847, 1, 24266, 1, 26391, 1, 28010, 1, 29436,
+    1, 37070, 1, 20358, 1, 20919, 1, 21214, 1, 25796, 1, 27347,
+    1, 29200, 1, 30439, 1, 34310, 1, 34396, 1, 36335, 1, 38706,
+    1, 39791, 1, 40442, 1, 30860, 1, 31103, 1, 32160, 1, 33737,
+    1, 37636, 1, 35542, 1, 22751, 1, 24324, 1, 31840, 1, 32894,
+    1, 29282, 1, 30922, 1, 36034, 1, 38647, 1, 22744, 1, 23650,
+    1, 27155, 1, 28122, 1, 28431, 1, 32047, 1, 32311, 1, 38475,
+    1, 21202, 1, 32907, 1, 20956, 1, 20940, 1, 31260, 1, 32190,
+    1, 33777, 1, 38517, 1, 35712, 1, 25295, 1, 35582, 1, 20025,
+    1, 23527, 1, 24594, 1, 29575, 1, 30064, 1, 21271, 1, 30971,
+    1, 20415, 1, 24489, 1, 19981, 1, 27852, 1, 25976, 1, 32034,
+    1, 21443, 1, 22622, 1, 30465, 1, 33865, 1, 35498, 1, 27578,
+    1, 27784, 1, 25342, 1, 33509, 1, 25504, 1, 30053, 1, 20142,
+    1, 20841, 1, 20937, 1, 26753, 1, 31975, 1, 33391, 1, 35538,
+    1, 37327, 1, 21237, 1, 21570, 1, 24300, 1, 26053, 1, 28670,
+    1, 31018, 1, 38317, 1, 39530, 1, 40599, 1, 40654, 1, 26310,
+    1, 27511, 1, 36706, 1, 24180, 1, 24976, 1, 25088, 1, 25754,
+    1, 28451, 1, 29001, 1, 29833, 1, 31178, 1, 32244, 1, 32879,
+    1, 36646, 1, 34030, 1, 36899, 1, 37706, 1, 21015, 1, 21155,
+    1, 21693, 1, 28872, 1, 35010, 1, 24265, 1, 24565, 1, 25467,
+    1, 27566, 1, 31806, 1, 29557, 1, 20196, 1, 22265, 1, 23994,
+    1, 24604, 1, 29618, 1, 29801, 1, 32666, 1, 32838, 1, 37428,
+    1, 38646, 1, 38728, 1, 38936, 1, 20363, 1, 31150, 1, 37300,
+    1, 38584, 1, 24801, 1, 20102, 1, 20698, 1, 23534, 1, 23615,
+    1, 26009, 1, 29134, 1, 30274, 1, 34044, 1, 36988, 1, 26248,
+    1, 38446, 1, 21129, 1, 26491, 1, 26611, 1, 27969, 1, 28316,
+    1, 29705, 1, 30041, 1, 30827, 1, 32016, 1, 39006, 1, 25134,
+    1, 38520, 1, 20523, 1, 23833, 1, 28138, 1, 36650, 1, 24459,
+    1, 24900, 1, 26647, 1, 38534, 1, 21033, 1, 21519, 1, 23653,
+    1, 26131, 1, 26446, 1, 26792, 1, 27877, 1, 29702, 1, 30178,
+    1, 32633, 1, 35023, 1, 35041, 1, 38626, 1, 21311, 1, 28346,
+    1, 21533, 1, 29136, 1, 29848, 1, 34298, 1, 38563, 1, 40023,
+    1, 40607, 1, 26519, 1, 28107, 1, 33256, 1, 31520, 1, 31890,
+    1, 29376, 1, 28825, 1, 35672, 1, 20160, 1, 33590, 1, 21050,
+    1, 20999, 1, 24230, 1, 25299, 1, 31958, 1, 23429, 1, 27934,
+    1, 26292, 1, 36667, 1, 38477, 1, 24275, 1, 20800, 1, 21952,
+    1, 22618, 1, 26228, 1, 20958, 1, 29482, 1, 30410, 1, 31036,
+    1, 31070, 1, 31077, 1, 31119, 1, 38742, 1, 31934, 1, 34322,
+    1, 35576, 1, 36920, 1, 37117, 1, 39151, 1, 39164, 1, 39208,
+    1, 40372, 1, 37086, 1, 38583, 1, 20398, 1, 20711, 1, 20813,
+    1, 21193, 1, 21220, 1, 21329, 1, 21917, 1, 22022, 1, 22120,
+    1, 22592, 1, 22696, 1, 23652, 1, 24724, 1, 24936, 1, 24974,
+    1, 25074, 1, 25935, 1, 26082, 1, 26257, 1, 26757, 1, 28023,
+    1, 28186, 1, 28450, 1, 29038, 1, 29227, 1, 29730, 1, 30865,
+    1, 31049, 1, 31048, 1, 31056, 1, 31062, 1, 31117, 1, 31118,
+    1, 31296, 1, 31361, 1, 31680, 1, 32265, 1, 32321, 1, 32626,
+    1, 32773, 1, 33261, 1, 33401, 1, 33879, 1, 35088, 1, 35222,
+    1, 35585, 1, 35641, 1, 36051, 1, 36104, 1, 36790, 1, 38627,
+    1, 38911, 1, 38971, 1, 24693, 2, 55376, 57070, 1, 33304, 1,
+    20006, 1, 20917, 1, 20840, 1, 20352, 1, 20805, 1, 20864, 1,
+    21191, 1, 21242, 1, 21845, 1, 21913, 1, 21986, 1, 22707, 1,
+    22852, 1, 22868, 1, 23138, 1, 23336, 1, 24274, 1, 24281, 1,
+    24425, 1, 24493, 1, 24792, 1, 24910, 1, 24840, 1, 24928, 1,
+    25140, 1, 25540, 1, 25628, 1, 25682, 1, 25942, 1, 26395, 1,
+    26454, 1, 28379, 1, 28363, 1, 28702, 1, 30631, 1, 29237, 1,
+    29359, 1, 29809, 1, 29958, 1, 30011, 1, 30237, 1, 30239, 1,
+    30427, 1, 30452, 1, 30538, 1, 30528, 1, 30924, 1, 31409, 1,
+    31867, 1, 32091, 1, 32574, 1, 33618, 1, 33775, 1, 34681, 1,
+    35137, 1, 35206, 1, 35519, 1, 35531, 1, 35565, 1, 35722, 1,
+    36664, 1, 36978, 1, 37273, 1, 37494, 1, 38524, 1, 38875, 1,
+    38923, 1, 39698, 2, 55370, 56394, 2, 55370, 56388, 2, 55372, 57301,
+    1, 15261, 1, 16408, 1, 16441, 2, 55380, 56905, 2, 55383, 56528,
+    2, 55391, 57043, 1, 40771, 1, 40846, 2, 102, 102, 2, 102,
+    105, 2, 102, 108, 3, 102, 102, 105, 3, 102, 102, 108,
+    2, 115, 116, 2, 1396, 1398, 2, 1396, 1381, 2, 1396, 1387,
+    2, 1406, 1398, 2, 1396, 1389, 2, 1497, 1460, 2, 1522, 1463,
+    1, 1506, 1, 1492, 1, 1499, 1, 1500, 1, 1501, 1, 1512,
+    1, 1514, 2, 1513, 1473, 2, 1513, 1474, 3, 1513, 1468, 1473,
+    3, 1513, 1468, 1474, 2, 1488, 1463, 2, 1488, 1464, 2, 1488,
+    1468, 2, 1489, 1468, 2, 1490, 1468, 2, 1491, 1468, 2, 1492,
+    1468, 2, 1493, 1468, 2, 1494, 1468, 2, 1496, 1468, 2, 1497,
+    1468, 2, 1498, 1468, 2, 1499, 1468, 2, 1500, 1468, 2, 1502,
+    1468, 2, 1504, 1468, 2, 1505, 1468, 2, 1507, 1468, 2, 1508,
+    1468, 2, 1510, 1468, 2, 1511, 1468, 2, 1512, 1468, 2, 1513,
+    1468, 2, 1514, 1468, 2, 1493, 1465, 2, 1489, 1471, 2, 1499,
+    1471, 2, 1508, 1471, 2, 1488, 1500, 1, 1649, 1, 1659, 1,
+    1662, 1, 1664, 1, 1658, 1, 1663, 1, 1657, 1, 1700, 1,
+    1702, 1, 1668, 1, 1667, 1, 1670, 1, 1671, 1, 1677, 1,
+    1676, 1, 1678, 1, 1672, 1, 1688, 1, 1681, 1, 1705, 1,
+    1711, 1, 1715, 1, 1713, 1, 1722, 1, 1723, 1, 1729, 1,
+    1726, 1, 1746, 1, 1709, 1, 1735, 1, 1734, 1, 1736, 1,
+    1739, 1, 1733, 1, 1737, 1, 1744, 1, 1609, 3, 1610, 1620,
+    1575, 3, 1610, 1620, 1749, 3, 1610, 1620, 1608, 3, 1610, 1620,
+    1735, 3, 1610, 1620, 1734, 3, 1610, 1620, 1736, 3, 1610, 1620,
+    1744, 3, 1610, 1620, 1609, 1, 1740, 3, 1610, 1620, 1580, 3,
+    1610, 1620, 1581, 3, 1610, 1620, 1605, 3, 1610, 1620, 1610, 2,
+    1576, 1580, 2, 1576, 1581, 2, 1576, 1582, 2, 1576, 1605, 2,
+    1576, 1609, 2, 1576, 1610, 2, 1578, 1580, 2, 1578, 1581, 2,
+    1578, 1582, 2, 1578, 1605, 2, 1578, 1609, 2, 1578, 1610, 2,
+    1579, 1580, 2, 1579, 1605, 2, 1579, 1609, 2, 1579, 1610, 2,
+    1580, 1581, 2, 1580, 1605, 2, 1581, 1580, 2, 1581, 1605, 2,
+    1582, 1580, 2, 1582, 1581, 2, 1582, 1605, 2, 1587, 1580, 2,
+    1587, 1581, 2, 1587, 1582, 2, 1587, 1605, 2, 1589, 1581, 2,
+    1589, 1605, 2, 1590, 1580, 2, 1590, 1581, 2, 1590, 1582, 2,
+    1590, 1605, 2, 1591, 1581, 2, 1591, 1605, 2, 1592, 1605, 2,
+    1593, 1580, 2, 1593, 1605, 2, 1594, 1580, 2, 1594, 1605, 2,
+    1601, 1580, 2, 1601, 1581, 2, 1601, 1582, 2, 1601, 1605, 2,
+    1601, 1609, 2, 1601, 1610, 2, 1602, 1581, 2, 1602, 1605, 2,
+    1602, 1609, 2, 1602, 1610, 2, 1603, 1575, 2, 1603, 1580, 2,
+    1603, 1581, 2, 1603, 1582, 2, 1603, 1604, 2, 1603, 1605, 2,
+    1603, 1609, 2, 1603, 1610, 2, 1604, 1580, 2, 1604, 1581, 2,
+    1604, 1582, 2, 1604, 1605, 2, 1604, 1609, 2, 1604, 1610, 2,
+    1605, 1580, 2, 1605, 1581, 2, 1605, 1582, 2, 1605, 1605, 2,
+    1605, 1609, 2, 1605, 1610, 2, 1606, 1580, 2, 1606, 1581, 2,
+    1606, 1582, 2, 1606, 1605, 2, 1606, 1609, 2, 1606, 1610, 2,
+    1607, 1580, 2, 1607, 1605, 2, 1607, 1609, 2, 1607, 1610, 2,
+    1610, 1580, 2, 1610, 1581, 2, 1610, 1582, 2, 1610, 1605, 2,
+    1610, 1609, 2, 1610, 1610, 2, 1584, 1648, 2, 1585, 1648, 2,
+    1609, 1648, 3, 32, 1612, 1617, 3, 32, 1613, 1617, 3, 32,
+    1614, 1617, 3, 32, 1615, 1617, 3, 32, 1616, 1617, 3, 32,
+    1617, 1648, 3, 1610, 1620, 1585, 3, 1610, 1620, 1586, 3, 1610,
+    1620, 1606, 2, 1576, 1585, 2, 1576, 1586, 2, 1576, 1606, 2,
+    1578, 1585, 2, 1578, 1586, 2, 1578, 1606, 2, 1579, 1585, 2,
+    1579, 1586, 2, 1579, 1606, 2, 1605, 1575, 2, 1606, 1585, 2,
+    1606, 1586, 2, 1606, 1606, 2, 1610, 1585, 2, 1610, 1586, 2,
+    1610, 1606, 3, 1610, 1620, 1582, 3, 1610, 1620, 1607, 2, 1576,
+    1607, 2, 1578, 1607, 2, 1589, 1582, 2, 1604, 1607, 2, 1606,
+    1607, 2, 1607, 1648, 2, 1610, 1607, 2, 1579, 1607, 2, 1587,
+    1607, 2, 1588, 1605, 2, 1588, 1607, 3, 1600, 1614, 1617, 3,
+    1600, 1615, 1617, 3, 1600, 1616, 1617, 2, 1591, 1609, 2, 1591,
+    1610, 2, 1593, 1609, 2, 1593, 1610, 2, 1594, 1609, 2, 1594,
+    1610, 2, 1587, 1609, 2, 1587, 1610, 2, 1588, 1609, 2, 1588,
+    1610, 2, 1581, 1609, 2, 1581, 1610, 2, 1580, 1609, 2, 1580,
+    1610, 2, 1582, 1609, 2, 1582, 1610, 2, 1589, 1609, 2, 1589,
+    1610, 2, 1590, 1609, 2, 1590, 1610, 2, 1588, 1580, 2, 1588,
+    1581, 2, 1588, 1582, 2, 1588, 1585, 2, 1587, 1585, 2, 1589,
+    1585, 2, 1590, 1585, 2, 1575, 1611, 3, 1578, 1580, 1605, 3,
+    1578, 1581, 1580, 3, 1578, 1581, 1605, 3, 1578, 1582, 1605, 3,
+    1578, 1605, 1580, 3, 1578, 1605, 1581, 3, 1578, 1605, 1582, 3,
+    1580, 1605, 1581, 3, 1581, 1605, 1610, 3, 1581, 1605, 1609, 3,
+    1587, 1581, 1580, 3, 1587, 1580, 1581, 3, 1587, 1580, 1609, 3,
+    1587, 1605, 1581, 3, 1587, 1605, 1580, 3, 1587, 1605, 1605, 3,
+    1589, 1581, 1581, 3, 1589, 1605, 1605, 3, 1588, 1581, 1605, 3,
+    1588, 1580, 1610, 3, 1588, 1605, 1582, 3, 1588, 1605, 1605, 3,
+    1590, 1581, 1609, 3, 1590, 1582, 1605, 3, 1591, 1605, 1581, 3,
+    1591, 1605, 1605, 3, 1591, 1605, 1610, 3, 1593, 1580, 1605, 3,
+    1593, 1605, 1605, 3, 1593, 1605, 1609, 3, 1594, 1605, 1605, 3,
+    1594, 1605, 1610, 3, 1594, 1605, 1609, 3, 1601, 1582, 1605, 3,
+    1602, 1605, 1581, 3, 1602, 1605, 1605, 3, 1604, 1581, 1605, 3,
+    1604, 1581, 1610, 3, 1604, 1581, 1609, 3, 1604, 1580, 1580, 3,
+    1604, 1582, 1605, 3, 1604, 1605, 1581, 3, 1605, 1581, 1580, 3,
+    1605, 1581, 1605, 3, 1605, 1581, 1610, 3, 1605, 1580, 1581, 3,
+    1605, 1580, 1605, 3, 1605, 1582, 1580, 3, 1605, 1582, 1605, 3,
+    1605, 1580, 1582, 3, 1607, 1605, 1580, 3, 1607, 1605, 1605, 3,
+    1606, 1581, 1605, 3, 1606, 1581, 1609, 3, 1606, 1580, 1605, 3,
+    1606, 1580, 1609, 3, 1606, 1605, 1610, 3, 1606, 1605, 1609, 3,
+    1610, 1605, 1605, 3, 1576, 1582, 1610, 3, 1578, 1580, 1610, 3,
+    1578, 1580, 1609, 3, 1578, 1582, 1610, 3, 1578, 1582, 1609, 3,
+    1578, 1605, 1610, 3, 1578, 1605, 1609, 3, 1580, 1605, 1610, 3,
+    1580, 1581, 1609, 3, 1580, 1605, 1609, 3, 1587, 1582, 1609, 3,
+    1589, 1581, 1610, 3, 1588, 1581, 1610, 3, 1590, 1581, 1610, 3,
+    1604, 1580, 1610, 3, 1604, 1605, 1610, 3, 1610, 1581, 1610, 3,
+    1610, 1580, 1610, 3, 1610, 1605, 1610, 3, 1605, 1605, 1610, 3,
+    1602, 1605, 1610, 3, 1606, 1581, 1610, 3, 1593, 1605, 1610, 3,
+    1603, 1605, 1610, 3, 1606, 1580, 1581, 3, 1605, 1582, 1610, 3,
+    1604, 1580, 1605, 3, 1603, 1605, 1605, 3, 1580, 1581, 1610, 3,
+    1581, 1580, 1610, 3, 1605, 1580, 1610, 3, 1601, 1605, 1610, 3,
+    1576, 1581, 1610, 3, 1587, 1582, 1610, 3, 1606, 1580, 1610, 3,
+    1589, 1604, 1746, 3, 1602, 1604, 1746, 4, 1575, 1604, 1604, 1607,
+    4, 1575, 1603, 1576, 1585, 4, 1605, 1581, 1605, 1583, 4, 1589,
+    1604, 1593, 1605, 4, 1585, 1587, 1608, 1604, 4, 1593, 1604, 1610,
+    1607, 4, 1608, 1587, 1604, 1605, 3, 1589, 1604, 1609, 18, 1589,
+    1604, 1609, 32, 1575, 1604, 1604, 1607, 32, 1593, 1604, 1610, 1607,
+    32, 1608, 1587, 1604, 1605, 8, 1580, 1604, 32, 1580, 1604, 1575,
+    1604, 1607, 4, 1585, 1740, 1575, 1604, 1, 44, 1, 12289, 1,
+    12290, 1, 58, 1, 33, 1, 63, 1, 12310, 1, 12311, 1,
+    8212, 1, 8211, 1, 95, 1, 123, 1, 125, 1, 12308, 1,
+    12309, 1, 12304, 1, 12305, 1, 12298, 1, 12299, 1, 12300, 1,
+    12301, 1, 12302, 1, 12303, 1, 91, 1, 93, 1, 35, 1,
+    38, 1, 42, 1, 45, 1, 60, 1, 62, 1, 92, 1,
+    36, 1, 37, 1, 64, 2, 32, 1611, 2, 1600, 1611, 2,
+    32, 1612, 2, 32, 1613, 2, 32, 1614, 2, 1600, 1614, 2,
+    32, 1615, 2, 1600, 1615, 2, 32, 1616, 2, 1600, 1616, 2,
+    32, 1617, 2, 1600, 1617, 2, 32, 1618, 2, 1600, 1618, 1,
+    1569, 1, 1575, 1, 1576, 1, 1577, 1, 1578, 1, 1579, 1,
+    1580, 1, 1581, 1, 1582, 1, 1583, 1, 1584, 1, 1585, 1,
+    1586, 1, 1587, 1, 1588, 1, 1589, 1, 1590, 1, 1591, 1,
+    1592, 1, 1593, 1, 1594, 1, 1601, 1, 1602, 1, 1603, 1,
+    1604, 1, 1605, 1, 1606, 1, 1607, 1, 1608, 1, 1610, 3,
+    1604, 1575, 1619, 3, 1604, 1575, 1620, 3, 1604, 1575, 1621, 2,
+    1604, 1575, 1, 34, 1, 39, 1, 47, 1, 94, 1, 124,
+    1, 126, 1, 10629, 1, 10630, 1, 12539, 1, 12449, 1, 12451,
+    1, 12453, 1, 12455, 1, 12457, 1, 12515, 1, 12517, 1, 12519,
+    1, 12483, 1, 12540, 1, 12531, 1, 12441, 1, 12442, 1, 162,
+    1, 163, 1, 172, 1, 166, 1, 165, 1, 8361, 1, 9474,
+    1, 8592, 1, 8593, 1, 8594, 1, 8595, 1, 9632, 1, 9675,
+    1, 720, 1, 721, 1, 230, 1, 665, 1, 595, 1, 675,
+    1, 43878, 1, 677, 1, 676, 1, 598, 1, 599, 1, 7569,
+    1, 600, 1, 606, 1, 681, 1, 612, 1, 610, 1, 608,
+    1, 667, 1, 668, 1, 615, 1, 644, 1, 682, 1, 683,
+    1, 620, 2, 55351, 57092, 1, 42894, 1, 622, 2, 55351, 57093,
+    1, 654, 2, 55351, 57094, 1, 248, 1, 630, 1, 631, 1,
+    634, 2, 55351, 57096, 1, 637, 1, 638, 1, 640, 1, 680,
+    1, 678, 1, 43879, 1, 679, 1, 648, 1, 11377, 1, 655,
+    1, 673, 1, 674, 1, 664, 1, 448, 1, 449, 1, 450,
+    2, 55351, 57098, 2, 55351, 57118, 4, 55300, 56473, 55300, 56506, 4,
+    55300, 56475, 55300, 56506, 4, 55300, 56485, 55300, 56506, 4, 55300, 56625,
+    55300, 56615, 4, 55300, 56626, 55300, 56615, 4, 55300, 57159, 55300, 57150,
+    4, 55300, 57159, 55300, 57175, 4, 55301, 56505, 55301, 56506, 4, 55301,
+    56505, 55301, 56496, 4, 55301, 56505, 55301, 56509, 4, 55301, 56760, 55301,
+    56751, 4, 55301, 56761, 55301, 56751, 4, 55302, 56629, 55302, 56624, 4,
+    55348, 56663, 55348, 56677, 4, 55348, 56664, 55348, 56677, 6, 55348, 56664,
+    55348, 56677, 55348, 56686, 6, 55348, 56664, 55348, 56677, 55348, 56687, 6,
+    55348, 56664, 55348, 56677, 55348, 56688, 6, 55348, 56664, 55348, 56677, 55348,
+    56689, 6, 55348, 56664, 55348, 56677, 55348, 56690, 4, 55348, 56761, 55348,
+    56677, 4, 55348, 56762, 55348, 56677, 6, 55348, 56761, 55348, 56677, 55348,
+    56686, 6, 55348, 56762, 55348, 56677, 55348, 56686, 6, 55348, 56761, 55348,
+    56677, 55348, 56687, 6, 55348, 56762, 55348, 56677, 55348, 56687, 1, 305,
+    1, 567, 1, 913, 1, 914, 1, 916, 1, 917, 1, 918,
+    1, 919, 1, 921, 1, 922, 1, 923, 1, 924, 1, 925,
+    1, 926, 1, 927, 1, 929, 1, 932, 1, 934, 1, 935,
+    1, 936, 1, 8711, 1, 945, 1, 950, 1, 951, 1, 955,
+    1, 957, 1, 958, 1, 959, 1, 963, 1, 964, 1, 965,
+    1, 968, 1, 969, 1, 8706, 1, 988, 1, 989, 1, 1646,
+    1, 1697, 1, 1647, 2, 48, 46, 2, 48, 44, 2, 49,
+    44, 2, 50, 44, 2, 51, 44, 2, 52, 44, 2, 53,
+    44, 2, 54, 44, 2, 55, 44, 2, 56, 44, 2, 57,
+    44, 3, 40, 65, 41, 3, 40, 66, 41, 3, 40, 67,
+    41, 3, 40, 68, 41, 3, 40, 69, 41, 3, 40, 70,
+    41, 3, 40, 71, 41, 3, 40, 72, 41, 3, 40, 73,
+    41, 3, 40, 74, 41, 3, 40, 75, 41, 3, 40, 76,
+    41, 3, 40, 77, 41, 3, 40, 78, 41, 3, 40, 79,
+    41, 3, 40, 80, 41, 3, 40, 81, 41, 3, 40, 82,
+    41, 3, 40, 83, 41, 3, 40, 84, 41, 3, 40, 85,
+    41, 3, 40, 86, 41, 3, 40, 87, 41, 3, 40, 88,
+    41, 3, 40, 89, 41, 3, 40, 90, 41, 3, 12308, 83,
+    12309, 2, 67, 68, 2, 87, 90, 2, 72, 86, 2, 83,
+    68, 2, 83, 83, 3, 80, 80, 86, 2, 87, 67, 2,
+    77, 67, 2, 77, 68, 2, 77, 82, 2, 68, 74, 2,
+    12411, 12363, 2, 12467, 12467, 1, 23383, 1, 21452, 1, 22810, 1,
+    35299, 1, 20132, 1, 26144, 1, 28961, 1, 21069, 1, 24460, 1,
+    20877, 1, 26032, 1, 21021, 1, 32066, 1, 36009, 1, 22768, 1,
+    21561, 1, 28436, 1, 25237, 1, 25429, 1, 36938, 1, 25351, 1,
+    25171, 1, 31105, 1, 31354, 1, 21512, 1, 28288, 1, 30003, 1,
+    21106, 1, 21942, 1, 37197, 3, 12308, 26412, 12309, 3, 12308, 19977,
+    12309, 3, 12308, 20108, 12309, 3, 12308, 23433, 12309, 3, 12308, 28857,
+    12309, 3, 12308, 25171, 12309, 3, 12308, 30423, 12309, 3, 12308, 21213,
+    12309, 3, 12308, 25943, 12309, 1, 24471, 1, 21487, 1, 20029, 1,
+    20024, 1, 20033, 2, 55360, 56610, 1, 20320, 1, 20411, 1, 20482,
+    1, 20602, 1, 20633, 1, 20687, 1, 13470, 2, 55361, 56890, 1,
+    20820, 1, 20836, 1, 20855, 2, 55361, 56604, 1, 13497, 1, 20839,
+    2, 55361, 56651, 1, 20887, 1, 20900, 1, 20172, 1, 20908, 2,
+    55396, 56799, 1, 20995, 1, 13535, 1, 21051, 1, 21062, 1, 21111,
+    1, 13589, 1, 21253, 1, 21254, 1, 21321, 1, 21338, 1, 21363,
+    1, 21373, 1, 21375, 2, 55362, 56876, 1, 28784, 1, 21450, 1,
+    21471, 2, 55362, 57187, 1, 21483, 1, 21489, 1, 21510, 1, 21662,
+    1, 21560, 1, 21576, 1, 21608, 1, 21666, 1, 21750, 1, 21776,
+    1, 21843, 1, 21859, 1, 21892, 1, 21931, 1, 21939, 1, 21954,
+    1, 22294, 1, 22295, 1, 22097, 1, 22132, 1, 22766, 1, 22478,
+    1, 22516, 1, 22541, 1, 22411, 1, 22578, 1, 22577, 1, 22700,
+    2, 55365, 56548, 1, 22770, 1, 22775, 1, 22790, 1, 22818, 1,
+    22882, 2, 55365, 57000, 2, 55365, 57066, 1, 23020, 1, 23067, 1,
+    23079, 1, 23000, 1, 23142, 1, 14062, 1, 14076, 1, 23304, 1,
+    23358, 2, 55366, 56776, 1, 23491, 1, 23512, 1, 23539, 2, 55366,
+    57112, 1, 23551, 1, 23558, 1, 24403, 1, 14209, 1, 23648, 1,
+    23744, 1, 23693, 2, 55367, 56804, 1, 23875, 2, 55367, 56806, 1,
+    23918, 1, 23915, 1, 23932, 1, 24033, 1, 24034, 1, 14383, 1,
+    24061, 1, 24104, 1, 24125, 1, 24169, 1, 14434, 2, 55368, 56707,
+    1, 14460, 1, 24240, 1, 24243, 1, 24246, 2, 55400, 57234, 2,
+    55368, 57137, 1, 33281, 1, 24354, 1, 14535, 2, 55372, 57016, 2,
+    55384, 56794, 1, 24418, 1, 24427, 1, 14563, 1, 24474, 1, 24525,
+    1, 24535, 1, 24569, 1, 24705, 1, 14650, 1, 14620, 2, 55369,
+    57044, 1, 24775, 1, 24904, 1, 24908, 1, 24954, 1, 25010, 1,
+    24996, 1, 25007, 1, 25054, 1, 25104, 1, 25115, 1, 25181, 1,
+    25265, 1, 25300, 1, 25424, 2, 55370, 57100, 1, 25405, 1, 25340,
+    1, 25448, 1, 25475, 1, 25572, 2, 55370, 57329, 1, 25634, 1,
+    25541, 1, 25513, 1, 14894, 1, 25705, 1, 25726, 1, 25757, 1,
+    25719, 1, 14956, 1, 25964, 2, 55372, 56330, 1, 26083, 1, 26360,
+    1, 26185, 1, 15129, 1, 15112, 1, 15076, 1, 20882, 1, 20885,
+    1, 26368, 1, 26268, 1, 32941, 1, 17369, 1, 26401, 1, 26462,
+    1, 26451, 2, 55372, 57283, 1, 15177, 1, 26618, 1, 26501, 1,
+    26706, 2, 55373, 56429, 1, 26766, 1, 26655, 1, 26900, 1, 26946,
+    1, 27043, 1, 27114, 1, 27304, 2, 55373, 56995, 1, 27355, 1,
+    15384, 1, 27425, 2, 55374, 56487, 1, 27476, 1, 15438, 1, 27506,
+    1, 27551, 1, 27579, 2, 55374, 56973, 2, 55367, 56587, 2, 55374,
+    57082, 1, 27726, 2, 55375, 56508, 1, 27839, 1, 27853, 1, 27751,
+    1, 27926, 1, 27966, 1, 28009, 1, 28024, 1, 28037, 2, 55375,
+    56606, 1, 27956, 1, 28207, 1, 28270, 1, 15667, 1, 28359, 2,
+    55375, 57041, 1, 28153, 1, 28526, 2, 55375, 57182, 2, 55375, 57230,
+    1, 28614, 1, 28729, 1, 28699, 1, 15766, 1, 28746, 1, 28797,
+    1, 28791, 1, 28845, 2, 55361, 56613, 1, 28997, 2, 55376, 56931,
+    1, 29084, 2, 55376, 57259, 1, 29224, 1, 29264, 2, 55377, 56840,
+    1, 29312, 1, 29333, 2, 55377, 57141, 2, 55378, 56340, 1, 29562,
+    1, 29579, 1, 16044, 1, 29605, 1, 16056, 1, 29767, 1, 29788,
+    1, 29829, 1, 29898, 1, 16155, 1, 29988, 2, 55379, 56374, 1,
+    30014, 2, 55379, 56466, 2, 55368, 56735, 1, 30224, 2, 55379, 57249,
+    2, 55379, 57272, 2, 55380, 56388, 1, 16380, 1, 16392, 2, 55380,
+    56563, 2, 55380, 56562, 2, 55380, 56601, 2, 55380, 56627, 1, 30494,
+    1, 30495, 1, 30603, 1, 16454, 1, 16534, 2, 55381, 56349, 1,
+    30798, 1, 16611, 2, 55381, 56870, 2, 55381, 56986, 2, 55381, 57029,
+    1, 31211, 1, 16687, 1, 31306, 1, 31311, 2, 55382, 56700, 2,
+    55382, 56999, 1, 31470, 1, 16898, 2, 55382, 57259, 1, 31686, 1,
+    31689, 1, 16935, 2, 55383, 56448, 1, 31954, 1, 17056, 1, 31976,
+    1, 31971, 1, 32000, 2, 55383, 57222, 1, 32099, 1, 17153, 1,
+    32199, 1, 32258, 1, 32325, 1, 17204, 2, 55384, 56872, 2, 55384,
+    56903, 1, 17241, 2, 55384, 57049, 1, 32634, 2, 55384, 57150, 1,
+    32661, 1, 32762, 2, 55385, 56538, 2, 55385, 56611, 1, 32864, 2,
+    55385, 56744, 1, 32880, 2, 55372, 57183, 1, 17365, 1, 32946, 1,
+    33027, 1, 17419, 1, 33086, 1, 23221, 2, 55385, 57255, 2, 55385,
+    57269, 2, 55372, 57235, 2, 55372, 57244, 1, 33284, 1, 36766, 1,
+    17515, 1, 33425, 1, 33419, 1, 33437, 1, 21171, 1, 33457, 1,
+    33459, 1, 33469, 1, 33510, 2, 55386, 57148, 1, 33565, 1, 33635,
+    1, 33709, 1, 33571, 1, 33725, 1, 33767, 1, 33619, 1, 33738,
+    1, 33740, 1, 33756, 2, 55387, 56374, 2, 55387, 56683, 2, 55387,
+    56533, 1, 17707, 1, 34033, 1, 34035, 1, 34070, 2, 55388, 57290,
+    1, 34148, 2, 55387, 57132, 1, 17757, 1, 17761, 2, 55387, 57265,
+    2, 55388, 56530, 1, 17771, 1, 34384, 1, 34407, 1, 34409, 1,
+    34473, 1, 34440, 1, 34574, 1, 34530, 1, 34600, 1, 34667, 1,
+    34694, 1, 17879, 1, 34785, 1, 34817, 1, 17913, 1, 34912, 2,
+    55389, 56935, 1, 35031, 1, 35038, 1, 17973, 1, 35066, 1, 13499,
+    2, 55390, 56494, 2, 55390, 56678, 1, 18110, 1, 18119, 1, 35488,
+    2, 55391, 56488, 1, 36011, 1, 36033, 1, 36123, 1, 36215, 2,
+    55391, 57135, 2, 55362, 56324, 1, 36299, 1, 36284, 1, 36336, 2,
+    55362, 56542, 1, 36564, 2, 55393, 56786, 2, 55393, 56813, 1, 37012,
+    1, 37105, 1, 37137, 2, 55393, 57134, 1, 37147, 1, 37432, 1,
+    37591, 1, 37592, 1, 37500, 1, 37881, 1, 37909, 2, 55394, 57338,
+    1, 38283, 1, 18837, 1, 38327, 2, 55395, 56695, 1, 18918, 1,
+    38595, 1, 23986, 1, 38691, 2, 55396, 56645, 2, 55396, 56858, 1,
+    19054, 1, 19062, 1, 38880, 2, 55397, 56330, 1, 19122, 2, 55397,
+    56470, 1, 38953, 2, 55397, 56758, 1, 39138, 1, 19251, 1, 39209,
+    1, 39335, 1, 39362, 1, 39422, 1, 19406, 2, 55398, 57136, 1,
+    40000, 1, 40189, 1, 19662, 1, 19693, 1, 40295, 2, 55400, 56526,
+    1, 19704, 2, 55400, 56581, 2, 55400, 56846, 2, 55400, 56977, 1,
+    19798, 1, 40702, 1, 40709, 1, 40719, 1, 40726, 2, 55401, 56832,
+};
+
+// Primary composites sorted by the pair of code points.
+static uint32_t const nfkc_compositions[941][3] = {
+    {0x003c, 0x0338, 0x226e},
+    {0x003d, 0x0338, 0x2260},
+    {0x003e, 0x0338, 0x226f},
+    {0x0041, 0x0300, 0x00c0},
+    {0x0041, 0x0301, 0x00c1},
+    {0x0041, 0x0302, 0x00c2},
+    {0x0041, 0x0303, 0x00c3},
+    {0x0041, 0x0304, 0x0100},
+    {0x0041, 0x0306, 0x0102},
+    {0x0041, 0x0307, 0x0226},
+    {0x0041, 0x0308, 0x00c4},
+    {0x0041, 0x0309, 0x1ea2},
+    {0x0041, 0x030a, 0x00c5},
+    {0x0041, 0x030c, 0x01cd},
+    {0x0041, 0x030f, 0x0200},
+    {0x0041, 0x0311, 0x0202},
+    {0x0041, 0x0323, 0x1ea0},
+    {0x0041, 0x0325, 0x1e00},
+    {0x0041, 0x0328, 0x0104},
+    {0x0042, 0x0307, 0x1e02},
+    {0x0042, 0x0323, 0x1e04},
+    {0x0042, 0x0331, 0x1e06},
+    {0x0043, 0x0301, 0x0106},
+    {0x0043, 0x0302, 0x0108},
+    {0x0043, 0x0307, 0x010a},
+    {0x0043, 0x030c, 0x010c},
+    {0x0043, 0x0327, 0x00c7},
+    {0x0044, 0x0307, 0x1e0a},
+    {0x0044, 0x030c, 0x010e},
+    {0x0044, 0x0323, 0x1e0c},
+    {0x0044, 0x0327, 0x1e10},
+    {0x0044, 0x032d, 0x1e12},
+    {0x0044, 0x0331, 0x1e0e},
+    {0x0045, 0x0300, 0x00c8},
+    {0x0045, 0x0301, 0x00c9},
+    {0x0045, 0x0302, 0x00ca},
+    {0x0045, 0x0303, 0x1ebc},
+    {0x0045, 0x0304, 0x0112},
+    {0x0045, 0x0306, 0x0114},
+    {0x0045, 0x0307, 0x0116},
+    {0x0045, 0x0308, 0x00cb},
+    {0x0045, 0x0309, 0x1eba},
+    {0x0045, 0x030c, 0x011a},
+    {0x0045, 0x030f, 0x0204},
+    {0x0045, 0x0311, 0x0206},
+    {0x0045, 0x0323, 0x1eb8},
+    {0x0045, 0x0327, 0x0228},
+    {0x0045, 0x0328, 0x0118},
+    {0x0045, 0x032d, 0x1e18},
+    {0x0045, 0x0330, 0x1e1a},
+    {0x0046, 0x0307, 0x1e1e},
+    {0x0047, 0x0301, 0x01f4},
+    {0x0047, 0x0302, 0x011c},
+    {0x0047, 0x0304, 0x1e20},
+    {0x0047, 0x0306, 0x011e},
+    {0x0047, 0x0307, 0x0120},
+    {0x0047, 0x030c, 0x01e6},
+    {0x0047, 0x0327, 0x0122},
+    {0x0048, 0x0302, 0x0124},
+    {0x0048, 0x0307, 0x1e22},
+    {0x0048, 0x0308, 0x1e26},
+    {0x0048, 0x030c, 0x021e},
+    {0x0048, 0x0323, 0x1e24},
+    {0x0048, 0x0327, 0x1e28},
+    {0x0048, 0x032e, 0x1e2a},
+    {0x0049, 0x0300, 0x00cc},
+    {0x0049, 0x0301, 0x00cd},
+    {0x0049, 0x0302, 0x00ce},
+    {0x0049, 0x0303, 0x0128},
+    {0x0049, 0x0304, 0x012a},
+    {0x0049, 0x0306, 0x012c},
+    {0x0049, 0x0307, 0x0130},
+    {0x0049, 0x0308, 0x00cf},
+    {0x0049, 0x0309, 0x1ec8},
+    {0x0049, 0x030c, 0x01cf},
+    {0x0049, 0x030f, 0x0208},
+    {0x0049, 0x0311, 0x020a},
+    {0x0049, 0x0323, 0x1eca},
+    {0x0049, 0x0328, 0x012e},
+    {0x0049, 0x0330, 0x1e2c},
+    {0x004a, 0x0302, 0x0134},
+    {0x004b, 0x0301, 0x1e30},
+    {0x004b, 0x030c, 0x01e8},
+    {0x004b, 0x0323, 0x1e32},
+    {0x004b, 0x0327, 0x0136},
+    {0x004b, 0x0331, 0x1e34},
+    {0x004c, 0x0301, 0x0139},
+    {0x004c, 0x030c, 0x013d},
+    {0x004c, 0x0323, 0x1e36},
+    {0x004c, 0x0327, 0x013b},
+    {0x004c, 0x032d, 0x1e3c},
+    {0x004c, 0x0331, 0x1e3a},
+    {0x004d, 0x0301, 0x1e3e},
+    {0x004d, 0x0307, 0x1e40},
+    {0x004d, 0x0323, 0x1e42},
+    {0x004e, 0x0300, 0x01f8},
+    {0x004e, 0x0301, 0x0143},
+    {0x004e, 0x0303, 0x00d1},
+    {0x004e, 0x0307, 0x1e44},
+    {0x004e, 0x030c, 0x0147},
+    {0x004e, 0x0323, 0x1e46},
+    {0x004e, 0x0327, 0x0145},
+    {0x004e, 0x032d, 0x1e4a},
+    {0x004e, 0x0331, 0x1e48},
+    {0x004f, 0x0300, 0x00d2},
+    {0x004f, 0x0301, 0x00d3},
+    {0x004f, 0x0302, 0x00d4},
+    {0x004f, 0x0303, 0x00d5},
+    {0x004f, 0x0304, 0x014c},
+    {0x004f, 0x0306, 0x014e},
+    {0x004f, 0x0307, 0x022e},
+    {0x004f, 0x0308, 0x00d6},
+    {0x004f, 0x0309, 0x1ece},
+    {0x004f, 0x030b, 0x0150},
+    {0x004f, 0x030c, 0x01d1},
+    {0x004f, 0x030f, 0x020c},
+    {0x004f, 0x0311, 0x020e},
+    {0x004f, 0x031b, 0x01a0},
+    {0x004f, 0x0323, 0x1ecc},
+    {0x004f, 0x0328, 0x01ea},
+    {0x0050, 0x0301, 0x1e54},
+    {0x0050, 0x0307, 0x1e56},
+    {0x0052, 0x0301, 0x0154},
+    {0x0052, 0x0307, 0x1e58},
+    {0x0052, 0x030c, 0x0158},
+    {0x0052, 0x030f, 0x0210},
+    {0x0052, 0x0311, 0x0212},
+    {0x0052, 0x0323, 0x1e5a},
+    {0x0052, 0x0327, 0x0156},
+    {0x0052, 0x0331, 0x1e5e},
+    {0x0053, 0x0301, 0x015a},
+    {0x0053, 0x0302, 0x015c},
+    {0x0053, 0x0307, 0x1e60},
+    {0x0053, 0x030c, 0x0160},
+    {0x0053, 0x0323, 0x1e62},
+    {0x0053, 0x0326, 0x0218},
+    {0x0053, 0x0327, 0x015e},
+    {0x0054, 0x0307, 0x1e6a},
+    {0x0054, 0x030c, 0x0164},
+    {0x0054, 0x0323, 0x1e6c},
+    {0x0054, 0x0326, 0x021a},
+    {0x0054, 0x0327, 0x0162},
+    {0x0054, 0x032d, 0x1e70},
+    {0x0054, 0x0331, 0x1e6e},
+    {0x0055, 0x0300, 0x00d9},
+    {0x0055, 0x0301, 0x00da},
+    {0x0055, 0x0302, 0x00db},
+    {0x0055, 0x0303, 0x0168},
+    {0x0055, 0x0304, 0x016a},
+    {0x0055, 0x0306, 0x016c},
+    {0x0055, 0x0308, 0x00dc},
+    {0x0055, 0x0309, 0x1ee6},
+    {0x0055, 0x030a, 0x016e},
+    {0x0055, 0x030b, 0x0170},
+    {0x0055, 0x030c, 0x01d3},
+    {0x0055, 0x030f, 0x0214},
+    {0x0055, 0x0311, 0x0216},
+    {0x0055, 0x031b, 0x01af},
+    {0x0055, 0x0323, 0x1ee4},
+    {0x0055, 0x0324, 0x1e72},
+    {0x0055, 0x0328, 0x0172},
+    {0x0055, 0x032d, 0x1e76},
+    {0x0055, 0x0330, 0x1e74},
+    {0x0056, 0x0303, 0x1e7c},
+    {0x0056, 0x0323, 0x1e7e},
+    {0x0057, 0x0300, 0x1e80},
+    {0x0057, 0x0301, 0x1e82},
+    {0x0057, 0x0302, 0x0174},
+    {0x0057, 0x0307, 0x1e86},
+    {0x0057, 0x0308, 0x1e84},
+    {0x0057, 0x0323, 0x1e88},
+    {0x0058, 0x0307, 0x1e8a},
+    {0x0058, 0x0308, 0x1e8c},
+    {0x0059, 0x0300, 0x1ef2},
+    {0x0059, 0x0301, 0x00dd},
+    {0x0059, 0x0302, 0x0176},
+    {0x0059, 0x0303, 0x1ef8},
+    {0x0059, 0x0304, 0x0232},
+    {0x0059, 0x0307, 0x1e8e},
+    {0x0059, 0x0308, 0x0178},
+    {0x0059, 0x0309, 0x1ef6},
+    {0x0059, 0x0323, 0x1ef4},
+    {0x005a, 0x0301, 0x0179},
+    {0x005a, 0x0302, 0x1e90},
+    {0x005a, 0x0307, 0x017b},
+    {0x005a, 0x030c, 0x017d},
+    {0x005a, 0x0323, 0x1e92},
+    {0x005a, 0x0331, 0x1e94},
+    {0x0061, 0x0300, 0x00e0},
+    {0x0061, 0x0301, 0x00e1},
+    {0x0061, 0x0302, 0x00e2},
+    {0x0061, 0x0303, 0x00e3},
+    {0x0061, 0x0304, 0x0101},
+    {0x0061, 0x0306, 0x0103},
+    {0x0061, 0x0307, 0x0227},
+    {0x0061, 0x0308, 0x00e4},
+    {0x0061, 0x0309, 0x1ea3},
+    {0x0061, 0x030a, 0x00e5},
+    {0x0061, 0x030c, 0x01ce},
+    {0x0061, 0x030f, 0x0201},
+    {0x0061, 0x0311, 0x0203},
+    {0x0061, 0x0323, 0x1ea1},
+    {0x0061, 0x0325, 0x1e01},
+    {0x0061, 0x0328, 0x0105},
+    {0x0062, 0x0307, 0x1e03},
+    {0x0062, 0x0323, 0x1e05},
+    {0x0062, 0x0331, 0x1e07},
+    {0x0063, 0x0301, 0x0107},
+    {0x0063, 0x0302, 0x0109},
+    {0x0063, 0x0307, 0x010b},
+    {0x0063, 0x030c, 0x010d},
+    {0x0063, 0x0327, 0x00e7},
+    {0x0064, 0x0307, 0x1e0b},
+    {0x0064, 0x030c, 0x010f},
+    {0x0064, 0x0323, 0x1e0d},
+    {0x0064, 0x0327, 0x1e11},
+    {0x0064, 0x032d, 0x1e13},
+    {0x0064, 0x0331, 0x1e0f},
+    {0x0065, 0x0300, 0x00e8},
+    {0x0065, 0x0301, 0x00e9},
+    {0x0065, 0x0302, 0x00ea},
+    {0x0065, 0x0303, 0x1ebd},
+    {0x0065, 0x0304, 0x0113},
+    {0x0065, 0x0306, 0x0115},
+    {0x0065, 0x0307, 0x0117},
+    {0x0065, 0x0308, 0x00eb},
+    {0x0065, 0x0309, 0x1ebb},
+    {0x0065, 0x030c, 0x011b},
+    {0x0065, 0x030f, 0x0205},
+    {0x0065, 0x0311, 0x0207},
+    {0x0065, 0x0323, 0x1eb9},
+    {0x0065, 0x0327, 0x0229},
+    {0x0065, 0x0328, 0x0119},
+    {0x0065, 0x032d, 0x1e19},
+    {0x0065, 0x0330, 0x1e1b},
+    {0x0066, 0x0307, 0x1e1f},
+    {0x0067, 0x0301, 0x01f5},
+    {0x0067, 0x0302, 0x011d},
+    {0x0067, 0x0304, 0x1e21},
+    {0x0067, 0x0306, 0x011f},
+    {0x0067, 0x0307, 0x0121},
+    {0x0067, 0x030c, 0x01e7},
+    {0x0067, 0x0327, 0x0123},
+    {0x0068, 0x0302, 0x0125},
+    {0x0068, 0x0307, 0x1e23},
+    {0x0068, 0x0308, 0x1e27},
+    {0x0068, 0x030c, 0x021f},
+    {0x0068, 0x0323, 0x1e25},
+    {0x0068, 0x0327, 0x1e29},
+    {0x0068, 0x032e, 0x1e2b},
+    {0x0068, 0x0331, 0x1e96},
+    {0x0069, 0x0300, 0x00ec},
+    {0x0069, 0x0301, 0x00ed},
+    {0x0069, 0x0302, 0x00ee},
+    {0x0069, 0x0303, 0x0129},
+    {0x0069, 0x0304, 0x012b},
+    {0x0069, 0x0306, 0x012d},
+    {0x0069, 0x0308, 0x00ef},
+    {0x0069, 0x0309, 0x1ec9},
+    {0x0069, 0x030c, 0x01d0},
+    {0x0069, 0x030f, 0x0209},
+    {0x0069, 0x0311, 0x020b},
+    {0x0069, 0x0323, 0x1ecb},
+    {0x0069, 0x0328, 0x012f},
+    {0x0069, 0x0330, 0x1e2d},
+    {0x006a, 0x0302, 0x0135},
+    {0x006a, 0x030c, 0x01f0},
+    {0x006b, 0x0301, 0x1e31},
+    {0x006b, 0x030c, 0x01e9},
+    {0x006b, 0x0323, 0x1e33},
+    {0x006b, 0x0327, 0x0137},
+    {0x006b, 0x0331, 0x1e35},
+    {0x006c, 0x0301, 0x013a},
+    {0x006c, 0x030c, 0x013e},
+    {0x006c, 0x0323, 0x1e37},
+    {0x006c, 0x0327, 0x013c},
+    {0x006c, 0x032d, 0x1e3d},
+    {0x006c, 0x0331, 0x1e3b},
+    {0x006d, 0x0301, 0x1e3f},
+    {0x006d, 0x0307, 0x1e41},
+    {0x006d, 0x0323, 0x1e43},
+    {0x006e, 0x0300, 0x01f9},
+    {0x006e, 0x0301, 0x0144},
+    {0x006e, 0x0303, 0x00f1},
+    {0x006e, 0x0307, 0x1e45},
+    {0x006e, 0x030c, 0x0148},
+    {0x006e, 0x0323, 0x1e47},
+    {0x006e, 0x0327, 0x0146},
+    {0x006e, 0x032d, 0x1e4b},
+    {0x006e, 0x0331, 0x1e49},
+    {0x006f, 0x0300, 0x00f2},
+    {0x006f, 0x0301, 0x00f3},
+    {0x006f, 0x0302, 0x00f4},
+    {0x006f, 0x0303, 0x00f5},
+    {0x006f, 0x0304, 0x014d},
+    {0x006f, 0x0306, 0x014f},
+    {0x006f, 0x0307, 0x022f},
+    {0x006f, 0x0308, 0x00f6},
+    {0x006f, 0x0309, 0x1ecf},
+    {0x006f, 0x030b, 0x0151},
+    {0x006f, 0x030c, 0x01d2},
+    {0x006f, 0x030f, 0x020d},
+    {0x006f, 0x0311, 0x020f},
+    {0x006f, 0x031b, 0x01a1},
+    {0x006f, 0x0323, 0x1ecd},
+    {0x006f, 0x0328, 0x01eb},
+    {0x0070, 0x0301, 0x1e55},
+    {0x0070, 0x0307, 0x1e57},
+    {0x0072, 0x0301, 0x0155},
+    {0x0072, 0x0307, 0x1e59},
+    {0x0072, 0x030c, 0x0159},
+    {0x0072, 0x030f, 0x0211},
+    {0x0072, 0x0311, 0x0213},
+    {0x0072, 0x0323, 0x1e5b},
+    {0x0072, 0x0327, 0x0157},
+    {0x0072, 0x0331, 0x1e5f},
+    {0x0073, 0x0301, 0x015b},
+    {0x0073, 0x0302, 0x015d},
+    {0x0073, 0x0307, 0x1e61},
+    {0x0073, 0x030c, 0x0161},
+    {0x0073, 0x0323, 0x1e63},
+    {0x0073, 0x0326, 0x0219},
+    {0x0073, 0x0327, 0x015f},
+    {0x0074, 0x0307, 0x1e6b},
+    {0x0074, 0x0308, 0x1e97},
+    {0x0074, 0x030c, 0x0165},
+    {0x0074, 0x0323, 0x1e6d},
+    {0x0074, 0x0326, 0x021b},
+    {0x0074, 0x0327, 0x0163},
+    {0x0074, 0x032d, 0x1e71},
+    {0x0074, 0x0331, 0x1e6f},
+    {0x0075, 0x0300, 0x00f9},
+    {0x0075, 0x0301, 0x00fa},
+    {0x0075, 0x0302, 0x00fb},
+    {0x0075, 0x0303, 0x0169},
+    {0x0075, 0x0304, 0x016b},
+    {0x0075, 0x0306, 0x016d},
+    {0x0075, 0x0308, 0x00fc},
+    {0x0075, 0x0309, 0x1ee7},
+    {0x0075, 0x030a, 0x016f},
+    {0x0075, 0x030b, 0x0171},
+    {0x0075, 0x030c, 0x01d4},
+    {0x0075, 0x030f, 0x0215},
+    {0x0075, 0x0311, 0x0217},
+    {0x0075, 0x031b, 0x01b0},
+    {0x0075, 0x0323, 0x1ee5},
+    {0x0075, 0x0324, 0x1e73},
+    {0x0075, 0x0328, 0x0173},
+    {0x0075, 0x032d, 0x1e77},
+    {0x0075, 0x0330, 0x1e75},
+    {0x0076, 0x0303, 0x1e7d},
+    {0x0076, 0x0323, 0x1e7f},
+    {0x0077, 0x0300, 0x1e81},
+    {0x0077, 0x0301, 0x1e83},
+    {0x0077, 0x0302, 0x0175},
+    {0x0077, 0x0307, 0x1e87},
+    {0x0077, 0x0308, 0x1e85},
+    {0x0077, 0x030a, 0x1e98},
+    {0x0077, 0x0323, 0x1e89},
+    {0x0078, 0x0307, 0x1e8b},
+    {0x0078, 0x0308, 0x1e8d},
+    {0x0079, 0x0300, 0x1ef3},
+    {0x0079, 0x0301, 0x00fd},
+    {0x0079, 0x0302, 0x0177},
+    {0x0079, 0x0303, 0x1ef9},
+    {0x0079, 0x0304, 0x0233},
+    {0x0079, 0x0307, 0x1e8f},
+    {0x0079, 0x0308, 0x00ff},
+    {0x0079, 0x0309, 0x1ef7},
+    {0x0079, 0x030a, 0x1e99},
+    {0x0079, 0x0323, 0x1ef5},
+    {0x007a, 0x0301, 0x017a},
+    {0x007a, 0x0302, 0x1e91},
+    {0x007a, 0x0307, 0x017c},
+    {0x007a, 0x030c, 0x017e},
+    {0x007a, 0x0323, 0x1e93},
+    {0x007a, 0x0331, 0x1e95},
+    {0x00a8, 0x0300, 0x1fed},
+    {0x00a8, 0x0301, 0x0385},
+    {0x00a8, 0x0342, 0x1fc1},
+    {0x00c2, 0x0300, 0x1ea6},
+    {0x00c2, 0x0301, 0x1ea4},
+    {0x00c2, 0x0303, 0x1eaa},
+    {0x00c2, 0x0309, 0x1ea8},
+    {0x00c4, 0x0304, 0x01de},
+    {0x00c5, 0x0301, 0x01fa},
+    {0x00c6, 0x0301, 0x01fc},
+    {0x00c6, 0x0304, 0x01e2},
+    {0x00c7, 0x0301, 0x1e08},
+    {0x00ca, 0x0300, 0x1ec0},
+    {0x00ca, 0x0301, 0x1ebe},
+    {0x00ca, 0x0303, 0x1ec4},
+    {0x00ca, 0x0309, 0x1ec2},
+    {0x00cf, 0x0301, 0x1e2e},
+    {0x00d4, 0x0300, 0x1ed2},
+    {0x00d4, 0x0301, 0x1ed0},
+    {0x00d4, 0x0303, 0x1ed6},
+    {0x00d4, 0x0309, 0x1ed4},
+    {0x00d5, 0x0301, 0x1e4c},
+    {0x00d5, 0x0304, 0x022c},
+    {0x00d5, 0x0308, 0x1e4e},
+    {0x00d6, 0x0304, 0x022a},
+    {0x00d8, 0x0301, 0x01fe},
+    {0x00dc, 0x0300, 0x01db},
+    {0x00dc, 0x0301, 0x01d7},
+    {0x00dc, 0x0304, 0x01d5},
+    {0x00dc, 0x030c, 0x01d9},
+    {0x00e2, 0x0300, 0x1ea7},
+    {0x00e2, 0x0301, 0x1ea5},
+    {0x00e2, 0x0303, 0x1eab},
+    {0x00e2, 0x0309, 0x1ea9},
+    {0x00e4, 0x0304, 0x01df},
+    {0x00e5, 0x0301, 0x01fb},
+    {0x00e6, 0x0301, 0x01fd},
+    {0x00e6, 0x0304, 0x01e3},
+    {0x00e7, 0x0301, 0x1e09},
+    {0x00ea, 0x0300, 0x1ec1},
+    {0x00ea, 0x0301, 0x1ebf},
+    {0x00ea, 0x0303, 0x1ec5},
+    {0x00ea, 0x0309, 0x1ec3},
+    {0x00ef, 0x0301, 0x1e2f},
+    {0x00f4, 0x0300, 0x1ed3},
+    {0x00f4, 0x0301, 0x1ed1},
+    {0x00f4, 0x0303, 0x1ed7},
+    {0x00f4, 0x0309, 0x1ed5},
+    {0x00f5, 0x0301, 0x1e4d},
+    {0x00f5, 0x0304, 0x022d},
+    {0x00f5, 0x0308, 0x1e4f},
+    {0x00f6, 0x0304, 0x022b},
+    {0x00f8, 0x0301, 0x01ff},
+    {0x00fc, 0x0300, 0x01dc},
+    {0x00fc, 0x0301, 0x01d8},
+    {0x00fc, 0x0304, 0x01d6},
+    {0x00fc, 0x030c, 0x01da},
+    {0x0102, 0x0300, 0x1eb0},
+    {0x0102, 0x0301, 0x1eae},
+    {0x0102, 0x0303, 0x1eb4},
+    {0x0102, 0x0309, 0x1eb2},
+    {0x0103, 0x0300, 0x1eb1},
+    {0x0103, 0x0301, 0x1eaf},
+    {0x0103, 0x0303, 0x1eb5},
+    {0x0103, 0x0309, 0x1eb3},
+    {0x0112, 0x0300, 0x1e14},
+    {0x0112, 0x0301, 0x1e16},
+    {0x0113, 0x0300, 0x1e15},
+    {0x0113, 0x0301, 0x1e17},
+    {0x014c, 0x0300, 0x1e50},
+    {0x014c, 0x0301, 0x1e52},
+    {0x014d, 0x0300, 0x1e51},
+    {0x014d, 0x0301, 0x1e53},
+    {0x015a, 0x0307, 0x1e64},
+    {0x015b, 0x0307, 0x1e65},
+    {0x0160, 0x0307, 0x1e66},
+    {0x0161, 0x0307, 0x1e67},
+    {0x0168, 0x0301, 0x1e78},
+    {0x0169, 0x0301, 0x1e79},
+    {0x016a, 0x0308, 0x1e7a},
+    {0x016b, 0x0308, 0x1e7b},
+    {0x017f, 0x0307, 0x1e9b},
+    {0x01a0, 0x0300, 0x1edc},
+    {0x01a0, 0x0301, 0x1eda},
+    {0x01a0, 0x0303, 0x1ee0},
+    {0x01a0, 0x0309, 0x1ede},
+    {0x01a0, 0x0323, 0x1ee2},
+    {0x01a1, 0x0300, 0x1edd},
+    {0x01a1, 0x0301, 0x1edb},
+    {0x01a1, 0x0303, 0x1ee1},
+    {0x01a1, 0x0309, 0x1edf},
+    {0x01a1, 0x0323, 0x1ee3},
+    {0x01af, 0x0300, 0x1eea},
+    {0x01af, 0x0301, 0x1ee8},
+    {0x01af, 0x0303, 0x1eee},
+    {0x01af, 0x0309, 0x1eec},
+    {0x01af, 0x0323, 0x1ef0},
+    {0x01b0, 0x0300, 0x1eeb},
+    {0x01b0, 0x0301, 0x1ee9},
+    {0x01b0, 0x0303, 0x1eef},
+    {0x01b0, 0x0309, 0x1eed},
+    {0x01b0, 0x0323, 0x1ef1},
+    {0x01b7, 0x030c, 0x01ee},
+    {0x01ea, 0x0304, 0x01ec},
+    {0x01eb, 0x0304, 0x01ed},
+    {0x0226, 0x0304, 0x01e0},
+    {0x0227, 0x0304, 0x01e1},
+    {0x0228, 0x0306, 0x1e1c},
+    {0x0229, 0x0306, 0x1e1d},
+    {0x022e, 0x0304, 0x0230},
+    {0x022f, 0x0304, 0x0231},
+    {0x0292, 0x030c, 0x01ef},
+    {0x0391, 0x0300, 0x1fba},
+    {0x0391, 0x0301, 0x0386},
+    {0x0391, 0x0304, 0x1fb9},
+    {0x0391, 0x0306, 0x1fb8},
+    {0x0391, 0x0313, 0x1f08},
+    {0x0391, 0x0314, 0x1f09},
+    {0x0391, 0x0345, 0x1fbc},
+    {0x0395, 0x0300, 0x1fc8},
+    {0x0395, 0x0301, 0x0388},
+    {0x0395, 0x0313, 0x1f18},
+    {0x0395, 0x0314, 0x1f19},
+    {0x0397, 0x0300, 0x1fca},
+    {0x0397, 0x0301, 0x0389},
+    {0x0397, 0x0313, 0x1f28},
+    {0x0397, 0x0314, 0x1f29},
+    {0x0397, 0x0345, 0x1fcc},
+    {0x0399, 0x0300, 0x1fda},
+    {0x0399, 0x0301, 0x038a},
+    {0x0399, 0x0304, 0x1fd9},
+    {0x0399, 0x0306, 0x1fd8},
+    {0x0399, 0x0308, 0x03aa},
+    {0x0399, 0x0313, 0x1f38},
+    {0x0399, 0x0314, 0x1f39},
+    {0x039f, 0x0300, 0x1ff8},
+    {0x039f, 0x0301, 0x038c},
+    {0x039f, 0x0313, 0x1f48},
+    {0x039f, 0x0314, 0x1f49},
+    {0x03a1, 0x0314, 0x1fec},
+    {0x03a5, 0x0300, 0x1fea},
+    {0x03a5, 0x0301, 0x038e},
+    {0x03a5, 0x0304, 0x1fe9},
+    {0x03a5, 0x0306, 0x1fe8},
+    {0x03a5, 0x0308, 0x03ab},
+    {0x03a5, 0x0314, 0x1f59},
+    {0x03a9, 0x0300, 0x1ffa},
+    {0x03a9, 0x0301, 0x038f},
+    {0x03a9, 0x0313, 0x1f68},
+    {0x03a9, 0x0314, 0x1f69},
+    {0x03a9, 0x0345, 0x1ffc},
+    {0x03ac, 0x0345, 0x1fb4},
+    {0x03ae, 0x0345, 0x1fc4},
+    {0x03b1, 0x0300, 0x1f70},
+    {0x03b1, 0x0301, 0x03ac},
+    {0x03b1, 0x0304, 0x1fb1},
+    {0x03b1, 0x0306, 0x1fb0},
+    {0x03b1, 0x0313, 0x1f00},
+    {0x03b1, 0x0314, 0x1f01},
+    {0x03b1, 0x0342, 0x1fb6},
+    {0x03b1, 0x0345, 0x1fb3},
+    {0x03b5, 0x0300, 0x1f72},
+    {0x03b5, 0x0301, 0x03ad},
+    {0x03b5, 0x0313, 0x1f10},
+    {0x03b5, 0x0314, 0x1f11},
+    {0x03b7, 0x0300, 0x1f74},
+    {0x03b7, 0x0301, 0x03ae},
+    {0x03b7, 0x0313, 0x1f20},
+    {0x03b7, 0x0314, 0x1f21},
+    {0x03b7, 0x0342, 0x1fc6},
+    {0x03b7, 0x0345, 0x1fc3},
+    {0x03b9, 0x0300, 0x1f76},
+    {0x03b9, 0x0301, 0x03af},
+    {0x03b9, 0x0304, 0x1fd1},
+    {0x03b9, 0x0306, 0x1fd0},
+    {0x03b9, 0x0308, 0x03ca},
+    {0x03b9, 0x0313, 0x1f30},
+    {0x03b9, 0x0314, 0x1f31},
+    {0x03b9, 0x0342, 0x1fd6},
+    {0x03bf, 0x0300, 0x1f78},
+    {0x03bf, 0x0301, 0x03cc},
+    {0x03bf, 0x0313, 0x1f40},
+    {0x03bf, 0x0314, 0x1f41},
+    {0x03c1, 0x0313, 0x1fe4},
+    {0x03c1, 0x0314, 0x1fe5},
+    {0x03c5, 0x0300, 0x1f7a},
+    {0x03c5, 0x0301, 0x03cd},
+    {0x03c5, 0x0304, 0x1fe1},
+    {0x03c5, 0x0306, 0x1fe0},
+    {0x03c5, 0x0308, 0x03cb},
+    {0x03c5, 0x0313, 0x1f50},
+    {0x03c5, 0x0314, 0x1f51},
+    {0x03c5, 0x0342, 0x1fe6},
+    {0x03c9, 0x0300, 0x1f7c},
+    {0x03c9, 0x0301, 0x03ce},
+    {0x03c9, 0x0313, 0x1f60},
+    {0x03c9, 0x0314, 0x1f61},
+    {0x03c9, 0x0342, 0x1ff6},
+    {0x03c9, 0x0345, 0x1ff3},
+    {0x03ca, 0x0300, 0x1fd2},
+    {0x03ca, 0x0301, 0x0390},
+    {0x03ca, 0x0342, 0x1fd7},
+    {0x03cb, 0x0300, 0x1fe2},
+    {0x03cb, 0x0301, 0x03b0},
+    {0x03cb, 0x0342, 0x1fe7},
+    {0x03ce, 0x0345, 0x1ff4},
+    {0x03d2, 0x0301, 0x03d3},
+    {0x03d2, 0x0308, 0x03d4},
+    {0x0406, 0x0308, 0x0407},
+    {0x0410, 0x0306, 0x04d0},
+    {0x0410, 0x0308, 0x04d2},
+    {0x0413, 0x0301, 0x0403},
+    {0x0415, 0x0300, 0x0400},
+    {0x0415, 0x0306, 0x04d6},
+    {0x0415, 0x0308, 0x0401},
+    {0x0416, 0x0306, 0x04c1},
+    {0x0416, 0x0308, 0x04dc},
+    {0x0417, 0x0308, 0x04de},
+    {0x0418, 0x0300, 0x040d},
+    {0x0418, 0x0304, 0x04e2},
+    {0x0418, 0x0306, 0x0419},
+    {0x0418, 0x0308, 0x04e4},
+    {0x041a, 0x0301, 0x040c},
+    {0x041e, 0x0308, 0x04e6},
+    {0x0423, 0x0304, 0x04ee},
+    {0x0423, 0x0306, 0x040e},
+    {0x0423, 0x0308, 0x04f0},
+    {0x0423, 0x030b, 0x04f2},
+    {0x0427, 0x0308, 0x04f4},
+    {0x042b, 0x0308, 0x04f8},
+    {0x042d, 0x0308, 0x04ec},
+    {0x0430, 0x0306, 0x04d1},
+    {0x0430, 0x0308, 0x04d3},
+    {0x0433, 0x0301, 0x0453},
+    {0x0435, 0x0300, 0x0450},
+    {0x0435, 0x0306, 0x04d7},
+    {0x0435, 0x0308, 0x0451},
+    {0x0436, 0x0306, 0x04c2},
+    {0x0436, 0x0308, 0x04dd},
+    {0x0437, 0x0308, 0x04df},
+    {0x0438, 0x0300, 0x045d},
+    {0x0438, 0x0304, 0x04e3},
+    {0x0438, 0x0306, 0x0439},
+    {0x0438, 0x0308, 0x04e5},
+    {0x043a, 0x0301, 0x045c},
+    {0x043e, 0x0308, 0x04e7},
+    {0x0443, 0x0304, 0x04ef},
+    {0x0443, 0x0306, 0x045e},
+    {0x0443, 0x0308, 0x04f1},
+    {0x0443, 0x030b, 0x04f3},
+    {0x0447, 0x0308, 0x04f5},
+    {0x044b, 0x0308, 0x04f9},
+    {0x044d, 0x0308, 0x04ed},
+    {0x0456, 0x0308, 0x0457},
+    {0x0474, 0x030f, 0x0476},
+    {0x0475, 0x030f, 0x0477},
+    {0x04d8, 0x0308, 0x04da},
+    {0x04d9, 0x0308, 0x04db},
+    {0x04e8, 0x0308, 0x04ea},
+    {0x04e9, 0x0308, 0x04eb},
+    {0x0627, 0x0653, 0x0622},
+    {0x0627, 0x0654, 0x0623},
+    {0x0627, 0x0655, 0x0625},
+    {0x0648, 0x0654, 0x0624},
+    {0x064a, 0x0654, 0x0626},
+    {0x06c1, 0x0654, 0x06c2},
+    {0x06d2, 0x0654, 0x06d3},
+    {0x06d5, 0x0654, 0x06c0},
+    {0x0928, 0x093c, 0x0929},
+    {0x0930, 0x093c, 0x0931},
+    {0x0933, 0x093c, 0x0934},
+    {0x09c7, 0x09be, 0x09cb},
+    {0x09c7, 0x09d7, 0x09cc},
+    {0x0b47, 0x0b3e, 0x0b4b},
+    {0x0b47, 0x0b56, 0x0b48},
+    {0x0b47, 0x0b57, 0x0b4c},
+    {0x0b92, 0x0bd7, 0x0b94},
+    {0x0bc6, 0x0bbe, 0x0bca},
+    {0x0bc6, 0x0bd7, 0x0bcc},
+    {0x0bc7, 0x0bbe, 0x0bcb},
+    {0x0c46, 0x0c56, 0x0c48},
+    {0x0cbf, 0x0cd5, 0x0cc0},
+    {0x0cc6, 0x0cc2, 0x0cca},
+    {0x0cc6, 0x0cd5, 0x0cc7},
+    {0x0cc6, 0x0cd6, 0x0cc8},
+    {0x0cca, 0x0cd5, 0x0ccb},
+    {0x0d46, 0x0d3e, 0x0d4a},
+    {0x0d46, 0x0d57, 0x0d4c},
+    {0x0d47, 0x0d3e, 0x0d4b},
+    {0x0dd9, 0x0dca, 0x0dda},
+    {0x0dd9, 0x0dcf, 0x0ddc},
+    {0x0dd9, 0x0ddf, 0x0dde},
+    {0x0ddc, 0x0dca, 0x0ddd},
+    {0x1025, 0x102e, 0x1026},
+    {0x1b05, 0x1b35, 0x1b06},
+    {0x1b07, 0x1b35, 0x1b08},
+    {0x1b09, 0x1b35, 0x1b0a},
+    {0x1b0b, 0x1b35, 0x1b0c},
+    {0x1b0d, 0x1b35, 0x1b0e},
+    {0x1b11, 0x1b35, 0x1b12},
+    {0x1b3a, 0x1b35, 0x1b3b},
+    {0x1b3c, 0x1b35, 0x1b3d},
+    {0x1b3e, 0x1b35, 0x1b40},
+    {0x1b3f, 0x1b35, 0x1b41},
+    {0x1b42, 0x1b35, 0x1b43},
+    {0x1e36, 0x0304, 0x1e38},
+    {0x1e37, 0x0304, 0x1e39},
+    {0x1e5a, 0x0304, 0x1e5c},
+    {0x1e5b, 0x0304, 0x1e5d},
+    {0x1e62, 0x0307, 0x1e68},
+    {0x1e63, 0x0307, 0x1e69},
+    {0x1ea0, 0x0302, 0x1eac},
+    {0x1ea0, 0x0306, 0x1eb6},
+    {0x1ea1, 0x0302, 0x1ead},
+    {0x1ea1, 0x0306, 0x1eb7},
+    {0x1eb8, 0x0302, 0x1ec6},
+    {0x1eb9, 0x0302, 0x1ec7},
+    {0x1ecc, 0x0302, 0x1ed8},
+    {0x1ecd, 0x0302, 0x1ed9},
+    {0x1f00, 0x0300, 0x1f02},
+    {0x1f00, 0x0301, 0x1f04},
+    {0x1f00, 0x0342, 0x1f06},
+    {0x1f00, 0x0345, 0x1f80},
+    {0x1f01, 0x0300, 0x1f03},
+    {0x1f01, 0x0301, 0x1f05},
+    {0x1f01, 0x0342, 0x1f07},
+    {0x1f01, 0x0345, 0x1f81},
+    {0x1f02, 0x0345, 0x1f82},
+    {0x1f03, 0x0345, 0x1f83},
+    {0x1f04, 0x0345, 0x1f84},
+    {0x1f05, 0x0345, 0x1f85},
+    {0x1f06, 0x0345, 0x1f86},
+    {0x1f07, 0x0345, 0x1f87},
+    {0x1f08, 0x0300, 0x1f0a},
+    {0x1f08, 0x0301, 0x1f0c},
+    {0x1f08, 0x0342, 0x1f0e},
+    {0x1f08, 0x0345, 0x1f88},
+    {0x1f09, 0x0300, 0x1f0b},
+    {0x1f09, 0x0301, 0x1f0d},
+    {0x1f09, 0x0342, 0x1f0f},
+    {0x1f09, 0x0345, 0x1f89},
+    {0x1f0a, 0x0345, 0x1f8a},
+    {0x1f0b, 0x0345, 0x1f8b},
+    {0x1f0c, 0x0345, 0x1f8c},
+    {0x1f0d, 0x0345, 0x1f8d},
+    {0x1f0e, 0x0345, 0x1f8e},
+    {0x1f0f, 0x0345, 0x1f8f},
+    {0x1f10, 0x0300, 0x1f12},
+    {0x1f10, 0x0301, 0x1f14},
+    {0x1f11, 0x0300, 0x1f13},
+    {0x1f11, 0x0301, 0x1f15},
+    {0x1f18, 0x0300, 0x1f1a},
+    {0x1f18, 0x0301, 0x1f1c},
+    {0x1f19, 0x0300, 0x1f1b},
+    {0x1f19, 0x0301, 0x1f1d},
+    {0x1f20, 0x0300, 0x1f22},
+    {0x1f20, 0x0301, 0x1f24},
+    {0x1f20, 0x0342, 0x1f26},
+    {0x1f20, 0x0345, 0x1f90},
+    {0x1f21, 0x0300, 0x1f23},
+    {0x1f21, 0x0301, 0x1f25},
+    {0x1f21, 0x0342, 0x1f27},
+    {0x1f21, 0x0345, 0x1f91},
+    {0x1f22, 0x0345, 0x1f92},
+    {0x1f23, 0x0345, 0x1f93},
+    {0x1f24, 0x0345, 0x1f94},
+    {0x1f25, 0x0345, 0x1f95},
+    {0x1f26, 0x0345, 0x1f96},
+    {0x1f27, 0x0345, 0x1f97},
+    {0x1f28, 0x0300, 0x1f2a},
+    {0x1f28, 0x0301, 0x1f2c},
+    {0x1f28, 0x0342, 0x1f2e},
+    {0x1f28, 0x0345, 0x1f98},
+    {0x1f29, 0x0300, 0x1f2b},
+    {0x1f29, 0x0301, 0x1f2d},
+    {0x1f29, 0x0342, 0x1f2f},
+    {0x1f29, 0x0345, 0x1f99},
+    {0x1f2a, 0x0345, 0x1f9a},
+    {0x1f2b, 0x0345, 0x1f9b},
+    {0x1f2c, 0x0345, 0x1f9c},
+    {0x1f2d, 0x0345, 0x1f9d},
+    {0x1f2e, 0x0345, 0x1f9e},
+    {0x1f2f, 0x0345, 0x1f9f},
+    {0x1f30, 0x0300, 0x1f32},
+    {0x1f30, 0x0301, 0x1f34},
+    {0x1f30, 0x0342, 0x1f36},
+    {0x1f31, 0x0300, 0x1f33},
+    {0x1f31, 0x0301, 0x1f35},
+    {0x1f31, 0x0342, 0x1f37},
+    {0x1f38, 0x0300, 0x1f3a},
+    {0x1f38, 0x0301, 0x1f3c},
+    {0x1f38, 0x0342, 0x1f3e},
+    {0x1f39, 0x0300, 0x1f3b},
+    {0x1f39, 0x0301, 0x1f3d},
+    {0x1f39, 0x0342, 0x1f3f},
+    {0x1f40, 0x0300, 0x1f42},
+    {0x1f40, 0x0301, 0x1f44},
+    {0x1f41, 0x0300, 0x1f43},
+    {0x1f41, 0x0301, 0x1f45},
+    {0x1f48, 0x0300, 0x1f4a},
+    {0x1f48, 0x0301, 0x1f4c},
+    {0x1f49, 0x0300, 0x1f4b},
+    {0x1f49, 0x0301, 0x1f4d},
+    {0x1f50, 0x0300, 0x1f52},
+    {0x1f50, 0x0301, 0x1f54},
+    {0x1f50, 0x0342, 0x1f56},
+    {0x1f51, 0x0300, 0x1f53},
+    {0x1f51, 0x0301, 0x1f55},
+    {0x1f51, 0x0342, 0x1f57},
+    {0x1f59, 0x0300, 0x1f5b},
+    {0x1f59, 0x0301, 0x1f5d},
+    {0x1f59, 0x0342, 0x1f5f},
+    {0x1f60, 0x0300, 0x1f62},
+    {0x1f60, 0x0301, 0x1f64},
+    {0x1f60, 0x0342, 0x1f66},
+    {0x1f60, 0x0345, 0x1fa0},
+    {0x1f61, 0x0300, 0x1f63},
+    {0x1f61, 0x0301, 0x1f65},
+    {0x1f61, 0x0342, 0x1f67},
+    {0x1f61, 0x0345, 0x1fa1},
+    {0x1f62, 0x0345, 0x1fa2},
+    {0x1f63, 0x0345, 0x1fa3},
+    {0x1f64, 0x0345, 0x1fa4},
+    {0x1f65, 0x0345, 0x1fa5},
+    {0x1f66, 0x0345, 0x1fa6},
+    {0x1f67, 0x0345, 0x1fa7},
+    {0x1f68, 0x0300, 0x1f6a},
+    {0x1f68, 0x0301, 0x1f6c},
+    {0x1f68, 0x0342, 0x1f6e},
+    {0x1f68, 0x0345, 0x1fa8},
+    {0x1f69, 0x0300, 0x1f6b},
+    {0x1f69, 0x0301, 0x1f6d},
+    {0x1f69, 0x0342, 0x1f6f},
+    {0x1f69, 0x0345, 0x1fa9},
+    {0x1f6a, 0x0345, 0x1faa},
+    {0x1f6b, 0x0345, 0x1fab},
+    {0x1f6c, 0x0345, 0x1fac},
+    {0x1f6d, 0x0345, 0x1fad},
+    {0x1f6e, 0x0345, 0x1fae},
+    {0x1f6f, 0x0345, 0x1faf},
+    {0x1f70, 0x0345, 0x1fb2},
+    {0x1f74, 0x0345, 0x1fc2},
+    {0x1f7c, 0x0345, 0x1ff2},
+    {0x1fb6, 0x0345, 0x1fb7},
+    {0x1fbf, 0x0300, 0x1fcd},
+    {0x1fbf, 0x0301, 0x1fce},
+    {0x1fbf, 0x0342, 0x1fcf},
+    {0x1fc6, 0x0345, 0x1fc7},
+    {0x1ff6, 0x0345, 0x1ff7},
+    {0x1ffe, 0x0300, 0x1fdd},
+    {0x1ffe, 0x0301, 0x1fde},
+    {0x1ffe, 0x0342, 0x1fdf},
+    {0x2190, 0x0338, 0x219a},
+    {0x2192, 0x0338, 0x219b},
+    {0x2194, 0x0338, 0x21ae},
+    {0x21d0, 0x0338, 0x21cd},
+    {0x21d2, 0x0338, 0x21cf},
+    {0x21d4, 0x0338, 0x21ce},
+    {0x2203, 0x0338, 0x2204},
+    {0x2208, 0x0338, 0x2209},
+    {0x220b, 0x0338, 0x220c},
+    {0x2223, 0x0338, 0x2224},
+    {0x2225, 0x0338, 0x2226},
+    {0x223c, 0x0338, 0x2241},
+    {0x2243, 0x0338, 0x2244},
+    {0x2245, 0x0338, 0x2247},
+    {0x2248, 0x0338, 0x2249},
+    {0x224d, 0x0338, 0x226d},
+    {0x2261, 0x0338, 0x2262},
+    {0x2264, 0x0338, 0x2270},
+    {0x2265, 0x0338, 0x2271},
+    {0x2272, 0x0338, 0x2274},
+    {0x2273, 0x0338, 0x2275},
+    {0x2276, 0x0338, 0x2278},
+    {0x2277, 0x0338, 0x2279},
+    {0x227a, 0x0338, 0x2280},
+    {0x227b, 0x0338, 0x2281},
+    {0x227c, 0x0338, 0x22e0},
+    {0x227d, 0x0338, 0x22e1},
+    {0x2282, 0x0338, 0x2284},
+    {0x2283, 0x0338, 0x2285},
+    {0x2286, 0x0338, 0x2288},
+    {0x2287, 0x0338, 0x2289},
+    {0x2291, 0x0338, 0x22e2},
+    {0x2292, 0x0338, 0x22e3},
+    {0x22a2, 0x0338, 0x22ac},
+    {0x22a8, 0x0338, 0x22ad},
+    {0x22a9, 0x0338, 0x22ae},
+    {0x22ab, 0x0338, 0x22af},
+    {0x22b2, 0x0338, 0x22ea},
+    {0x22b3, 0x0338, 0x22eb},
+    {0x22b4, 0x0338, 0x22ec},
+    {0x22b5, 0x0338, 0x22ed},
+    {0x3046, 0x3099, 0x3094},
+    {0x304b, 0x3099, 0x304c},
+    {0x304d, 0x3099, 0x304e},
+    {0x304f, 0x3099, 0x3050},
+    {0x3051, 0x3099, 0x3052},
+    {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056},
+    {0x3057, 0x3099, 0x3058},
+    {0x3059, 0x3099, 0x305a},
+    {0x305b, 0x3099, 0x305c},
+    {0x305d, 0x3099, 0x305e},
+    {0x305f, 0x3099, 0x3060},
+    {0x3061, 0x3099, 0x3062},
+    {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067},
+    {0x3068, 0x3099, 0x3069},
+    {0x306f, 0x3099, 0x3070},
+    {0x306f, 0x309a, 0x3071},
+    {0x3072, 0x3099, 0x3073},
+    {0x3072, 0x309a, 0x3074},
+    {0x3075, 0x3099, 0x3076},
+    {0x3075, 0x309a, 0x3077},
+    {0x3078, 0x3099, 0x3079},
+    {0x3078, 0x309a, 0x307a},
+    {0x307b, 0x3099, 0x307c},
+    {0x307b, 0x309a, 0x307d},
+    {0x309d, 0x3099, 0x309e},
+    {0x30a6, 0x3099, 0x30f4},
+    {0x30ab, 0x3099, 0x30ac},
+    {0x30ad, 0x3099, 0x30ae},
+    {0x30af, 0x3099, 0x30b0},
+    {0x30b1, 0x3099, 0x30b2},
+    {0x30b3, 0x3099, 0x30b4},
+    {0x30b5, 0x3099, 0x30b6},
+    {0x30b7, 0x3099, 0x30b8},
+    {0x30b9, 0x3099, 0x30ba},
+    {0x30bb, 0x3099, 0x30bc},
+    {0x30bd, 0x3099, 0x30be},
+    {0x30bf, 0x3099, 0x30c0},
+    {0x30c1, 0x3099, 0x30c2},
+    {0x30c4, 0x3099, 0x30c5},
+    {0x30c6, 0x3099, 0x30c7},
+    {0x30c8, 0x3099, 0x30c9},
+    {0x30cf, 0x3099, 0x30d0},
+    {0x30cf, 0x309a, 0x30d1},
+    {0x30d2, 0x3099, 0x30d3},
+    {0x30d2, 0x309a, 0x30d4},
+    {0x30d5, 0x3099, 0x30d6},
+    {0x30d5, 0x309a, 0x30d7},
+    {0x30d8, 0x3099, 0x30d9},
+    {0x30d8, 0x309a, 0x30da},
+    {0x30db, 0x3099, 0x30dc},
+    {0x30db, 0x309a, 0x30dd},
+    {0x30ef, 0x3099, 0x30f7},
+    {0x30f0, 0x3099, 0x30f8},
+    {0x30f1, 0x3099, 0x30f9},
+    {0x30f2, 0x3099, 0x30fa},
+    {0x30fd, 0x3099, 0x30fe},
+    {0x11099, 0x110ba, 0x1109a},
+    {0x1109b, 0x110ba, 0x1109c},
+    {0x110a5, 0x110ba, 0x110ab},
+    {0x11131, 0x11127, 0x1112e},
+    {0x11132, 0x11127, 0x1112f},
+    {0x11347, 0x1133e, 0x1134b},
+    {0x11347, 0x11357, 0x1134c},
+    {0x114b9, 0x114b0, 0x114bc},
+    {0x114b9, 0x114ba, 0x114bb},
+    {0x114b9, 0x114bd, 0x114be},
+    {0x115b8, 0x115af, 0x115ba},
+    {0x115b9, 0x115af, 0x115bb},
+    {0x11935, 0x11930, 0x11938},
+};
+// clang-format on
@@ -1,5 +1,10 @@
 #include "textassist.c"
 
+#include "fontlist.c"
+#include "testutil.h"
+
+#include <stdio.h>
+
 #ifdef __GNUC__
 #  ifndef __has_warning
 #    define __has_warning(x) 0
@@ -71,8 +76,1784 @@ static void test_parse_tag_position(void) {
   }
 }
 
+static void test_parse_tag_font_name_length(void) {
+  // The name must fit the tag, and so the query of the similar fonts compared with it.
+  size_t const cap = sizeof(((struct tag *)0)->value.font.name) / sizeof(wchar_t);
+  TEST_CHECK(sizeof(((struct similar_request *)0)->query) / sizeof(wchar_t) == cap);
+  wchar_t input[300];
+  for (size_t n = cap - 1; n <= cap; ++n) {
+    TEST_CASE_("name length %zu", n);
+    input[0] = L'<';
+    input[1] = L's';
+    input[2] = L',';
+    wmemset(input + 3, L'a', n);
+    input[3 + n] = L'>';
+    input[4 + n] = L'\0';
+    struct tag t;
+    bool const r = parse_tag(input, (int)(wcslen(input)), 0, &t);
+    TEST_CHECK(r == (n < cap));
+    if (r) {
+      TEST_CHECK(t.type == tag_type_font);
+      TEST_CHECK(wcslen(t.value.font.name) == n);
+    }
+  }
+}
+
+static void test_font_list_index_of(void) {
+  static wchar_t const *const names[] = {
+      L"Arial",
+      L"@ＭＳ ゴシック",
+      L"ＭＳ ゴシック",
+      L"ＭＳ 明朝",
+      L"Meiryo UI",
+      L"メイリオ",
+      L"Yu Gothic",
+  };
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, sizeof(names) / sizeof(names[0])))) {
+    return;
+  }
+  TEST_CHECK(fl.num == sizeof(names) / sizeof(names[0]) - 1);
+  for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i) {
+    wchar_t const *const name = names[i][0] == L'@' ? names[i] + 1 : names[i];
+    TEST_CASE_("#%zu %ls", i, name);
+    int const idx = font_list_index_of(&fl, name);
+    if (TEST_CHECK(idx != -1)) {
+      wchar_t buf[font_name_buffer_len];
+      font_list_get_name(&fl, (size_t)idx, buf);
+      TEST_CHECK(wcscmp(buf, name) == 0);
+    }
+  }
+  TEST_CHECK(font_list_index_of(&fl, L"Arial Black") == -1);
+  TEST_CHECK(font_list_index_of(&fl, L"") == -1);
+  font_list_destroy(&fl);
+}
+
+static void test_font_list_index_of_equal_names(void) {
+  // The case variants collate equal, so they make a run that spans several blocks of the dictionary.
+  enum {
+    num_variants = 64,
+    num_fillers = 40,
+    num_names = num_variants + num_fillers,
+  };
+  wchar_t buf[num_names][font_name_buffer_len];
+  wchar_t const *names[num_names];
+  for (size_t i = 0; i < num_variants; ++i) {
+    wcscpy(buf[i], L"fontname");
+    for (size_t j = 0; j < 6; ++j) {
+      if (i & (1u << j)) {
+        buf[i][j] = (wchar_t)(buf[i][j] - (L'a' - L'A'));
+      }
+    }
+    names[i] = buf[i];
+  }
+  for (size_t i = num_variants; i < num_names; ++i) {
+    wsprintfW(buf[i], i % 2 ? L"Font %d" : L"Fontname %d", (int)i);
+    names[i] = buf[i];
+  }
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    return;
+  }
+  TEST_CHECK(fl.num == num_names);
+  for (size_t i = 0; i < num_names; ++i) {
+    TEST_CASE_("#%zu %ls", i, names[i]);
+    int const idx = font_list_index_of(&fl, names[i]);
+    if (TEST_CHECK(idx != -1)) {
+      wchar_t name[font_name_buffer_len];
+      font_list_get_name(&fl, (size_t)idx, name);
+      TEST_CHECK(wcscmp(name, names[i]) == 0);
+    }
+  }
+  TEST_CHECK(font_list_index_of(&fl, L"FONTNAMe") == -1);
+  TEST_CHECK(font_list_index_of(&fl, L"Fontname 1000") == -1);
+  TEST_CHECK(font_list_index_of(&fl, L"zzz") == -1);
+  font_list_destroy(&fl);
+}
+
+static void test_font_list_prefix_range(void) {
+  enum {
+    num_fixed = 12,
+    num_fillers = 60,
+    num_names = num_fixed + num_fillers,
+  };
+  static wchar_t const *const fixed[num_fixed] = {
+      L"Arial",
+      L"Arial Black",
+      L"MS Gothic",
+      L"MS Mincho",
+      L"MS UI Gothic",
+      L"Meiryo",
+      L"Meiryo UI",
+      L"メイリオ",
+      L"游ゴシック",
+      L"游明朝",
+      L"Noto Serif JP",
+      L"noto sans",
+  };
+  // The fillers share a prefix, so the range spans several blocks of the dictionary.
+  wchar_t buf[num_fillers][font_name_buffer_len];
+  wchar_t const *names[num_names];
+  for (size_t i = 0; i < num_fixed; ++i) {
+    names[i] = fixed[i];
+  }
+  for (size_t i = 0; i < num_fillers; ++i) {
+    wsprintfW(buf[i], i % 2 ? L"Noto Sans %d" : L"NOTO SANS JP %d", (int)i);
+    names[num_fixed + i] = buf[i];
+  }
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    return;
+  }
+  static wchar_t const *const prefixes[] = {
+      L"a",
+      L"Arial",
+      L"arial b",
+      L"ms",
+      L"MS U",
+      L"meiryo",
+      L"メ",
+      L"游",
+      L"noto",
+      L"Noto Sans",
+      L"noto sans jp",
+      L"Noto Sans JP 5",
+      L"noto sans 99",
+      L"noto serif",
+      L"b",
+      L"zzz",
+  };
+  for (size_t pi = 0; pi < sizeof(prefixes) / sizeof(prefixes[0]); ++pi) {
+    wchar_t const *const prefix = prefixes[pi];
+    TEST_CASE_("#%zu %ls", pi, prefix);
+    size_t first = SIZE_MAX, last = SIZE_MAX;
+    if (!TEST_CHECK(font_list_prefix_range(&fl, prefix, &first, &last))) {
+      continue;
+    }
+    TEST_CHECK(first <= last && last <= fl.num);
+    size_t const len = wcslen(prefix);
+    size_t expected = 0;
+    for (size_t i = 0; i < fl.num; ++i) {
+      wchar_t name[font_name_buffer_len];
+      font_list_get_name(&fl, i, name);
+      size_t const namelen = wcslen(name);
+      bool const match = namelen >= len && CompareStringW(LOCALE_USER_DEFAULT,
+                                                          SORT_STRINGSORT | LINGUISTIC_IGNORECASE,
+                                                          name,
+                                                          (int)len,
+                                                          prefix,
+                                                          (int)len) == CSTR_EQUAL;
+      if (match) {
+        ++expected;
+      }
+      if (!TEST_CHECK(match == (first <= i && i < last))) {
+        TEST_MSG("#%zu %ls in [%zu, %zu)", i, name, first, last);
+      }
+    }
+    TEST_CHECK(last - first == expected);
+  }
+  size_t first = SIZE_MAX, last = SIZE_MAX;
+  TEST_CHECK(font_list_prefix_range(&fl, L"", &first, &last));
+  TEST_CHECK(first == 0 && last == fl.num);
+  font_list_destroy(&fl);
+}
+
+static void test_font_list_family(void) {
+  static wchar_t const *const names[] = {
+      L"Noto Sans JP",
+      L"Noto Sans JP Black",
+      L"Noto Sans JP Bold",
+      L"Noto Sans JP Light",
+      L"Noto Sans JP Medium",
+      L"Noto Sans JP Thin",
+      L"Noto Sans",
+      L"Noto Sans Bold",
+      L"Noto Sans Bold Italic",
+      L"Noto Sans Italic",
+      L"Noto Sans Light",
+      L"Foo",
+      L"Foo Bar Regular",
+      L"Foo-Bold",
+      L"ヒラギノ角ゴ Pro W3",
+      L"ヒラギノ角ゴ Pro W6",
+      L"游ゴシック",
+      L"游ゴシック Light",
+      L"游ゴシック Medium",
+      L"Black",
+  };
+  enum {
+    num_names = sizeof(names) / sizeof(names[0]),
+  };
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    return;
+  }
+  TEST_CHECK(fl.family.num == 7);
+
+  // Each family is stepped through by weight and the ends are clamped.
+  static wchar_t const *const noto_sans_jp[] = {
+      L"Noto Sans JP Thin",
+      L"Noto Sans JP Light",
+      L"Noto Sans JP",
+      L"Noto Sans JP Medium",
+      L"Noto Sans JP Bold",
+      L"Noto Sans JP Black",
+  };
+  static wchar_t const *const noto_sans[] = {
+      L"Noto Sans Light",
+      L"Noto Sans",
+      L"Noto Sans Italic",
+      L"Noto Sans Bold",
+      L"Noto Sans Bold Italic",
+  };
+  static struct {
+    wchar_t const *const *names;
+    size_t num;
+  } const families[] = {
+      {noto_sans_jp, sizeof(noto_sans_jp) / sizeof(noto_sans_jp[0])},
+      {noto_sans, sizeof(noto_sans) / sizeof(noto_sans[0])},
+  };
+  wchar_t name[font_name_buffer_len];
+  for (size_t fi = 0; fi < sizeof(families) / sizeof(families[0]); ++fi) {
+    int idx = font_list_index_of(&fl, families[fi].names[0]);
+    if (!TEST_CHECK(idx != -1)) {
+      continue;
+    }
+    font_list_get_name(&fl, font_list_step_in_family(&fl, (size_t)idx, -1), name);
+    TEST_CHECK(wcscmp(name, families[fi].names[0]) == 0);
+    for (size_t i = 1; i < families[fi].num; ++i) {
+      idx = (int)font_list_step_in_family(&fl, (size_t)idx, 1);
+      font_list_get_name(&fl, (size_t)idx, name);
+      TEST_CHECK(wcscmp(name, families[fi].names[i]) == 0);
+      TEST_MSG("expected: %ls, got: %ls", families[fi].names[i], name);
+    }
+    font_list_get_name(&fl, font_list_step_in_family(&fl, (size_t)idx, 10), name);
+    TEST_CHECK(wcscmp(name, families[fi].names[families[fi].num - 1]) == 0);
+  }
+
+  // The style words are stripped from the end only, and the first word is always kept.
+  static struct {
+    wchar_t const *a, *b;
+  } const same[] = {
+      {L"Foo", L"Foo-Bold"},
+      {L"ヒラギノ角ゴ Pro W3", L"ヒラギノ角ゴ Pro W6"},
+      {L"游ゴシック", L"游ゴシック Medium"},
+  };
+  for (size_t i = 0; i < sizeof(same) / sizeof(same[0]); ++i) {
+    int const a = font_list_index_of(&fl, same[i].a);
+    int const b = font_list_index_of(&fl, same[i].b);
+    if (TEST_CHECK(a != -1 && b != -1)) {
+      TEST_CHECK(fl.family.family[a] == fl.family.family[b]);
+    }
+  }
+  int const foo = font_list_index_of(&fl, L"Foo");
+  int const foobar = font_list_index_of(&fl, L"Foo Bar Regular");
+  int const black = font_list_index_of(&fl, L"Black");
+  if (TEST_CHECK(foo != -1 && foobar != -1 && black != -1)) {
+    TEST_CHECK(fl.family.family[foo] != fl.family.family[foobar]);
+    TEST_CHECK(font_list_step_in_family(&fl, (size_t)black, 1) == (size_t)black);
+  }
+
+  // Families are in the order of their first font, and stepping across keeps the closest weight.
+  size_t idx = 0;
+  for (size_t f = 1; f < fl.family.num; ++f) {
+    size_t const next = font_list_step_family(&fl, idx, 1);
+    TEST_CHECK(fl.family.family[next] == f);
+    TEST_CHECK(fl.family.family[font_list_step_family(&fl, next, -1)] == f - 1);
+    idx = next;
+  }
+  TEST_CHECK(font_list_step_family(&fl, idx, 1) == idx);
+  int const jp_bold = font_list_index_of(&fl, L"Noto Sans JP Bold");
+  int const jp_thin = font_list_index_of(&fl, L"Noto Sans JP Thin");
+  if (TEST_CHECK(jp_bold != -1 && jp_thin != -1)) {
+    font_list_get_name(&fl, font_list_step_family(&fl, (size_t)jp_bold, -1), name);
+    TEST_CHECK(wcscmp(name, L"Noto Sans Bold") == 0);
+    TEST_MSG("got: %ls", name);
+    font_list_get_name(&fl, font_list_step_family(&fl, (size_t)jp_thin, -1), name);
+    TEST_CHECK(wcscmp(name, L"Noto Sans Light") == 0);
+    TEST_MSG("got: %ls", name);
+  }
+  font_list_destroy(&fl);
+}
+
+static void test_font_list_memory_usage(void) {
+  static wchar_t const *const names[] = {
+      L"Arial",
+      L"MS UI Gothic",
+      L"Noto Sans CJK JP Black",
+      L"Noto Sans CJK JP Bold",
+      L"Noto Sans CJK JP Light",
+      L"ＭＳ ゴシック",
+      L"ＭＳ Ｐゴシック",
+      L"メイリオ",
+  };
+  enum {
+    num_names = sizeof(names) / sizeof(names[0]),
+  };
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    return;
+  }
+  // The sizes without front coding, with the normalized names as code units and as packed codes.
+  size_t plain = 0, packed = 0;
+  struct font_dict_cursor c = {0};
+  for (size_t i = 0; i < fl.num; ++i) {
+    font_dict_cursor_seek(&c, &fl, i);
+    TEST_CHECK(c.normlen == fl.normlen[i]);
+    // Fewer than font_alphabet_size code units are used, so every name is coded.
+    TEST_CHECK(c.narrow);
+    plain += c.namelen + 1 + c.normlen + 1;
+    packed += 2 + c.namelen + 2 + (c.normlen + 1) / 2;
+  }
+
+  struct font_list_memory_usage mu;
+  font_list_memory_usage(&fl, &mu);
+  TEST_CHECK(mu.text == fl.textlen * sizeof(wchar_t));
+  TEST_CHECK(fl.textlen < packed);
+  TEST_CHECK(mu.text < plain * sizeof(wchar_t) * 2 / 3);
+  TEST_CHECK(mu.restarts == sizeof(uint32_t));
+  TEST_CHECK(mu.signature > 0 && mu.qgram > 0 && mu.batch > 0);
+  TEST_CHECK(mu.family > 0);
+  TEST_CHECK(mu.total == mu.text + mu.restarts + mu.signature + mu.qgram + mu.batch + mu.family);
+  TEST_CHECK(!mu.mapped);
+
+  // The query is compared with the coded normalized name.
+  struct font_similar out[1];
+  if (TEST_CHECK(font_get_similar_topk(&fl, L"ms ui gothic", 1, out, NULL) == 1)) {
+    wchar_t name[font_name_buffer_len];
+    font_list_get_name(&fl, (size_t)out[0].idx, name);
+    TEST_CHECK(wcscmp(name, L"MS UI Gothic") == 0);
+    TEST_CHECK(out[0].score == 0);
+  }
+  font_list_destroy(&fl);
+}
+
+// The comparison that the font list used to be sorted with by qsort.
+static int compare_string(void const *n1, void const *n2) {
+  int const r = CompareStringW(LOCALE_USER_DEFAULT,
+                               font_list_collation_flags,
+                               *(wchar_t const *const *)n1,
+                               -1,
+                               *(wchar_t const *const *)n2,
+                               -1);
+  return r - 2;
+}
+
+static void test_font_list_sort_order(void) {
+  static wchar_t const *const bases[] = {
+      L"Arial",
+      L"arial",
+      L"ＭＳ ゴシック",
+      L"MS Gothic",
+      L"メイリオ",
+      L"めいりお",
+      L"游ゴシック",
+      L"Yu Gothic UI",
+      L"Ärial",
+      L"Œuvre",
+      L"Ｓｅｇｏｅ",
+      L"segoe ui",
+      L"10 Minute",
+      L"2 Minute",
+      L"-dash",
+      L"_under",
+      L"'quote",
+  };
+  // More names than font_build_chunk_min * 2 so that the names are keyed by several workers.
+  enum {
+    num_bases = sizeof(bases) / sizeof(bases[0]),
+    num_names = font_build_chunk_min * 4,
+  };
+  static wchar_t buf[num_names][LF_FACESIZE];
+  static wchar_t const *names[num_names];
+  for (size_t i = 0; i < num_names; ++i) {
+    if (i < num_bases) {
+      wcscpy(buf[i], bases[i]);
+    } else {
+      wsprintfW(buf[i], L"%s %d", bases[i % num_bases], (int)(i / num_bases));
+    }
+    names[i] = buf[i];
+  }
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    return;
+  }
+  TEST_CHECK(fl.num == num_names);
+  qsort(names, num_names, sizeof(wchar_t const *), compare_string);
+  wchar_t prevbuf[font_name_buffer_len], namebuf[font_name_buffer_len];
+  wchar_t const *prev = prevbuf, *name = namebuf;
+  for (size_t i = 0; i < fl.num && i < num_names; ++i) {
+    font_list_get_name(&fl, i, namebuf);
+    // Names that collate equal may be in any order, as with qsort.
+    TEST_CHECK_(compare_string(&names[i], &name) == 0, "#%zu %ls %ls", i, names[i], name);
+    if (i) {
+      TEST_CHECK_(compare_string(&prev, &name) <= 0, "#%zu %ls", i, name);
+    }
+    TEST_CHECK(font_list_index_of(&fl, name) == (int)i);
+    wcscpy(prevbuf, namebuf);
+  }
+  font_list_destroy(&fl);
+}
+
+static void test_enum_font_callback(void) {
+  // More names than buffer_size so that the buffers and the name set grow several times.
+  enum {
+    n = 3000,
+  };
+  struct enum_font_data fd = {0};
+  LOGFONTW lf = {0};
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int i = 0; i < n; ++i) {
+      wsprintfW(lf.lfFaceName, i % 3 ? L"Font %d" : L"@Font %d", i);
+      if (!TEST_CHECK(enum_font_callback(&lf, NULL, TRUETYPE_FONTTYPE, (LPARAM)&fd))) {
+        goto cleanup;
+      }
+    }
+  }
+  if (!TEST_CHECK(fd.n == n)) {
+    goto cleanup;
+  }
+  for (int i = 0; i < n; ++i) {
+    wchar_t expected[LF_FACESIZE];
+    wsprintfW(expected, L"Font %d", i);
+    TEST_CASE_("#%d", i);
+    TEST_CHECK(wcscmp(fd.buf + fd.list.pos[i], expected) == 0);
+  }
+
+cleanup:
+  enum_font_data_free(&fd);
+}
+
+// The switch based implementation that kana_fold.txt was generated from.
+static void extended_normalize_switch(wchar_t *str) {
+  for (wchar_t ch; *str; ++str) {
+    ch = *str;
+    if (L'a' <= ch && ch <= L'z') {
+      *str -= L'a' - L'A';
+      continue;
+    }
+    switch (ch) {
+    case L'ぁ':
+    case L'ァ':
+    case L'ア':
+      *str = L'あ';
+      break;
+    case L'ぃ':
+    case L'ゐ':
+    case L'ィ':
+    case L'イ':
+    case L'ヰ':
+    case L'ヸ':
+      *str = L'い';
+      break;
+    case L'ぅ':
+    case L'ゔ':
+    case L'ゥ':
+    case L'ウ':
+    case L'ヴ':
+      *str = L'う';
+      break;
+    case L'ぇ':
+    case L'ゑ':
+    case L'ェ':
+    case L'エ':
+    case L'ヱ':
+    case L'ヹ':
+      *str = L'え';
+      break;
+    case L'ぉ':
+    case L'を':
+    case L'ォ':
+    case L'オ':
+    case L'ヲ':
+    case L'ヺ':
+      *str = L'お';
+      break;
+    case L'が':
+    case L'ゕ':
+    case L'カ':
+    case L'ガ':
+    case L'ヵ':
+      *str = L'か';
+      break;
+    case L'ぎ':
+    case L'キ':
+    case L'ギ':
+      *str = L'き';
+      break;
+    case L'ぐ':
+    case L'ク':
+    case L'グ':
+    case L'ㇰ':
+      *str = L'く';
+      break;
+    case L'げ':
+    case L'ゖ':
+    case L'ケ':
+    case L'ゲ':
+    case L'ヶ':
+      *str = L'け';
+      break;
+    case L'ご':
+    case L'コ':
+    case L'ゴ':
+      *str = L'こ';
+      break;
+    case L'ざ':
+    case L'サ':
+    case L'ザ':
+      *str = L'さ';
+      break;
+    case L'じ':
+    case L'シ':
+    case L'ジ':
+    case L'ㇱ':
+      *str = L'し';
+      break;
+    case L'ず':
+    case L'ス':
+    case L'ズ':
+    case L'ㇲ':
+      *str = L'す';
+      break;
+    case L'ぜ':
+    case L'セ':
+    case L'ゼ':
+      *str = L'せ';
+      break;
+    case L'ぞ':
+    case L'ソ':
+    case L'ゾ':
+      *str = L'そ';
+      break;
+    case L'だ':
+    case L'タ':
+    case L'ダ':
+      *str = L'た';
+      break;
+    case L'ぢ':
+    case L'チ':
+    case L'ヂ':
+      *str = L'ち';
+      break;
+    case L'っ':
+    case L'づ':
+    case L'ッ':
+    case L'ツ':
+    case L'ヅ':
+      *str = L'つ';
+      break;
+    case L'で':
+    case L'テ':
+    case L'デ':
+      *str = L'て';
+      break;
+    case L'ど':
+    case L'ト':
+    case L'ド':
+    case L'ㇳ':
+      *str = L'と';
+      break;
+    case L'ナ':
+      *str = L'な';
+      break;
+    case L'ニ':
+      *str = L'に';
+      break;
+    case L'ヌ':
+    case L'ㇴ':
+      *str = L'ぬ';
+      break;
+    case L'ネ':
+      *str = L'ね';
+      break;
+    case L'ノ':
+      *str = L'の';
+      break;
+    case L'ば':
+    case L'ぱ':
+    case L'ハ':
+    case L'バ':
+    case L'パ':
+    case L'ㇵ':
+      *str = L'は';
+      break;
+    case L'び':
+    case L'ぴ':
+    case L'ヒ':
+    case L'ビ':
+    case L'ピ':
+    case L'ㇶ':
+      *str = L'ひ';
+      break;
+    case L'ぶ':
+    case L'ぷ':
+    case L'フ':
+    case L'ブ':
+    case L'プ':
+    case L'ㇷ':
+      *str = L'ふ';
+      break;
+    case L'べ':
+    case L'ぺ':
+    case L'ヘ':
+    case L'ベ':
+    case L'ペ':
+    case L'ㇸ':
+      *str = L'へ';
+      break;
+    case L'ぼ':
+    case L'ぽ':
+    case L'ホ':
+    case L'ボ':
+    case L'ポ':
+    case L'ㇹ':
+      *str = L'ほ';
+      break;
+    case L'マ':
+      *str = L'ま';
+      break;
+    case L'ミ':
+      *str = L'み';
+      break;
+    case L'ム':
+    case L'ㇺ':
+      *str = L'む';
+      break;
+    case L'メ':
+      *str = L'め';
+      break;
+    case L'モ':
+      *str = L'も';
+      break;
+    case L'ゃ':
+    case L'ャ':
+    case L'ヤ':
+      *str = L'や';
+      break;
+    case L'ゅ':
+    case L'ュ':
+    case L'ユ':
+      *str = L'ゆ';
+      break;
+    case L'ょ':
+    case L'ョ':
+    case L'ヨ':
+      *str = L'よ';
+      break;
+    case L'ラ':
+    case L'ㇻ':
+      *str = L'ら';
+      break;
+    case L'リ':
+    case L'ㇼ':
+      *str = L'り';
+      break;
+    case L'ル':
+    case L'ㇽ':
+      *str = L'る';
+      break;
+    case L'レ':
+    case L'ㇾ':
+      *str = L'れ';
+      break;
+    case L'ロ':
+    case L'ㇿ':
+      *str = L'ろ';
+      break;
+    case L'ゎ':
+    case L'ヮ':
+    case L'ワ':
+    case L'ヷ':
+      *str = L'わ';
+      break;
+    case L'ン':
+      *str = L'ん';
+      break;
+    }
+  }
+}
+
+static void test_extended_normalize(void) {
+  // Every BMP code point on its own goes through the scalar path.
+  for (uint32_t cp = 1; cp < 0x10000; ++cp) {
+    wchar_t expected[2] = {(wchar_t)cp, L'\0'};
+    wchar_t got[2] = {(wchar_t)cp, L'\0'};
+    extended_normalize_switch(expected);
+    extended_normalize(got, 1);
+    if (!TEST_CHECK_(got[0] == expected[0], "U+%04X", (unsigned)cp)) {
+      TEST_MSG("expected U+%04X, got U+%04X", (unsigned)expected[0], (unsigned)got[0]);
+      return;
+    }
+  }
+
+  // All of them again in runs of varying length, so that the vectorized path and its tails see each of them.
+  enum {
+    max_run = 37,
+  };
+  wchar_t expected[max_run + 1];
+  wchar_t got[max_run + 1];
+  uint32_t cp = 1;
+  for (size_t len = 1; cp < 0x10000; len = len % max_run + 1) {
+    size_t n = 0;
+    for (; n < len && cp < 0x10000; ++n, ++cp) {
+      expected[n] = (wchar_t)cp;
+    }
+    expected[n] = L'\0';
+    memcpy(got, expected, (n + 1) * sizeof(wchar_t));
+    extended_normalize_switch(expected);
+    extended_normalize(got, n);
+    if (!TEST_CHECK_(
+            memcmp(got, expected, (n + 1) * sizeof(wchar_t)) == 0, "run ending at U+%04X", (unsigned)(cp - 1))) {
+      return;
+    }
+  }
+}
+
+static void test_nfkc(void) {
+  static struct {
+    wchar_t const *input;
+    wchar_t const *expected;
+  } const tests[] = {
+      {L"Arial", L"Arial"},
+      {L"ＭＳ Ｐゴシック", L"MS Pゴシック"},
+      {L"ｶﾞｷﾞ", L"ガギ"},
+      {L"①㍻", L"1平成"},
+      {L"e\u0301", L"\u00e9"},
+      {L"\uff21\u0308", L"\u00c4"},
+      {L"a\u0301\u0328", L"\u0105\u0301"},
+      {L"\u1100\u1161\u11a8", L"\uac01"},
+      {L"\U0001d400\U0001d41a", L"Aa"},
+      {L"\ufdfa", L"صلى الله عليه وسلم"},
+  };
+  for (size_t i = 0; i < sizeof(tests) / sizeof(tests[0]); ++i) {
+    TEST_CASE_("#%d", (int)i);
+    wchar_t buf[64];
+    size_t const len = nfkc(tests[i].input, wcslen(tests[i].input), buf, sizeof(buf) / sizeof(buf[0]));
+    size_t const expected_len = wcslen(tests[i].expected);
+    if (TEST_CHECK(len == expected_len)) {
+      TEST_CHECK(memcmp(buf, tests[i].expected, len * sizeof(wchar_t)) == 0);
+    }
+  }
+
+  // A short buffer receives the beginning and the return value tells the required length.
+  wchar_t buf[2];
+  TEST_CHECK(nfkc(L"①㍻", 2, buf, 2) == 3);
+  TEST_CHECK(buf[0] == L'1' && buf[1] == L'平');
+  TEST_CHECK(nfkc(L"Arial", 5, NULL, 0) == 5);
+}
+
+static size_t append_code_point(wchar_t *const buf, size_t len, uint32_t const cp) {
+#if WCHAR_MAX == 0xffff
+  if (cp >= 0x10000) {
+    buf[len++] = (wchar_t)(0xd800 + ((cp - 0x10000) >> 10));
+    buf[len++] = (wchar_t)(0xdc00 + ((cp - 0x10000) & 0x3ff));
+    return len;
+  }
+#endif
+  buf[len++] = (wchar_t)cp;
+  return len;
+}
+
+// Parses space separated hexadecimal code points until ';'.
+static char *parse_code_points(char *s, wchar_t *const buf, size_t const cap, size_t *const len) {
+  *len = 0;
+  while (*s && *s != ';') {
+    if (*s == ' ') {
+      ++s;
+      continue;
+    }
+    char *end = NULL;
+    uint32_t const cp = (uint32_t)strtoul(s, &end, 16);
+    if (end == s || *len + 2 > cap) {
+      return NULL;
+    }
+    *len = append_code_point(buf, *len, cp);
+    s = end;
+  }
+  return *s == ';' ? s + 1 : NULL;
+}
+
+static void test_nfkc_conformance(void) {
+  // NormalizationTest.txt of the Unicode version in nfkc_table.h is looked up in the working directory.
+  // Configure with -DDOWNLOAD_NORMALIZATION_TEST=ON to place it next to the test.
+  FILE *f = fopen("NormalizationTest.txt", "r");
+  if (!f) {
+#ifdef TEST_SKIP
+    TEST_SKIP("NormalizationTest.txt not found");
+#endif
+    return;
+  }
+  static uint8_t part1[0x110000 / 8];
+  memset(part1, 0, sizeof(part1));
+  bool in_part1 = false;
+  size_t lines = 0, failed = 0;
+  char line[1024];
+  while (fgets(line, sizeof(line), f)) {
+    if (line[0] == '@') {
+      in_part1 = strncmp(line, "@Part1", 6) == 0;
+      continue;
+    }
+    if (line[0] == '#' || line[0] == '\n') {
+      continue;
+    }
+    // c1;c2;c3;c4;c5; where NFKC(c1..c5) == c4
+    enum {
+      cap = 128,
+    };
+    wchar_t c[5][cap], got[cap * 4];
+    size_t len[5];
+    char *p = line;
+    for (size_t i = 0; i < 5 && p; ++i) {
+      p = parse_code_points(p, c[i], cap, &len[i]);
+    }
+    if (!TEST_CHECK_(p != NULL, "parse: %s", line)) {
+      break;
+    }
+    if (in_part1) {
+      uint32_t const cp = (uint32_t)strtoul(line, NULL, 16);
+      part1[cp / 8] |= (uint8_t)(1 << (cp % 8));
+    }
+    ++lines;
+    for (size_t i = 0; i < 5; ++i) {
+      size_t const n = nfkc(c[i], len[i], got, sizeof(got) / sizeof(got[0]));
+      if (n != len[3] || memcmp(got, c[3], n * sizeof(wchar_t)) != 0) {
+        if (!failed++) {
+          TEST_CHECK_(false, "NFKC(c%d) != c4: %s", (int)i + 1, line);
+        }
+      }
+    }
+  }
+  fclose(f);
+  TEST_CHECK_(failed == 0, "%d failures in %d lines", (int)failed, (int)lines);
+
+  // Code points that are not listed in Part 1 are not changed by NFKC.
+  for (uint32_t cp = 1; cp < 0x110000; ++cp) {
+    if ((cp >= 0xd800 && cp <= 0xdfff) || part1[cp / 8] & (1 << (cp % 8))) {
+      continue;
+    }
+    wchar_t src[2], dest[8];
+    size_t const n = append_code_point(src, 0, cp);
+    bool const unchanged = nfkc(src, n, dest, 8) == n && memcmp(src, dest, n * sizeof(wchar_t)) == 0;
+    if (!TEST_CHECK_(unchanged, "U+%04X", (unsigned)cp)) {
+      break;
+    }
+  }
+}
+
+static void test_bitlcs_distance(void) {
+  // Mixes ASCII and kana so that both lookup paths of bitlcs are exercised.
+  static wchar_t const alphabet[] = L"ABCDE 01あいうえおかきくけこ游明朝";
+  enum {
+    alphabet_len = sizeof(alphabet) / sizeof(alphabet[0]) - 1,
+    corpus_size = 300,
+    max_len = 80,
+  };
+  static wchar_t corpus[corpus_size][max_len + 1];
+  uint32_t rnd = 2463534242u;
+  for (size_t i = 0; i < corpus_size; ++i) {
+    rnd ^= rnd << 13;
+    rnd ^= rnd >> 17;
+    rnd ^= rnd << 5;
+    // Most names are short, a few of them are longer than bitlcs_max_len.
+    size_t const len = rnd % 8 == 0 ? rnd % (max_len + 1) : rnd % 24;
+    for (size_t j = 0; j < len; ++j) {
+      rnd ^= rnd << 13;
+      rnd ^= rnd >> 17;
+      rnd ^= rnd << 5;
+      corpus[i][j] = alphabet[rnd % alphabet_len];
+    }
+    corpus[i][len] = L'\0';
+  }
+
+  struct diff diff = {0};
+  struct bitlcs bitlcs;
+  for (size_t i = 0; i < corpus_size; ++i) {
+    int const alen = (int)(wcslen(corpus[i]));
+    if (alen > bitlcs_max_len) {
+      continue;
+    }
+    bitlcs_init(&bitlcs, corpus[i], alen);
+    uint64_t const asig = signature_string(corpus[i], (size_t)alen);
+    for (size_t j = 0; j < corpus_size; ++j) {
+      int const blen = (int)(wcslen(corpus[j]));
+      diff_init(&diff, corpus[i], alen, corpus[j], blen);
+      int const expected = diff_distance(&diff, INT_MAX);
+      int const got = bitlcs_distance(&bitlcs, corpus[j], blen);
+      if (!TEST_CHECK(expected == got)) {
+        TEST_MSG("a: %ls, b: %ls, expected: %d, got: %d", corpus[i], corpus[j], expected, got);
+        goto cleanup;
+      }
+      int const bound = similar_lower_bound(asig, alen, signature_string(corpus[j], (size_t)blen), blen);
+      if (!TEST_CHECK(bound <= expected)) {
+        TEST_MSG("a: %ls, b: %ls, score: %d, lower bound: %d", corpus[i], corpus[j], expected, bound);
+        goto cleanup;
+      }
+      diff_init(&diff, corpus[i], alen, corpus[j], blen);
+      TEST_CHECK(diff_distance(&diff, expected - 1) > expected - 1);
+    }
+  }
+
+cleanup:
+  free(diff.fpbuf);
+}
+
+static void test_font_alphabet(void) {
+  // Each ideograph appears in two names and the ASCII letters in all of them,
+  // so the ideographs with the larger code points overflow the alphabet.
+  enum {
+    num_names = 400,
+  };
+  static wchar_t buf[num_names][8];
+  wchar_t const *names[num_names];
+  for (size_t i = 0; i < num_names; ++i) {
+    wcscpy(buf[i], L"Font ");
+    buf[i][5] = (wchar_t)(0x4e00 + i);
+    buf[i][6] = (wchar_t)(0x4e00 + i * 7 % num_names);
+    buf[i][7] = L'\0';
+    names[i] = buf[i];
+  }
+  static wchar_t const *const queries[] = {
+      L"FONT",
+      L"font 一丁",
+      L"Ｆｏｎｔ 乙",
+      L"Sans",
+      L"Font 一丁Font 一丁Font 一丁Font 一丁Font 一丁Font 一丁Font 一丁Font 一丁Font 一丁",
+  };
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    return;
+  }
+  TEST_CHECK(fl.alphabet_len == font_alphabet_size);
+  for (size_t i = 1; i < fl.alphabet_len; ++i) {
+    TEST_CHECK(fl.alphabet[i - 1] < fl.alphabet[i]);
+  }
+  TEST_CHECK(font_alphabet_code(fl.alphabet, fl.alphabet_len, L'F') != font_alphabet_none);
+  TEST_CHECK(font_alphabet_code(fl.alphabet, fl.alphabet_len, L'f') == font_alphabet_none);
+
+  size_t narrow = 0;
+  struct font_dict_cursor c = {0};
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    TEST_CASE_("#%zu %ls", qi, queries[qi]);
+    struct similar_query q;
+    if (!TEST_CHECK(similar_query_init(&q, queries[qi]))) {
+      continue;
+    }
+    if (!TEST_CHECK(similar_query_encode(&q, &fl))) {
+      similar_query_free(&q);
+      continue;
+    }
+    narrow = 0;
+    for (size_t i = 0; i < fl.num; ++i) {
+      font_dict_cursor_seek(&c, &fl, i);
+      if (!c.narrow) {
+        continue;
+      }
+      ++narrow;
+      int const got = similar_query_score_code(&q, c.code, c.normlen, INT_MAX);
+      int const expected = similar_query_score(&q, font_dict_cursor_norm(&c, &fl), c.normlen, INT_MAX);
+      if (!TEST_CHECK(got == expected)) {
+        TEST_MSG("name: %ls, expected: %d, got: %d", c.name, expected, got);
+        break;
+      }
+    }
+    similar_query_free(&q);
+  }
+  TEST_CHECK(narrow > 0 && narrow < fl.num);
+  font_list_destroy(&fl);
+}
+
+static void test_similar_batch(void) {
+  // More distinct code units than the alphabet holds, so some names are not coded.
+  enum {
+    num_ideographs = 300,
+    num_names = 600,
+    num_queries = 200,
+    max_len = 30,
+  };
+  static wchar_t const latin[] = L"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 あいうえおカキクケコ";
+  static wchar_t pool[sizeof(latin) / sizeof(latin[0]) - 1 + num_ideographs];
+  static wchar_t buf[num_names][max_len + 1];
+  size_t const pool_len = sizeof(pool) / sizeof(pool[0]);
+  wmemcpy(pool, latin, sizeof(latin) / sizeof(latin[0]) - 1);
+  for (size_t i = 0; i < num_ideographs; ++i) {
+    pool[sizeof(latin) / sizeof(latin[0]) - 1 + i] = (wchar_t)(0x4e00 + i);
+  }
+  uint32_t rnd = 88172645u;
+  wchar_t const *names[num_names];
+  for (size_t i = 0; i < num_names; ++i) {
+    rnd ^= rnd << 13;
+    rnd ^= rnd >> 17;
+    rnd ^= rnd << 5;
+    size_t const len = 1 + rnd % max_len;
+    for (size_t j = 0; j < len; ++j) {
+      rnd ^= rnd << 13;
+      rnd ^= rnd >> 17;
+      rnd ^= rnd << 5;
+      buf[i][j] = pool[rnd % pool_len];
+    }
+    // Starts with a letter so that the name is not mistaken for a vertical font or trimmed.
+    buf[i][0] = L'F';
+    buf[i][len] = L'\0';
+    names[i] = buf[i];
+  }
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    return;
+  }
+
+  struct {
+    char const *name;
+    similar_batch_fn fn;
+  } kernels[3] = {{"scalar", similar_batch_scalar}};
+  size_t num_kernels = 1;
+#ifdef FONTLIST_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2")) {
+    kernels[num_kernels].name = "sse2";
+    kernels[num_kernels++].fn = similar_batch_sse2;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    kernels[num_kernels].name = "avx2";
+    kernels[num_kernels++].fn = similar_batch_avx2;
+  }
+#endif
+
+  size_t narrow = 0, wide = 0;
+  struct diff diff = {0};
+  struct font_dict_cursor c = {0};
+  for (size_t qi = 0; qi < num_queries; ++qi) {
+    wchar_t query[font_batch_max_query + 1];
+    rnd ^= rnd << 13;
+    rnd ^= rnd >> 17;
+    rnd ^= rnd << 5;
+    size_t const len = 1 + rnd % font_batch_max_query;
+    for (size_t j = 0; j < len; ++j) {
+      rnd ^= rnd << 13;
+      rnd ^= rnd >> 17;
+      rnd ^= rnd << 5;
+      // Some code units are not in the font list at all.
+      query[j] = rnd % 16 ? pool[rnd % pool_len] : (wchar_t)(0x5000 + rnd % 64);
+    }
+    query[len] = L'\0';
+    struct similar_query q;
+    if (!TEST_CHECK(similar_query_init(&q, query))) {
+      continue;
+    }
+    if (!TEST_CHECK(similar_query_encode(&q, &fl)) || !TEST_CHECK(q.batch_fn != NULL)) {
+      similar_query_free(&q);
+      continue;
+    }
+    for (size_t b = 0; b < font_batch_num_blocks(fl.num); ++b) {
+      uint32_t const offset = fl.batch.offsets[b];
+      size_t const width = (fl.batch.offsets[b + 1] - offset) / font_batch_lanes;
+      uint16_t v[3][font_batch_lanes];
+      for (size_t ki = 0; ki < num_kernels; ++ki) {
+        kernels[ki].fn(&q.batch, fl.batch.codes + offset, width, v[ki]);
+      }
+      for (size_t lane = 0; lane < font_batch_lanes && b * font_batch_lanes + lane < fl.num; ++lane) {
+        size_t const i = b * font_batch_lanes + lane;
+        font_dict_cursor_seek(&c, &fl, i);
+        TEST_CHECK(!c.narrow == !!(fl.batch.wide[b] & (1u << lane)));
+        if (!c.narrow) {
+          ++wide;
+          continue;
+        }
+        ++narrow;
+        wchar_t const *const norm = font_dict_cursor_norm(&c, &fl);
+        diff_init(&diff, q.sn, (int)q.snlen, norm, (int)c.normlen);
+        int const expected = diff_distance(&diff, INT_MAX);
+        for (size_t ki = 0; ki < num_kernels; ++ki) {
+          int const got = bitlcs_score(v[ki][lane], (int)q.snlen, (int)c.normlen);
+          if (!TEST_CHECK(got == expected)) {
+            TEST_MSG("%s, query: %ls, name: %ls, expected: %d, got: %d", kernels[ki].name, q.sn, norm, expected, got);
+            similar_query_free(&q);
+            goto cleanup;
+          }
+        }
+      }
+    }
+    similar_query_free(&q);
+  }
+  TEST_CHECK(narrow > 0 && wide > 0);
+
+cleanup:
+  free(diff.fpbuf);
+  font_list_destroy(&fl);
+}
+
+static void test_font_get_similar_topk(void) {
+  static wchar_t const *const names[] = {
+      L"Arial",
+      L"Arial Black",
+      L"Arial Narrow",
+      L"ＭＳ ゴシック",
+      L"ＭＳ Ｐゴシック",
+      L"ＭＳ 明朝",
+      L"Meiryo UI",
+      L"メイリオ",
+      L"Yu Gothic",
+      L"游ゴシック",
+      L"游明朝",
+      L"が",
+      L"fFＳがイACぱ",
+  };
+  static wchar_t const *const queries[] = {
+      L"arial",
+      L"ｍｓ　ごしっく",
+      L"ゆうごしっく",
+      L"A",
+      // "が" shares no bigram with the query but is more similar than the font that does.
+      L"がｲ",
+      // longer than bitlcs_max_len
+      L"Arial Black Arial Narrow Meiryo UI Yu Gothic Yu Mincho ＭＳ Ｐゴシック 游ゴシック",
+  };
+  enum {
+    num_fillers = 40,
+    num_names = sizeof(names) / sizeof(names[0]) + num_fillers,
+  };
+  // Fillers make the font list large enough to use the bigram index.
+  wchar_t fillers[num_fillers][16];
+  wchar_t const *all_names[num_names];
+  for (size_t i = 0; i < num_names; ++i) {
+    if (i < num_fillers) {
+      wsprintfW(fillers[i], L"Dummy Font %d", (int)i);
+      all_names[i] = fillers[i];
+    } else {
+      all_names[i] = names[i - num_fillers];
+    }
+  }
+  struct font_list fl = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, all_names, num_names))) {
+    return;
+  }
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    TEST_CASE_("#%zu %ls", qi, queries[qi]);
+    struct similar_query q;
+    if (!TEST_CHECK(similar_query_init(&q, queries[qi]))) {
+      continue;
+    }
+    struct font_dict_cursor c = {0};
+    int scores[num_names];
+    bool shares_bigram[num_names] = {0};
+    size_t num_shares_bigram = 0;
+    for (size_t i = 0; i < fl.num; ++i) {
+      font_dict_cursor_seek(&c, &fl, i);
+      wchar_t const *const norm = font_dict_cursor_norm(&c, &fl);
+      scores[i] = similar_query_score(&q, norm, fl.normlen[i], INT_MAX);
+      for (size_t j = 1; j < q.snlen && !shares_bigram[i]; ++j) {
+        for (size_t l = 1; l < fl.normlen[i] && !shares_bigram[i]; ++l) {
+          shares_bigram[i] = q.sn[j - 1] == norm[l - 1] && q.sn[j] == norm[l];
+        }
+      }
+      if (shares_bigram[i]) {
+        ++num_shares_bigram;
+      }
+    }
+    similar_query_free(&q);
+
+    for (size_t k = 1; k <= fl.num + 1; ++k) {
+      struct font_similar out[num_names + 1];
+      struct font_similar_stats stats;
+      size_t const n = font_get_similar_topk(&fl, queries[qi], k, out, &stats);
+      TEST_CHECK(n == (k < fl.num ? k : fl.num));
+      // Some of the fonts sharing a bigram with the query are scored first, and then all fonts are scanned.
+      TEST_CHECK(stats.candidates <= num_shares_bigram);
+      TEST_CHECK(stats.scored + stats.pruned == fl.num + stats.candidates);
+      bool selected[num_names] = {0};
+      for (size_t i = 0; i < n; ++i) {
+        TEST_CHECK(out[i].score == scores[out[i].idx]);
+        TEST_CHECK(i == 0 || similar_better(out[i - 1], out[i]));
+        selected[out[i].idx] = true;
+      }
+      // every font that is not selected must not be better than the selected ones, sharing a bigram or not.
+      for (size_t i = 0; i < fl.num; ++i) {
+        if (!selected[i] && n) {
+          TEST_CHECK(similar_better(out[n - 1], (struct font_similar){.idx = (int)i, .score = scores[i]}));
+        }
+      }
+    }
+  }
+  font_list_destroy(&fl);
+}
+
+static void test_font_get_similar_cached(void) {
+  static wchar_t const *const families[] = {
+      L"Noto Sans",
+      L"Noto Serif",
+      L"Source Han Sans",
+      L"Meiryo",
+      L"ＭＳ ゴシック",
+      L"游明朝",
+  };
+  // Typed one character at a time, with a repeat, a correction and a query longer than the cache holds.
+  static wchar_t const *const queries[] = {
+      L"s",
+      L"so",
+      L"sou",
+      L"sour",
+      L"sourc",
+      L"source",
+      L"source 0",
+      L"source 01",
+      L"source 01",
+      L"source 012",
+      L"noto",
+      L"noto serif 0123",
+      L"ゴシ",
+      L"ゴシック",
+      // Longer than the names, where an appended code unit lowers the score the most.
+      L"xxxxxxxxxxxx",
+      L"xxxxxxxxxxxx游",
+      L"xxxxxxxxxxxx游明",
+      L"xxxxxxxxxxxx游明朝",
+      L"abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz",
+  };
+  enum {
+    num_families = sizeof(families) / sizeof(families[0]),
+    num_names = 600,
+    k = 10,
+  };
+  wchar_t buf[num_names][font_name_buffer_len];
+  wchar_t const *names[num_names];
+  for (size_t i = 0; i < num_names; ++i) {
+    wsprintfW(buf[i], L"%s %04d", families[i % num_families], (int)(i * 37 % 10000));
+    names[i] = buf[i];
+  }
+  struct font_list fl = {0}, other = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names)) ||
+      !TEST_CHECK(create_font_list_from_names(&other, names, num_names))) {
+    goto cleanup;
+  }
+  TEST_CHECK(fl.generation != 0 && other.generation != 0 && fl.generation != other.generation);
+
+  // Every path is exact, so the cached answers must match the plain ones.
+  struct font_similar_cache cache = {0};
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    TEST_CASE_("#%zu %ls", qi, queries[qi]);
+    struct font_similar expected[k], got[k];
+    size_t const hits = cache.hits;
+    struct font_similar_stats st = {0};
+    size_t const n1 = font_get_similar_topk(&fl, queries[qi], k, expected, NULL);
+    size_t const n2 = font_get_similar_cached(&fl, &cache, queries[qi], k, got, &st, NULL, NULL);
+    if (!TEST_CHECK(n1 == k && n2 == n1)) {
+      continue;
+    }
+    TEST_CHECK(cache.hits != hits || st.scored + st.pruned == fl.num + st.candidates);
+    for (size_t i = 0; i < n1; ++i) {
+      if (!TEST_CHECK(expected[i].idx == got[i].idx && expected[i].score == got[i].score)) {
+        TEST_MSG("#%zu expected: %d (%d), got: %d (%d)",
+                 i,
+                 expected[i].idx,
+                 expected[i].score,
+                 got[i].idx,
+                 got[i].score);
+        break;
+      }
+    }
+    if (qi > 0 && wcscmp(queries[qi], queries[qi - 1]) == 0) {
+      TEST_CHECK(cache.hits == hits + 1);
+    }
+  }
+  TEST_CHECK(cache.hits + cache.refines + cache.misses == sizeof(queries) / sizeof(queries[0]));
+  TEST_CHECK(cache.hits == 1);
+  TEST_CHECK(cache.refines > 0);
+  TEST_CHECK(cache.misses > 0);
+
+  // The entries belong to the font list they were made for.
+  struct font_similar out[k];
+  size_t const misses = cache.misses;
+  TEST_CHECK(font_get_similar_cached(&fl, &cache, L"meiryo", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"meiryo", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(cache.misses == misses + 2);
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"meiryo", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(cache.hits == 2);
+  TEST_CHECK(
+      font_get_similar_cached(&other, &cache, L"meiryo", font_similar_cache_size + 1, out, NULL, NULL, NULL) == 0);
+
+  // A cancelled query fails and leaves the cache empty, so the next one scans again.
+  struct font_similar_cancel cancel = {.requested = 1};
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"meiryo ui", k, out, NULL, &cancel, NULL) == 0);
+  TEST_CHECK(cache.generation == 0);
+  cancel.requested = 0;
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"meiryo ui", k, out, NULL, &cancel, NULL) == k);
+  TEST_CHECK(cache.misses == misses + 3);
+
+  // A query asked again after others is answered from the recent queries by its normalized form.
+  struct font_similar first[k];
+  size_t const recent_hits = cache.recent_hits;
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"noto", k, first, NULL, NULL, NULL) == k);
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"游明朝", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"ＮＯＴＯ", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(cache.recent_hits == recent_hits + 1);
+  TEST_CHECK(memcmp(first, out, sizeof(first)) == 0);
+  // Only the top font_similar_recent_topk entries are kept.
+  struct font_similar more[font_similar_recent_topk + 1];
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"游明朝", font_similar_recent_topk + 1, more, NULL, NULL, NULL) ==
+             font_similar_recent_topk + 1);
+  TEST_CHECK(cache.recent_hits == recent_hits + 1);
+  // The least recently used query is replaced.
+  for (int i = 0; i < font_similar_recent_size; ++i) {
+    wchar_t query[font_name_buffer_len];
+    wsprintfW(query, L"font %d", i);
+    TEST_CHECK(font_get_similar_cached(&other, &cache, query, k, out, NULL, NULL, NULL) == k);
+  }
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"noto", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(cache.recent_hits == recent_hits + 1);
+  TEST_CHECK(font_get_similar_cached(&other, &cache, L"font 1", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(cache.recent_hits == recent_hits + 2);
+  // The queries of another font list are dropped.
+  TEST_CHECK(font_get_similar_cached(&fl, &cache, L"noto", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(font_get_similar_cached(&fl, &cache, L"font 1", k, out, NULL, NULL, NULL) == k);
+  TEST_CHECK(cache.recent_hits == recent_hits + 2);
+  TEST_CHECK(cache.recent_generation == fl.generation);
+
+  font_similar_cache_free(&cache);
+  TEST_CHECK(cache.bounds == NULL);
+
+cleanup:
+  font_list_destroy(&other);
+  font_list_destroy(&fl);
+}
+
+static void test_font_get_similar_preferred(void) {
+  static wchar_t const *const families[] = {
+      L"Noto Sans",
+      L"Noto Serif",
+      L"Source Han Sans",
+      L"Meiryo",
+      L"ＭＳ ゴシック",
+      L"游明朝",
+  };
+  static wchar_t const *const queries[] = {
+      L"font",
+      L"no",
+      L"noto",
+      L"noto s",
+      L"meiryo",
+      L"ゴシ",
+      L"source 01",
+  };
+  enum {
+    num_families = sizeof(families) / sizeof(families[0]),
+    num_names = 600,
+    k = 10,
+  };
+  wchar_t buf[num_names][font_name_buffer_len];
+  wchar_t const *names[num_names];
+  struct font_similar_cache cache = {0};
+  struct font_list fl = {0};
+
+  // All names score the same for "font", so only the preferred fonts move, and one from beyond the top k comes in.
+  for (size_t i = 0; i < 200; ++i) {
+    wsprintfW(buf[i], L"Font %03d", (int)i);
+    names[i] = buf[i];
+  }
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, 200))) {
+    goto cleanup;
+  }
+  struct font_similar_preferred preferred = {.idx = {150, 3}, .num = 2};
+  struct font_similar out[k];
+  if (TEST_CHECK(font_get_similar_cached(&fl, &cache, L"font", k, out, NULL, NULL, &preferred) == k)) {
+    TEST_CHECK(out[0].idx == 150);
+    TEST_CHECK(out[1].idx == 3);
+    for (size_t i = 2; i < k; ++i) {
+      TEST_CHECK(out[i].idx == (int)(i < 5 ? i - 2 : i - 1));
+    }
+  }
+  // The full ranking moves them the same way, and the rest of it follows.
+  struct font_similar *ranked = font_get_similar_ranked(&fl, L"font", NULL, &preferred);
+  if (TEST_CHECK(ranked != NULL)) {
+    TEST_CHECK(ranked[0].idx == 150);
+    TEST_CHECK(ranked[1].idx == 3);
+    for (size_t i = 2; i < fl.num; ++i) {
+      TEST_CHECK(ranked[i].idx == (int)(i < 5 ? i - 2 : i < 151 ? i - 1 : i));
+    }
+    free(ranked);
+  }
+  struct font_similar_cancel const cancel = {.requested = 1};
+  TEST_CHECK(font_get_similar_ranked(&fl, L"font", &cancel, &preferred) == NULL);
+  // The cache keeps the result without the preferred fonts.
+  size_t const hits = cache.hits;
+  if (TEST_CHECK(font_get_similar_cached(&fl, &cache, L"font", k, out, NULL, NULL, NULL) == k)) {
+    TEST_CHECK(cache.hits == hits + 1);
+    TEST_CHECK(out[0].idx == 0 && out[k - 1].idx == k - 1);
+  }
+  font_list_destroy(&fl);
+
+  // With at least k preferred fonts, their scores bound the scan, which must still find the same scores.
+  for (size_t i = 0; i < num_names; ++i) {
+    wsprintfW(buf[i], L"%s %04d", families[i % num_families], (int)(i * 37 % 10000));
+    names[i] = buf[i];
+  }
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    goto cleanup;
+  }
+  preferred = (struct font_similar_preferred){.num = font_similar_preferred_max};
+  for (size_t i = 0; i < font_similar_preferred_max; ++i) {
+    preferred.idx[i] = (int)((i * 71 + 5) % num_names);
+  }
+  font_similar_cache_free(&cache);
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    TEST_CASE_("#%zu %ls", qi, queries[qi]);
+    struct font_similar expected[k], got[k];
+    size_t const small_k = font_similar_preferred_max / 2;
+    size_t const n1 = font_get_similar_topk(&fl, queries[qi], small_k, expected, NULL);
+    size_t const n2 = font_get_similar_cached(&fl, &cache, queries[qi], small_k, got, NULL, NULL, &preferred);
+    if (!TEST_CHECK(n1 == small_k && n2 == n1)) {
+      continue;
+    }
+    struct font_similar *const all = font_get_similar_ranked(&fl, queries[qi], NULL, &preferred);
+    for (size_t i = 0; i < n1; ++i) {
+      TEST_CHECK(expected[i].score == got[i].score);
+      if (i > 0 && got[i - 1].score == got[i].score) {
+        TEST_CHECK(similar_preferred_rank(&preferred, got[i - 1].idx) <=
+                   similar_preferred_rank(&preferred, got[i].idx));
+      }
+      // The full ranking continues the top k.
+      TEST_CHECK(all && all[i].idx == got[i].idx && all[i].score == got[i].score);
+    }
+    free(all);
+  }
+
+cleanup:
+  font_similar_cache_free(&cache);
+  font_list_destroy(&fl);
+}
+
+static void test_font_usage(void) {
+  struct font_usage u = {0};
+  font_usage_record(&u, L"Meiryo");
+  font_usage_record(&u, L"Meiryo");
+  font_usage_record(&u, L"Yu Gothic");
+  TEST_CHECK(u.num == 2);
+  TEST_CHECK(u.dirty);
+  TEST_CHECK(wcscmp(u.entries[0].name, L"Meiryo") == 0);
+  TEST_CHECK(wcscmp(u.entries[1].name, L"Yu Gothic") == 0);
+  // The latest use goes first among equal counts.
+  font_usage_record(&u, L"Yu Gothic");
+  TEST_CHECK(wcscmp(u.entries[0].name, L"Yu Gothic") == 0);
+
+  // A font that is no longer used decays away.
+  for (int i = 0; i < 200; ++i) {
+    font_usage_record(&u, L"Arial");
+  }
+  TEST_CHECK(u.num == 1);
+  TEST_CHECK(wcscmp(u.entries[0].name, L"Arial") == 0);
+
+  // The least used entry makes room for a new name.
+  for (int i = 0; i < font_usage_capacity + 8; ++i) {
+    wchar_t name[font_name_buffer_len];
+    wsprintfW(name, L"Font %d", i);
+    font_usage_record(&u, name);
+  }
+  TEST_CHECK(u.num == font_usage_capacity);
+  TEST_CHECK(wcscmp(u.entries[0].name, L"Arial") == 0);
+  TEST_CHECK(wcscmp(u.entries[1].name, L"Font 39") == 0);
+  TEST_CHECK(wcscmp(u.entries[u.num - 1].name, L"Font 9") == 0);
+  for (size_t i = 1; i < u.num; ++i) {
+    TEST_CHECK(u.entries[i - 1].count >= u.entries[i].count);
+  }
+
+  // Only the names in the list are preferred, the most used first.
+  static wchar_t const *const names[] = {
+      L"Font 39",
+      L"Font 38",
+      L"Font 1",
+      L"Meiryo",
+  };
+  struct font_list fl = {0};
+  if (TEST_CHECK(create_font_list_from_names(&fl, names, sizeof(names) / sizeof(names[0])))) {
+    struct font_similar_preferred preferred;
+    font_usage_preferred(&u, &fl, &preferred);
+    if (TEST_CHECK(preferred.num == 2)) {
+      TEST_CHECK(preferred.idx[0] == font_list_index_of(&fl, L"Font 39"));
+      TEST_CHECK(preferred.idx[1] == font_list_index_of(&fl, L"Font 38"));
+    }
+  }
+  font_list_destroy(&fl);
+
+  wchar_t path[MAX_PATH];
+  DWORD const len = GetTempPathW(MAX_PATH, path);
+  if (!TEST_CHECK(len > 0 && len + 32 < MAX_PATH)) {
+    return;
+  }
+  wsprintfW(path + len, L"textassist_test_%u.fontusage", (unsigned)GetCurrentProcessId());
+  struct font_usage loaded = {0};
+  // A missing file is an empty table.
+  DeleteFileW(path);
+  TEST_CHECK(font_usage_load(&loaded, path));
+  TEST_CHECK(loaded.num == 0);
+  if (!TEST_CHECK(font_usage_save(&u, path))) {
+    goto cleanup;
+  }
+  TEST_CHECK(!u.dirty);
+  if (TEST_CHECK(font_usage_load(&loaded, path)) && TEST_CHECK(loaded.num == u.num)) {
+    for (size_t i = 0; i < u.num; ++i) {
+      TEST_CHECK(wcscmp(loaded.entries[i].name, u.entries[i].name) == 0);
+      TEST_CHECK(loaded.entries[i].count == u.entries[i].count);
+    }
+    TEST_CHECK(!loaded.dirty);
+  }
+
+  // A broken file is rejected and leaves the table empty.
+  HANDLE h = CreateFileW(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (TEST_CHECK(h != INVALID_HANDLE_VALUE)) {
+    uint8_t v = 0xff;
+    DWORD written = 0;
+    SetFilePointer(h, (LONG)offsetof(struct font_usage_file, entries) + 4, NULL, FILE_BEGIN);
+    TEST_CHECK(WriteFile(h, &v, 1, &written, NULL) && written == 1);
+    CloseHandle(h);
+    TEST_CHECK(!font_usage_load(&loaded, path));
+    TEST_CHECK(loaded.num == 0);
+  }
+
+cleanup:
+  DeleteFileW(path);
+}
+
+static void count_task(void *const userdata, size_t const idx) {
+  int *const counts = userdata;
+  ++counts[idx];
+}
+
+static void test_thread_pool(void) {
+  static size_t const threads[] = {1, 2, 4, 8};
+  enum {
+    num_tasks = 100,
+  };
+  for (size_t ti = 0; ti < sizeof(threads) / sizeof(threads[0]); ++ti) {
+    TEST_CASE_("%zu threads", threads[ti]);
+    struct thread_pool *pool = NULL;
+    if (!TEST_CHECK(thread_pool_create(&pool, threads[ti]))) {
+      continue;
+    }
+    TEST_CHECK(thread_pool_threads(pool) == threads[ti]);
+    // The workers go back to sleep after each job and pick up the next one.
+    for (size_t round = 0; round < 3; ++round) {
+      int counts[num_tasks] = {0};
+      thread_pool_run(pool, count_task, counts, num_tasks);
+      for (size_t i = 0; i < num_tasks; ++i) {
+        TEST_CHECK(counts[i] == 1);
+      }
+    }
+    thread_pool_destroy(&pool);
+    TEST_CHECK(pool == NULL);
+  }
+  // Without a pool the tasks run on the calling thread.
+  int counts[num_tasks] = {0};
+  thread_pool_run(NULL, count_task, counts, num_tasks);
+  for (size_t i = 0; i < num_tasks; ++i) {
+    TEST_CHECK(counts[i] == 1);
+  }
+}
+
+static void test_font_get_similar_parallel(void) {
+  static wchar_t const *const queries[] = {
+      L"sans",
+      L"kmp sans 01234",
+      L"乙丙 serif",
+      // longer than font_batch_max_query
+      L"abcdefghijklmnopqrstuvwxyz sans serif",
+  };
+  static wchar_t const letters[] = L"abcdefghijklmnopqrstuvwxyz";
+  enum {
+    num_names = font_similar_chunk_min * 5,
+    k = 10,
+  };
+  // Every seventh name has an ideograph, and there are more of them than the alphabet holds.
+  static wchar_t buf[num_names][font_name_buffer_len];
+  wchar_t const **names = realloc(NULL, num_names * sizeof(wchar_t const *));
+  struct font_similar *expected = realloc(NULL, num_names * 2 * sizeof(struct font_similar));
+  struct font_list fl = {0};
+  struct thread_pool *pool = NULL;
+  if (!TEST_CHECK(names != NULL && expected != NULL)) {
+    goto cleanup;
+  }
+  struct font_similar *const got = expected + num_names;
+  uint32_t rnd = 2463534242u;
+  for (size_t i = 0; i < num_names; ++i) {
+    wchar_t family[4] = {0};
+    for (size_t j = 0; j < 3; ++j) {
+      rnd ^= rnd << 13;
+      rnd ^= rnd >> 17;
+      rnd ^= rnd << 5;
+      family[j] = letters[rnd % 26];
+    }
+    if (i % 7 == 0) {
+      family[2] = (wchar_t)(0x4e00 + rnd % 400);
+    }
+    wsprintfW(buf[i], L"%s %s %05d", family, i % 2 ? L"Sans" : L"Serif", (int)i);
+    names[i] = buf[i];
+  }
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names)) ||
+      !TEST_CHECK(thread_pool_create(&pool, 4))) {
+    goto cleanup;
+  }
+  TEST_CHECK(similar_scan_range_count(&fl) == 1);
+
+  // Disable the bigram index so that the top-k queries scan all fonts too.
+  struct font_qgram_index const qgram = fl.qgram;
+  fl.qgram.keys = NULL;
+  for (size_t qi = 0; qi < sizeof(queries) / sizeof(queries[0]); ++qi) {
+    size_t const ks[] = {k, fl.num};
+    for (size_t ki = 0; ki < sizeof(ks) / sizeof(ks[0]); ++ki) {
+      TEST_CASE_("#%zu %ls, k = %zu", qi, queries[qi], ks[ki]);
+      fl.pool = NULL;
+      size_t const n1 = font_get_similar_topk(&fl, queries[qi], ks[ki], expected, NULL);
+      fl.pool = pool;
+      TEST_CHECK(similar_scan_range_count(&fl) == 4);
+      struct font_similar_stats st;
+      size_t const n2 = font_get_similar_topk(&fl, queries[qi], ks[ki], got, &st);
+      if (!TEST_CHECK(n1 == ks[ki] && n2 == n1)) {
+        continue;
+      }
+      TEST_CHECK(st.scored + st.pruned == fl.num);
+      for (size_t i = 0; i < n1; ++i) {
+        if (!TEST_CHECK(expected[i].idx == got[i].idx && expected[i].score == got[i].score)) {
+          TEST_MSG("#%zu expected: %d (%d), got: %d (%d)",
+                   i,
+                   expected[i].idx,
+                   expected[i].score,
+                   got[i].idx,
+                   got[i].score);
+          break;
+        }
+      }
+    }
+  }
+  fl.qgram = qgram;
+  fl.pool = pool;
+  pool = NULL;
+
+cleanup:
+  font_list_destroy(&fl);
+  thread_pool_destroy(&pool);
+  free(expected);
+  free(names);
+}
+
+static void test_font_cache(void) {
+  static wchar_t const *const names[] = {
+      L"Arial",
+      L"ＭＳ ゴシック",
+      L"ＭＳ 明朝",
+      L"Meiryo UI",
+      L"メイリオ",
+      L"Yu Gothic",
+  };
+  enum {
+    num_names = sizeof(names) / sizeof(names[0]),
+  };
+  wchar_t path[MAX_PATH];
+  DWORD const len = GetTempPathW(MAX_PATH, path);
+  if (!TEST_CHECK(len > 0 && len + 32 < MAX_PATH)) {
+    return;
+  }
+  wsprintfW(path + len, L"textassist_test_%u.fontcache", (unsigned)GetCurrentProcessId());
+
+  struct font_list fl = {0}, cached = {0};
+  struct font_dict_cursor c1 = {0}, c2 = {0};
+  if (!TEST_CHECK(create_font_list_from_names(&fl, names, num_names))) {
+    return;
+  }
+  struct font_cache_key const key = {.count = num_names, .hash = 0x12345678, .lcid = 0x411};
+  if (!TEST_CHECK(font_cache_save(&fl, &key, path))) {
+    goto cleanup;
+  }
+  if (!TEST_CHECK(font_cache_load(&cached, &key, path))) {
+    goto cleanup;
+  }
+  TEST_CHECK(cached.cache_view != NULL);
+  TEST_CHECK(cached.num == fl.num);
+  for (size_t i = 0; i < fl.num && i < cached.num; ++i) {
+    font_dict_cursor_seek(&c1, &fl, i);
+    font_dict_cursor_seek(&c2, &cached, i);
+    TEST_CHECK(wcscmp(c1.name, c2.name) == 0);
+    TEST_CHECK(wcscmp(font_dict_cursor_norm(&c1, &fl), font_dict_cursor_norm(&c2, &cached)) == 0);
+    TEST_CHECK(font_list_index_of(&cached, c1.name) == (int)i);
+    TEST_CHECK(font_list_step_in_family(&cached, i, 1) == font_list_step_in_family(&fl, i, 1));
+    TEST_CHECK(font_list_step_family(&cached, i, 1) == font_list_step_family(&fl, i, 1));
+  }
+  TEST_CHECK(cached.family.num == fl.family.num);
+  struct font_similar a[3], b[3];
+  size_t const na = font_get_similar_topk(&fl, L"ゆうごしっく", 3, a, NULL);
+  size_t const nb = font_get_similar_topk(&cached, L"ゆうごしっく", 3, b, NULL);
+  if (TEST_CHECK(na == nb)) {
+    for (size_t i = 0; i < na; ++i) {
+      TEST_CHECK(a[i].idx == b[i].idx && a[i].score == b[i].score);
+    }
+  }
+  font_list_destroy(&cached);
+
+  // a cache made for other fonts must be rejected.
+  struct font_cache_key other = key;
+  other.hash ^= 1;
+  TEST_CHECK(!font_cache_load(&cached, &other, path));
+
+  // a broken cache must be rejected.
+  HANDLE h = CreateFileW(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (TEST_CHECK(h != INVALID_HANDLE_VALUE)) {
+    uint8_t v = 0xff;
+    DWORD written = 0;
+    SetFilePointer(h, (LONG)sizeof(struct font_cache_header) + 8, NULL, FILE_BEGIN);
+    TEST_CHECK(WriteFile(h, &v, 1, &written, NULL) && written == 1);
+    CloseHandle(h);
+    TEST_CHECK(!font_cache_load(&cached, &key, path));
+  }
+
+  // A rebuild saves while the list loaded from the cache is still in use.
+  struct font_cache_key const key2 = {.count = num_names, .hash = 0x9abcdef0, .lcid = 0x411};
+  struct font_list rebuilt = {0};
+  if (!TEST_CHECK(font_cache_save_any(&fl, &key, path)) || !TEST_CHECK(font_cache_load_any(&cached, &key, path))) {
+    goto cleanup;
+  }
+  TEST_CHECK(font_cache_save_any(&fl, &key2, path));
+  if (TEST_CHECK(font_cache_load_any(&rebuilt, &key2, path))) {
+    TEST_CHECK(rebuilt.num == fl.num);
+  }
+  font_dict_cursor_seek(&c2, &cached, 0);
+  TEST_CHECK(wcscmp(c2.name, names[0]) == 0);
+  font_list_destroy(&cached);
+  font_list_destroy(&rebuilt);
+  // Once no list maps them, the stale files are deleted by the next save.
+  struct font_cache_key const key3 = {.count = num_names, .hash = 0x0badf00d, .lcid = 0x411};
+  TEST_CHECK(font_cache_save_any(&fl, &key3, path));
+  TEST_CHECK(!font_cache_load_any(&cached, &key, path));
+  TEST_CHECK(!font_cache_load_any(&cached, &key2, path));
+  TEST_CHECK(font_cache_load_any(&cached, &key3, path));
+
+cleanup:
+  font_list_destroy(&cached);
+  font_list_destroy(&fl);
+  DeleteFileW(path);
+  wcscat(path, L".1");
+  DeleteFileW(path);
+}
+
 TEST_LIST = {
     {"test_sprint_float", test_sprint_float},
     {"test_parse_tag_position", test_parse_tag_position},
+    {"test_parse_tag_font_name_length", test_parse_tag_font_name_length},
+    {"test_font_list_index_of", test_font_list_index_of},
+    {"test_font_list_index_of_equal_names", test_font_list_index_of_equal_names},
+    {"test_font_list_prefix_range", test_font_list_prefix_range},
+    {"test_font_list_family", test_font_list_family},
+    {"test_font_list_memory_usage", test_font_list_memory_usage},
+    {"test_font_list_sort_order", test_font_list_sort_order},
+    {"test_enum_font_callback", test_enum_font_callback},
+    {"test_extended_normalize", test_extended_normalize},
+    {"test_nfkc", test_nfkc},
+    {"test_nfkc_conformance", test_nfkc_conformance},
+    {"test_bitlcs_distance", test_bitlcs_distance},
+    {"test_font_alphabet", test_font_alphabet},
+    {"test_similar_batch", test_similar_batch},
+    {"test_font_get_similar_topk", test_font_get_similar_topk},
+    {"test_font_get_similar_cached", test_font_get_similar_cached},
+    {"test_font_get_similar_preferred", test_font_get_similar_preferred},
+    {"test_font_usage", test_font_usage},
+    {"test_thread_pool", test_thread_pool},
+    {"test_font_get_similar_parallel", test_font_get_similar_parallel},
+    {"test_font_cache", test_font_cache},
     {NULL, NULL},
 };
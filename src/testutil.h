@@ -0,0 +1,20 @@
+#pragma once
+
+// Helpers shared by test.c and bench.c, which include fontlist.c before this header to reach its internals.
+
+static bool create_font_list_from_names(struct font_list *const fl, wchar_t const *const *const names, size_t const n) {
+  struct enum_font_data fd = {0};
+  LOGFONTW lf = {0};
+  bool ret = false;
+  for (size_t i = 0; i < n; ++i) {
+    wcscpy(lf.lfFaceName, names[i]);
+    if (!enum_font_callback(&lf, NULL, TRUETYPE_FONTTYPE, (LPARAM)&fd)) {
+      goto cleanup;
+    }
+  }
+  ret = enum_font_data_normalize(&fd) && font_list_build(fl, &fd);
+
+cleanup:
+  enum_font_data_free(&fd);
+  return ret;
+}
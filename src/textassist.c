@@ -216,7 +216,7 @@ static bool parse_tag(wchar_t const *const str, int const len, int const pos, st
         break;
       case tag_type_font:
       case tag_type_font_relative:
-        if (value_len[1] > 255) {
+        if ((size_t)value_len[1] >= sizeof(tag->value.font.name) / sizeof(wchar_t)) {
           return false; // too long
         }
       }
@@ -444,9 +444,942 @@ static bool increment_tag_position(struct tag *const tag, int const pos, int con
   return true;
 }
 
-static struct font_list g_font_name_list = {0};
+static struct settings {
+  wchar_t filepath[MAX_PATH];
+  wchar_t fontcache_path[MAX_PATH];
+  wchar_t fontusage_path[MAX_PATH];
+  bool psdtoolkit_installed;
+  bool prefer_pp;
+  bool family_step;
+} g_settings = {0};
+
+static HINSTANCE g_hinst = NULL;
+
+// Font lists are built on a worker thread so that enumerating and indexing fonts does not block AviUtl's message
+// loop, and are rebuilt there whenever WM_FONTCHANGE arrives.
+// The published snapshot holds one reference and UI-thread queries hold another while they run, because
+// TrackPopupMenu pumps messages and a newer snapshot may be published in the meantime.
+// Replaced snapshots are pushed onto g_font_list_retired by the worker and released on the UI thread.
+struct font_list_snapshot {
+  struct font_list fl;
+  struct font_list_snapshot *next;
+  int refcount; // touched only by the UI thread once published
+};
+
+static struct font_list_snapshot *g_font_list_current = NULL;
+static struct font_list_snapshot *g_font_list_retired = NULL;
+static HANDLE g_font_list_thread = NULL;
+static HANDLE g_font_list_ready = NULL;   // set after the first build attempt
+static HANDLE g_font_list_changed = NULL; // set by WM_FONTCHANGE
+static HANDLE g_font_list_quit = NULL;
+static HWND g_font_list_window = NULL;
+
+enum {
+  font_list_wait_timeout_ms = 500,
+  font_list_settle_ms = 1000,
+};
+
+static struct font_list_snapshot *acquire_font_list(DWORD const timeout) {
+  struct font_list_snapshot *s = InterlockedCompareExchangePointer((PVOID volatile *)&g_font_list_current, NULL, NULL);
+  if (!s && g_font_list_ready && WaitForSingleObject(g_font_list_ready, timeout) == WAIT_OBJECT_0) {
+    s = InterlockedCompareExchangePointer((PVOID volatile *)&g_font_list_current, NULL, NULL);
+  }
+  if (s) {
+    ++s->refcount;
+  }
+  return s;
+}
+
+static void release_font_list(struct font_list_snapshot *const s) {
+  if (!s || --s->refcount) {
+    return;
+  }
+  font_list_destroy(&s->fl);
+  free(s);
+}
+
+static void release_retired_font_lists(void) {
+  struct font_list_snapshot *s = InterlockedExchangePointer((PVOID volatile *)&g_font_list_retired, NULL);
+  while (s) {
+    struct font_list_snapshot *const next = s->next;
+    release_font_list(s);
+    s = next;
+  }
+}
+
+// The fonts the user committed, ranked first among the fuzzy results of the same score.
+// Only a name chosen from the picker or the completion menu is recorded. The names passed over by stepping with the
+// arrow keys are not, since every record decays the others and a held key would wash the history out.
+// Loaded on the first use rather than at startup, saved when the filter exits, and touched only by the UI thread.
+static struct font_usage g_font_usage = {0};
+static bool g_font_usage_loaded = false;
+
+static struct font_usage *get_font_usage(void) {
+  if (!g_font_usage_loaded) {
+    g_font_usage_loaded = true;
+    if (g_settings.fontusage_path[0] != L'\0' && !font_usage_load(&g_font_usage, g_settings.fontusage_path)) {
+      ods(L"failed to load font usage");
+    }
+  }
+  return &g_font_usage;
+}
+
+// Fuzzy queries run on g_similar_thread so that a slow query does not freeze the edit control.
+// The UI thread hands a request over through g_similar_next, and the worker posts it back to g_font_list_window
+// with the result. A request holds a reference to its snapshot, which is released when the UI thread takes it back.
+// Only the latest request is shown, and a newer input cancels it through its token.
+struct similar_request {
+  struct font_list_snapshot *snapshot;
+  HWND hwnd;
+  // The result is shown only if the caret and the text length are still the same.
+  DWORD caret;
+  int textlen;
+  // Sized like the name of a font tag, since increment_tag_font_name compares the two.
+  wchar_t query[sizeof(((struct tag *)0)->value.font.name) / sizeof(wchar_t)];
+  struct font_similar_preferred preferred;
+  struct font_similar_cancel cancel;
+  struct font_similar result[10];
+  size_t num;
+  // Set for the picker to rank all fonts but the ones of result into ranked, see start_similar_ranking.
+  bool deep;
+  struct font_similar *ranked;
+  size_t nranked;
+};
+
+// The last fuzzy query, which is usually extended by the next one. Touched only by the worker.
+static struct font_similar_cache g_similar_cache = {0};
+static struct similar_request *g_similar_next = NULL;   // exchanged with the worker
+static struct similar_request *g_similar_latest = NULL; // touched only by the UI thread
+static struct similar_request *g_similar_ready = NULL;  // the result being shown, touched only by the UI thread
+static HANDLE g_similar_thread = NULL;
+static HANDLE g_similar_wake = NULL;
+static HANDLE g_similar_quit = NULL;
+
+static void free_similar_request(struct similar_request *const r) {
+  release_font_list(r->snapshot);
+  if (r->ranked) {
+    free(r->ranked);
+  }
+  free(r);
+}
+
+static void rank_similar_request(struct similar_request *const r) {
+  if (r->cancel.requested) {
+    return;
+  }
+  LARGE_INTEGER freq, start, end;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&start);
+  struct font_list const *const fl = &r->snapshot->fl;
+  struct font_similar *const all = font_get_similar_ranked(fl, r->query, &r->cancel, &r->preferred);
+  if (!all) {
+    if (r->cancel.requested) {
+      ods(L"similar font ranking cancelled");
+    } else {
+      ods(L"failed to rank similar fonts");
+    }
+    return;
+  }
+  // The fonts of the result are taken out by a binary search over their sorted indices.
+  int shown[sizeof(r->result) / sizeof(r->result[0])];
+  for (size_t i = 0; i < r->num; ++i) {
+    size_t j = i;
+    for (; j > 0 && shown[j - 1] > r->result[i].idx; --j) {
+      shown[j] = shown[j - 1];
+    }
+    shown[j] = r->result[i].idx;
+  }
+  size_t n = 0;
+  for (size_t i = 0; i < fl->num; ++i) {
+    size_t lo = 0, hi = r->num;
+    while (lo < hi) {
+      size_t const mid = (lo + hi) / 2;
+      if (shown[mid] < all[i].idx) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    if (lo == r->num || shown[lo] != all[i].idx) {
+      all[n++] = all[i];
+    }
+  }
+  r->ranked = all;
+  r->nranked = n;
+  QueryPerformanceCounter(&end);
+  ods(L"similar font ranking: %d fonts in %d us",
+      (int)fl->num,
+      (int)((end.QuadPart - start.QuadPart) * 1000000 / freq.QuadPart));
+}
+
+static void run_similar_request(struct similar_request *const r) {
+  if (r->deep) {
+    rank_similar_request(r);
+  } else if (!r->cancel.requested) {
+    LARGE_INTEGER freq, start, end;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&start);
+    struct font_similar_stats stats;
+    struct font_list const *const fl = &r->snapshot->fl;
+    r->num = font_get_similar_cached(fl,
+                                     &g_similar_cache,
+                                     r->query,
+                                     sizeof(r->result) / sizeof(r->result[0]),
+                                     r->result,
+                                     &stats,
+                                     &r->cancel,
+                                     &r->preferred);
+    QueryPerformanceCounter(&end);
+    if (r->num) {
+      struct font_similar_cache const *const c = &g_similar_cache;
+      size_t const queries = c->hits + c->recent_hits + c->refines + c->misses;
+      ods(L"similar font query: %d fonts, %d scored, %d pruned in %d us "
+          L"(cache: %d hits, %d recent hits, %d refines, %d misses, hit rate %d%%)",
+          (int)fl->num,
+          (int)stats.scored,
+          (int)stats.pruned,
+          (int)((end.QuadPart - start.QuadPart) * 1000000 / freq.QuadPart),
+          (int)c->hits,
+          (int)c->recent_hits,
+          (int)c->refines,
+          (int)c->misses,
+          (int)(queries ? (c->hits + c->recent_hits) * 100 / queries : 0));
+    } else if (r->cancel.requested) {
+      ods(L"similar font query cancelled");
+    } else {
+      ods(L"failed to get a list of similar font names");
+    }
+  }
+  // The snapshot reference may be released only by the UI thread, so a request that cannot be posted is leaked.
+  if (!PostMessageW(g_font_list_window, WM_APP + 3, 0, (LPARAM)r)) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"PostMessage failed");
+  }
+}
+
+static DWORD WINAPI similar_worker(LPVOID param) {
+  (void)param;
+  HANDLE const events[2] = {g_similar_quit, g_similar_wake};
+  while (WaitForMultipleObjects(2, events, FALSE, INFINITE) == WAIT_OBJECT_0 + 1) {
+    struct similar_request *r;
+    while ((r = InterlockedExchangePointer((PVOID volatile *)&g_similar_next, NULL)) != NULL) {
+      run_similar_request(r);
+    }
+  }
+  return 0;
+}
 
-static PCWSTR choice_similar_font(struct font_list *fl, HWND hwnd, PCWSTR s) {
+static void cancel_similar_query(void) {
+  if (g_similar_latest) {
+    InterlockedExchange(&g_similar_latest->cancel.requested, 1);
+    g_similar_latest = NULL;
+  }
+}
+
+// Hands the request over to the worker, and the result arrives later as WM_APP + 3, see receive_similar_result.
+static void submit_similar_request(struct similar_request *const r) {
+  g_similar_latest = r;
+  if (!g_similar_thread) {
+    // Without the worker the query runs here, and the result is still delivered through the message.
+    run_similar_request(r);
+    return;
+  }
+  struct similar_request *const old = InterlockedExchangePointer((PVOID volatile *)&g_similar_next, r);
+  if (old) {
+    free_similar_request(old); // cancelled before the worker took it
+  }
+  SetEvent(g_similar_wake);
+  SetCursor(LoadCursorW(NULL, IDC_APPSTARTING));
+}
+
+static void start_similar_query(HWND hwnd, struct font_list_snapshot *const snapshot, wchar_t const *const query) {
+  cancel_similar_query();
+  if (wcslen(query) >= sizeof(((struct similar_request *)0)->query) / sizeof(wchar_t)) {
+    ods(L"font name is too long to query");
+    return;
+  }
+  struct similar_request *const r = realloc(NULL, sizeof(struct similar_request));
+  if (!r) {
+    ods(L"failed to allocate memory");
+    return;
+  }
+  DWORD caret_start = 0, caret_end = 0;
+  SendMessageW(hwnd, EM_GETSEL, (WPARAM)&caret_start, (LPARAM)&caret_end);
+  *r = (struct similar_request){
+      .snapshot = snapshot,
+      .hwnd = hwnd,
+      .caret = caret_start,
+      .textlen = GetWindowTextLengthW(hwnd),
+  };
+  ++snapshot->refcount;
+  wcscpy(r->query, query);
+  font_usage_preferred(get_font_usage(), &snapshot->fl, &r->preferred);
+  submit_similar_request(r);
+}
+
+// Ranks all fonts for the query of the shown request on the worker, with the same preferred fonts and cancelled the
+// same way as a query. The fonts of its result are left out, since the picker shows them above the ranking.
+static void start_similar_ranking(struct similar_request const *const shown) {
+  cancel_similar_query();
+  struct similar_request *const r = realloc(NULL, sizeof(struct similar_request));
+  if (!r) {
+    ods(L"failed to allocate memory");
+    return;
+  }
+  *r = *shown;
+  r->cancel = (struct font_similar_cancel){0};
+  r->deep = true;
+  r->ranked = NULL;
+  r->nranked = 0;
+  ++r->snapshot->refcount;
+  submit_similar_request(r);
+}
+
+static void close_similar_worker(void) {
+  if (g_similar_thread) {
+    SetEvent(g_similar_quit);
+    WaitForSingleObject(g_similar_thread, INFINITE);
+    CloseHandle(g_similar_thread);
+    g_similar_thread = NULL;
+  }
+  if (g_similar_quit) {
+    CloseHandle(g_similar_quit);
+    g_similar_quit = NULL;
+  }
+  if (g_similar_wake) {
+    CloseHandle(g_similar_wake);
+    g_similar_wake = NULL;
+  }
+  g_similar_latest = NULL;
+  struct similar_request *const r = InterlockedExchangePointer((PVOID volatile *)&g_similar_next, NULL);
+  if (r) {
+    free_similar_request(r);
+  }
+  MSG msg;
+  while (g_font_list_window && PeekMessageW(&msg, g_font_list_window, WM_APP + 3, WM_APP + 3, PM_REMOVE)) {
+    free_similar_request((struct similar_request *)msg.lParam);
+  }
+}
+
+static bool start_similar_worker(void) {
+  g_similar_wake = CreateEventW(NULL, FALSE, FALSE, NULL);
+  g_similar_quit = CreateEventW(NULL, TRUE, FALSE, NULL);
+  if (!g_similar_wake || !g_similar_quit) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateEvent failed");
+    goto failed;
+  }
+  g_similar_thread = CreateThread(NULL, 0, similar_worker, NULL, 0, NULL);
+  if (!g_similar_thread) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateThread failed");
+    goto failed;
+  }
+  return true;
+
+failed:
+  close_similar_worker();
+  return false;
+}
+
+// Font preview.
+//
+// The picker draws each font name in its own typeface. Creating a font for each row on every paint is far too slow
+// with thousands of fonts, so a row is rendered once into a slot of one bitmap and copied from there afterwards,
+// and the fonts are kept for a while in case their rows are rendered again. Both are keyed by the index into the
+// font list, and the least recently used one is replaced. So the cache holds one memory DC, one bitmap of at most
+// font_preview_budget bytes and font_preview_fonts fonts however many fonts there are.
+// The rows are rendered in the window text color on the window color and copied as they are, and the entries are
+// dropped when the colors change. The selected row is drawn on the highlight with the cached font instead.
+// Touched only by the UI thread.
+enum {
+  font_preview_width = 320,
+  font_preview_row_height = 24,
+  font_preview_text_height = 18,
+  font_preview_budget = 2 * 1024 * 1024,
+  font_preview_slots = font_preview_budget / (font_preview_width * font_preview_row_height * 4),
+  font_preview_fonts = 16,
+};
+
+struct font_preview_slot {
+  int idx;
+  uint32_t used; // 0 if empty
+};
+
+struct font_preview_font {
+  HFONT font;
+  int idx;
+  uint32_t used; // 0 if empty
+};
+
+static struct font_preview {
+  uint32_t generation; // of the font list the entries belong to
+  COLORREF text;       // the colors the slots are rendered in
+  COLORREF back;
+  HDC dc;
+  HBITMAP bitmap;
+  HGDIOBJ old_bitmap;
+  struct font_preview_slot slots[font_preview_slots];
+  struct font_preview_font fonts[font_preview_fonts];
+  uint32_t clock;
+  size_t hits;
+  size_t misses;
+  size_t prerendered;
+  size_t fonts_created;
+  size_t paints;
+  LONGLONG paint_ticks;
+} g_font_preview = {0};
+
+static void font_preview_clear(void) {
+  struct font_preview *const c = &g_font_preview;
+  for (size_t i = 0; i < font_preview_fonts; ++i) {
+    if (c->fonts[i].font) {
+      DeleteObject(c->fonts[i].font);
+    }
+    c->fonts[i] = (struct font_preview_font){0};
+  }
+  for (size_t i = 0; i < font_preview_slots; ++i) {
+    c->slots[i] = (struct font_preview_slot){0};
+  }
+  c->generation = 0;
+}
+
+static void font_preview_destroy(void) {
+  struct font_preview *const c = &g_font_preview;
+  font_preview_clear();
+  if (c->dc) {
+    SelectObject(c->dc, c->old_bitmap);
+    DeleteDC(c->dc);
+  }
+  if (c->bitmap) {
+    DeleteObject(c->bitmap);
+  }
+  *c = (struct font_preview){0};
+}
+
+// Creates the bitmap on the first use and drops the entries of another font list or other colors.
+static bool font_preview_prepare(struct font_list const *const fl) {
+  struct font_preview *const c = &g_font_preview;
+  if (!c->dc) {
+    c->dc = CreateCompatibleDC(NULL);
+    if (!c->dc) {
+      ods(L"CreateCompatibleDC failed");
+      return false;
+    }
+    BITMAPINFO const bi = {
+        .bmiHeader =
+            {
+                .biSize = sizeof(BITMAPINFOHEADER),
+                .biWidth = font_preview_width,
+                .biHeight = -(font_preview_row_height * font_preview_slots),
+                .biPlanes = 1,
+                .biBitCount = 32,
+                .biCompression = BI_RGB,
+            },
+    };
+    void *bits = NULL;
+    c->bitmap = CreateDIBSection(c->dc, &bi, DIB_RGB_COLORS, &bits, NULL, 0);
+    if (!c->bitmap) {
+      ods(L"CreateDIBSection failed");
+      font_preview_destroy();
+      return false;
+    }
+    c->old_bitmap = SelectObject(c->dc, c->bitmap);
+    SetBkMode(c->dc, TRANSPARENT);
+    ods(L"font preview: %d slots in %d bytes, up to %d fonts",
+        (int)font_preview_slots,
+        (int)(font_preview_width * font_preview_row_height * font_preview_slots * 4),
+        (int)font_preview_fonts);
+  }
+  COLORREF const text = GetSysColor(COLOR_WINDOWTEXT);
+  COLORREF const back = GetSysColor(COLOR_WINDOW);
+  if (c->generation != fl->generation || c->text != text || c->back != back) {
+    font_preview_clear();
+    c->generation = fl->generation;
+    c->text = text;
+    c->back = back;
+    SetTextColor(c->dc, text);
+  }
+  return true;
+}
+
+// Returns the slot of the rendered font, or -1 if it is not rendered yet.
+static int font_preview_find(int const idx) {
+  struct font_preview *const c = &g_font_preview;
+  for (size_t i = 0; i < font_preview_slots; ++i) {
+    if (c->slots[i].used && c->slots[i].idx == idx) {
+      c->slots[i].used = ++c->clock;
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+static HFONT font_preview_get_font(struct font_list const *const fl, int const idx) {
+  struct font_preview *const c = &g_font_preview;
+  size_t victim = 0;
+  for (size_t i = 0; i < font_preview_fonts; ++i) {
+    if (c->fonts[i].used && c->fonts[i].idx == idx) {
+      c->fonts[i].used = ++c->clock;
+      return c->fonts[i].font;
+    }
+    if (c->fonts[i].used < c->fonts[victim].used) {
+      victim = i;
+    }
+  }
+  struct font_preview_font *const f = &c->fonts[victim];
+  if (f->font) {
+    DeleteObject(f->font);
+  }
+  *f = (struct font_preview_font){0};
+  LOGFONTW lf = {
+      .lfHeight = -font_preview_text_height,
+      .lfCharSet = DEFAULT_CHARSET,
+      .lfQuality = ANTIALIASED_QUALITY,
+  };
+  font_list_get_name(fl, (size_t)idx, lf.lfFaceName);
+  f->font = CreateFontIndirectW(&lf);
+  if (!f->font) {
+    ods(L"CreateFontIndirect failed");
+    return NULL;
+  }
+  f->idx = idx;
+  f->used = ++c->clock;
+  ++c->fonts_created;
+  return f->font;
+}
+
+// Renders the name of the font in its own typeface into the least recently used slot and returns the slot,
+// or -1 on failure.
+static int font_preview_render(struct font_list const *const fl, int const idx) {
+  struct font_preview *const c = &g_font_preview;
+  size_t victim = 0;
+  for (size_t i = 1; i < font_preview_slots && c->slots[victim].used; ++i) {
+    if (c->slots[i].used < c->slots[victim].used) {
+      victim = i;
+    }
+  }
+  c->slots[victim] = (struct font_preview_slot){0};
+  HFONT const font = font_preview_get_font(fl, idx);
+  if (!font) {
+    return -1;
+  }
+  wchar_t name[font_name_buffer_len];
+  font_list_get_name(fl, (size_t)idx, name);
+  RECT rc = {
+      .left = 0,
+      .top = (int)victim * font_preview_row_height,
+      .right = font_preview_width,
+      .bottom = ((int)victim + 1) * font_preview_row_height,
+  };
+  FillRect(c->dc, &rc, GetSysColorBrush(COLOR_WINDOW));
+  rc.left += 4;
+  HGDIOBJ const old = SelectObject(c->dc, font);
+  DrawTextW(c->dc, name, -1, &rc, DT_SINGLELINE | DT_VCENTER | DT_NOPREFIX | DT_END_ELLIPSIS);
+  SelectObject(c->dc, old);
+  c->slots[victim] = (struct font_preview_slot){
+      .idx = idx,
+      .used = ++c->clock,
+  };
+  return (int)victim;
+}
+
+static void font_preview_log(void) {
+  struct font_preview const *const c = &g_font_preview;
+  if (!c->paints) {
+    return;
+  }
+  LARGE_INTEGER freq;
+  QueryPerformanceFrequency(&freq);
+  size_t const lookups = c->hits + c->misses;
+  ods(L"font preview: %d rows painted in %d us, %d hits, %d misses (hit rate %d%%), %d prerendered, %d fonts created",
+      (int)c->paints,
+      (int)(c->paint_ticks * 1000000 / freq.QuadPart),
+      (int)c->hits,
+      (int)c->misses,
+      (int)(lookups ? c->hits * 100 / lookups : 0),
+      (int)c->prerendered,
+      (int)c->fonts_created);
+}
+
+// Font picker.
+//
+// choice_similar_font shows the ranked fonts in a popup list view in virtual mode (LVS_OWNERDATA).
+// The list view holds no rows and asks for the visible ones by WM_DRAWITEM and LVN_GETDISPINFO, so opening the popup
+// costs the same however many fonts there are. The first rows are the result of the request, and the rest are
+// ranked at once on the worker when they are first scrolled into view, see start_similar_ranking. They show a
+// placeholder until the ranking arrives.
+// Typing in the edit box above the list starts a new query on the worker, and its result replaces the rows of the
+// same window, see font_picker_receive. The popup runs its own message loop until a font is chosen or it is closed.
+// The rows are owner-drawn from the font preview cache, and the loop renders the rows around the visible ones into
+// the cache while no message is waiting, see font_picker_prerender.
+enum {
+  font_picker_width = font_preview_width,
+  font_picker_edit_height = 24,
+  font_picker_list_height = font_preview_row_height * 10,
+  ID_FONT_PICKER_EDIT = 1,
+  ID_FONT_PICKER_LIST = 2,
+};
+
+struct font_picker {
+  HWND window;
+  HWND edit;
+  HWND list;
+  struct similar_request const *req; // the result shown
+  struct similar_request *owned;     // req if it arrived while the picker is open, freed when it closes
+  // All fonts but the ones of req->result ranked for req->query by the worker, NULL until it arrives.
+  struct font_similar *ranked;
+  size_t nranked;
+  bool ranking;     // the ranking is requested from the worker
+  bool rank_failed; // the rows after req->result are dropped instead of requesting it again
+  bool done;
+  bool chosen;
+  wchar_t name[font_name_buffer_len];
+};
+
+static wchar_t const g_font_picker_class[] = L"TextAssistFontPicker";
+static bool g_font_picker_registered = false;
+static struct font_picker *g_font_picker = NULL; // the open picker, touched only by the UI thread
+
+// Returns the font of the row, or -1 if it is not ranked yet.
+static int font_picker_row(struct font_picker *const p, size_t const row) {
+  if (row < p->req->num) {
+    return p->req->result[row].idx;
+  }
+  if (!p->ranked) {
+    // A query typed in the picker replaces the rows anyway, so the ranking waits for its result.
+    if (!p->ranking && !p->rank_failed && !g_similar_latest) {
+      p->ranking = true;
+      start_similar_ranking(p->req);
+    }
+    return -1;
+  }
+  size_t const i = row - p->req->num;
+  return i < p->nranked ? p->ranked[i].idx : -1;
+}
+
+// Draws the text of a row that is not copied from the font preview cache in the font selected into the DC.
+static void font_picker_draw_text(DRAWITEMSTRUCT const *const dis, wchar_t const *const text, int const color) {
+  RECT rc = dis->rcItem;
+  rc.left += 4;
+  SetBkMode(dis->hDC, TRANSPARENT);
+  SetTextColor(dis->hDC, GetSysColor((dis->itemState & ODS_SELECTED) ? COLOR_HIGHLIGHTTEXT : color));
+  DrawTextW(dis->hDC, text, -1, &rc, DT_SINGLELINE | DT_VCENTER | DT_NOPREFIX | DT_END_ELLIPSIS);
+}
+
+static void font_picker_draw_item(struct font_picker *const p, DRAWITEMSTRUCT const *const dis) {
+  LARGE_INTEGER start, end;
+  QueryPerformanceCounter(&start);
+  struct font_list const *const fl = &p->req->snapshot->fl;
+  bool const selected = (dis->itemState & ODS_SELECTED) != 0;
+  RECT const rc = dis->rcItem;
+  FillRect(dis->hDC, &rc, GetSysColorBrush(selected ? COLOR_HIGHLIGHT : COLOR_WINDOW));
+  int const idx = dis->itemID < fl->num ? font_picker_row(p, dis->itemID) : -1;
+  if (idx == -1) {
+    font_picker_draw_text(dis, L"…", COLOR_GRAYTEXT); // not ranked yet
+  } else if (selected) {
+    // The slots are rendered on the window color, so the only highlighted row is drawn directly.
+    wchar_t name[font_name_buffer_len];
+    font_list_get_name(fl, (size_t)idx, name);
+    HFONT const font = g_font_preview.dc ? font_preview_get_font(fl, idx) : NULL;
+    HGDIOBJ const old = font ? SelectObject(dis->hDC, font) : NULL;
+    font_picker_draw_text(dis, name, COLOR_WINDOWTEXT);
+    if (font) {
+      SelectObject(dis->hDC, old);
+    }
+  } else {
+    struct font_preview *const c = &g_font_preview;
+    int slot = -1;
+    if (c->dc) {
+      slot = font_preview_find(idx);
+      if (slot != -1) {
+        ++c->hits;
+      } else {
+        ++c->misses;
+        slot = font_preview_render(fl, idx);
+      }
+    }
+    if (slot != -1) {
+      BitBlt(dis->hDC,
+             rc.left,
+             rc.top,
+             rc.right - rc.left < font_preview_width ? rc.right - rc.left : font_preview_width,
+             rc.bottom - rc.top < font_preview_row_height ? rc.bottom - rc.top : font_preview_row_height,
+             c->dc,
+             0,
+             slot * font_preview_row_height,
+             SRCCOPY);
+    } else {
+      wchar_t name[font_name_buffer_len];
+      font_list_get_name(fl, (size_t)idx, name);
+      font_picker_draw_text(dis, name, COLOR_WINDOWTEXT);
+    }
+  }
+  QueryPerformanceCounter(&end);
+  ++g_font_preview.paints;
+  g_font_preview.paint_ticks += end.QuadPart - start.QuadPart;
+}
+
+// Renders one row around the visible ones that is not in the cache yet, and returns false if there is none.
+// The page below the visible rows comes first since the list is usually scrolled down, then the page above.
+// font_preview_slots holds more than three pages, so the visible rows are not replaced.
+static bool font_picker_prerender(struct font_picker *const p) {
+  if (!g_font_preview.dc) {
+    return false;
+  }
+  LRESULT const top = SendMessageW(p->list, LVM_GETTOPINDEX, 0, 0);
+  LRESULT const page = SendMessageW(p->list, LVM_GETCOUNTPERPAGE, 0, 0);
+  struct font_list const *const fl = &p->req->snapshot->fl;
+  for (LRESULT i = 0; i < page * 2; ++i) {
+    LRESULT const row = i < page ? top + page + i : top - page * 2 + i;
+    if (row < 0 || (size_t)row >= fl->num) {
+      continue;
+    }
+    // The rows after the result can not be rendered before the worker ranks them, see font_picker_row.
+    if ((size_t)row >= p->req->num && !p->ranked) {
+      continue;
+    }
+    int const idx = font_picker_row(p, (size_t)row);
+    if (idx == -1 || font_preview_find(idx) != -1) {
+      continue;
+    }
+    if (font_preview_render(fl, idx) == -1) {
+      return false;
+    }
+    ++g_font_preview.prerendered;
+    return true;
+  }
+  return false;
+}
+
+static void font_picker_reset_rows(struct font_picker *const p) {
+  SendMessageW(p->list, LVM_SETITEMCOUNT, (WPARAM)p->req->snapshot->fl.num, 0);
+  LVITEMW item = {
+      .state = LVIS_SELECTED | LVIS_FOCUSED,
+      .stateMask = LVIS_SELECTED | LVIS_FOCUSED,
+  };
+  SendMessageW(p->list, LVM_SETITEMSTATE, 0, (LPARAM)&item);
+  SendMessageW(p->list, LVM_ENSUREVISIBLE, 0, FALSE);
+  InvalidateRect(p->list, NULL, TRUE);
+}
+
+static void font_picker_choose(struct font_picker *const p) {
+  LRESULT const row = SendMessageW(p->list, LVM_GETNEXTITEM, (WPARAM)-1, LVNI_SELECTED);
+  if (row < 0) {
+    return;
+  }
+  int const idx = font_picker_row(p, (size_t)row);
+  if (idx == -1) {
+    return;
+  }
+  font_list_get_name(&p->req->snapshot->fl, (size_t)idx, p->name);
+  p->chosen = true;
+  p->done = true;
+}
+
+// Shows the result of a query typed in the picker, which takes the request over.
+static void font_picker_receive(struct font_picker *const p, struct similar_request *const r) {
+  if (!r->num) {
+    free_similar_request(r);
+    return;
+  }
+  if (p->owned) {
+    free_similar_request(p->owned);
+  }
+  p->owned = r;
+  p->req = r;
+  if (p->ranked) {
+    free(p->ranked);
+    p->ranked = NULL;
+  }
+  p->nranked = 0;
+  p->ranking = false;
+  p->rank_failed = false;
+  font_picker_reset_rows(p);
+}
+
+// Fills the rows after the result with the ranking, or drops them if it failed.
+static void font_picker_receive_ranking(struct font_picker *const p, struct similar_request *const r) {
+  p->ranking = false;
+  if (r->ranked) {
+    p->ranked = r->ranked;
+    p->nranked = r->nranked;
+    r->ranked = NULL;
+    InvalidateRect(p->list, NULL, TRUE);
+  } else {
+    p->rank_failed = true;
+    SendMessageW(p->list, LVM_SETITEMCOUNT, (WPARAM)p->req->num, 0);
+  }
+  free_similar_request(r);
+}
+
+static LRESULT CALLBACK font_picker_window_proc(HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam) {
+  struct font_picker *const p = g_font_picker;
+  switch (message) {
+  case WM_NOTIFY: {
+    NMHDR const *const hdr = (NMHDR const *)lparam;
+    if (!p || hdr->hwndFrom != p->list) {
+      break;
+    }
+    if (hdr->code == LVN_GETDISPINFOW) {
+      LVITEMW *const item = &((NMLVDISPINFOW *)lparam)->item;
+      if ((item->mask & LVIF_TEXT) && item->cchTextMax > 0) {
+        wchar_t name[font_name_buffer_len] = {0};
+        int const idx = font_picker_row(p, (size_t)item->iItem);
+        if (idx != -1) {
+          font_list_get_name(&p->req->snapshot->fl, (size_t)idx, name);
+        }
+        wcsncpy(item->pszText, name, (size_t)item->cchTextMax - 1);
+        item->pszText[item->cchTextMax - 1] = L'\0';
+      }
+      return 0;
+    }
+    if (hdr->code == NM_DBLCLK) {
+      font_picker_choose(p);
+      return 0;
+    }
+    break;
+  }
+  case WM_MEASUREITEM: {
+    // Sent while the list view is created, before g_font_picker is set.
+    MEASUREITEMSTRUCT *const mis = (MEASUREITEMSTRUCT *)lparam;
+    if (mis->CtlID == ID_FONT_PICKER_LIST) {
+      mis->itemHeight = font_preview_row_height;
+      return TRUE;
+    }
+    break;
+  }
+  case WM_DRAWITEM: {
+    DRAWITEMSTRUCT const *const dis = (DRAWITEMSTRUCT const *)lparam;
+    if (p && dis->hwndItem == p->list) {
+      font_picker_draw_item(p, dis);
+      return TRUE;
+    }
+    break;
+  }
+  case WM_COMMAND:
+    if (p && (HWND)lparam == p->edit && HIWORD(wparam) == EN_CHANGE) {
+      wchar_t query[font_name_buffer_len];
+      // Either way a ranking in flight is cancelled.
+      p->ranking = false;
+      if (GetWindowTextW(p->edit, query, font_name_buffer_len) > 0) {
+        start_similar_query(p->edit, p->req->snapshot, query);
+      } else {
+        cancel_similar_query();
+      }
+      return 0;
+    }
+    break;
+  case WM_ACTIVATE:
+    if (p && LOWORD(wparam) == WA_INACTIVE) {
+      p->done = true;
+    }
+    break;
+  case WM_CLOSE:
+    if (p) {
+      p->done = true;
+    }
+    return 0;
+  }
+  return DefWindowProcW(hwnd, message, wparam, lparam);
+}
+
+static bool register_font_picker_class(void) {
+  if (g_font_picker_registered) {
+    return true;
+  }
+  INITCOMMONCONTROLSEX const icc = {
+      .dwSize = sizeof(INITCOMMONCONTROLSEX),
+      .dwICC = ICC_LISTVIEW_CLASSES,
+  };
+  if (!InitCommonControlsEx(&icc)) {
+    ods(L"InitCommonControlsEx failed");
+    return false;
+  }
+  WNDCLASSEXW const wc = {
+      .cbSize = sizeof(WNDCLASSEXW),
+      .lpfnWndProc = font_picker_window_proc,
+      .hInstance = g_hinst,
+      .hCursor = LoadCursorW(NULL, IDC_ARROW),
+      .hbrBackground = (HBRUSH)(COLOR_WINDOW + 1),
+      .lpszClassName = g_font_picker_class,
+  };
+  if (!RegisterClassExW(&wc)) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"RegisterClassExW failed");
+    return false;
+  }
+  g_font_picker_registered = true;
+  return true;
+}
+
+static bool create_font_picker(struct font_picker *const p, HWND owner, POINT pt) {
+  int const height = font_picker_edit_height + font_picker_list_height;
+  MONITORINFO mi = {.cbSize = sizeof(MONITORINFO)};
+  if (GetMonitorInfoW(MonitorFromPoint(pt, MONITOR_DEFAULTTONEAREST), &mi)) {
+    pt.x = pt.x + font_picker_width > mi.rcWork.right ? mi.rcWork.right - font_picker_width : pt.x;
+    pt.y = pt.y + height > mi.rcWork.bottom ? mi.rcWork.bottom - height : pt.y;
+  }
+  p->window = CreateWindowExW(WS_EX_TOOLWINDOW,
+                              g_font_picker_class,
+                              NULL,
+                              WS_POPUP | WS_BORDER,
+                              pt.x,
+                              pt.y,
+                              font_picker_width,
+                              height,
+                              owner,
+                              NULL,
+                              g_hinst,
+                              NULL);
+  if (!p->window) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateWindowEx failed");
+    return false;
+  }
+  RECT rc;
+  GetClientRect(p->window, &rc);
+  p->edit = CreateWindowExW(0,
+                            L"EDIT",
+                            p->req->query,
+                            WS_CHILD | WS_VISIBLE | ES_AUTOHSCROLL,
+                            0,
+                            0,
+                            rc.right,
+                            font_picker_edit_height,
+                            p->window,
+                            (HMENU)ID_FONT_PICKER_EDIT,
+                            g_hinst,
+                            NULL);
+  p->list = CreateWindowExW(0,
+                            WC_LISTVIEWW,
+                            NULL,
+                            WS_CHILD | WS_VISIBLE | LVS_REPORT | LVS_OWNERDATA | LVS_OWNERDRAWFIXED | LVS_SINGLESEL |
+                                LVS_SHOWSELALWAYS | LVS_NOCOLUMNHEADER,
+                            0,
+                            font_picker_edit_height,
+                            rc.right,
+                            rc.bottom - font_picker_edit_height,
+                            p->window,
+                            (HMENU)ID_FONT_PICKER_LIST,
+                            g_hinst,
+                            NULL);
+  if (!p->edit || !p->list) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateWindowEx failed");
+    return false;
+  }
+  SendMessageW(p->edit, WM_SETFONT, (WPARAM)(GetStockObject(DEFAULT_GUI_FONT)), MAKELPARAM(TRUE, 0));
+  SendMessageW(p->edit, EM_LIMITTEXT, font_name_buffer_len - 1, 0);
+  SendMessageW(p->list, WM_SETFONT, (WPARAM)(GetStockObject(DEFAULT_GUI_FONT)), MAKELPARAM(TRUE, 0));
+  SendMessageW(p->list, LVM_SETEXTENDEDLISTVIEWSTYLE, LVS_EX_FULLROWSELECT, LVS_EX_FULLROWSELECT);
+  LVCOLUMNW col = {
+      .mask = LVCF_WIDTH,
+      .cx = rc.right - GetSystemMetrics(SM_CXVSCROLL),
+  };
+  if (SendMessageW(p->list, LVM_INSERTCOLUMNW, 0, (LPARAM)&col) == -1) {
+    ods(L"failed to insert a column");
+    return false;
+  }
+  return true;
+}
+
+// Writes the chosen font name to name, which must hold font_name_buffer_len characters.
+static bool choice_similar_font(HWND hwnd, struct similar_request const *const req, wchar_t *const name) {
   DWORD caret_start = 0, caret_end = 0;
   SendMessageW(hwnd, EM_SCROLLCARET, 0, 0);
   SendMessageW(hwnd, EM_GETSEL, (WPARAM)&caret_start, (LPARAM)&caret_end);
@@ -454,39 +1387,125 @@ static PCWSTR choice_similar_font(struct font_list *fl, HWND hwnd, PCWSTR s) {
   POINT pt = {(int)(short)LOWORD(r), (int)(short)HIWORD(r)};
   if (!ClientToScreen(hwnd, &pt)) {
     ods(L"ClientToScreen failed");
-    return NULL;
+    return false;
+  }
+  if (g_font_picker || !register_font_picker_class()) {
+    return false;
   }
 
-  struct font_similar *similar = font_get_similar(fl, s);
-  if (!similar) {
-    ods(L"failed to get a list of similar font names");
-    return NULL;
+  struct font_picker p = {
+      .req = req,
+  };
+  if (!font_preview_prepare(&req->snapshot->fl)) {
+    ods(L"failed to prepare the font preview, the names are drawn in the default font");
+  }
+  if (!create_font_picker(&p, GetAncestor(hwnd, GA_ROOT), pt)) {
+    goto cleanup;
+  }
+  g_font_picker = &p;
+  font_picker_reset_rows(&p);
+  ShowWindow(p.window, SW_SHOW);
+  SetFocus(p.edit);
+  int const len = GetWindowTextLengthW(p.edit);
+  SendMessageW(p.edit, EM_SETSEL, (WPARAM)len, len);
+  MSG msg;
+  while (!p.done) {
+    if (!PeekMessageW(&msg, NULL, 0, 0, PM_NOREMOVE) && font_picker_prerender(&p)) {
+      continue;
+    }
+    BOOL const got = GetMessageW(&msg, NULL, 0, 0);
+    if (got <= 0) {
+      if (got == 0) {
+        PostQuitMessage((int)msg.wParam);
+      }
+      break;
+    }
+    if (msg.message == WM_KEYDOWN && (msg.hwnd == p.edit || msg.hwnd == p.list)) {
+      if (msg.wParam == VK_RETURN) {
+        font_picker_choose(&p);
+        continue;
+      }
+      if (msg.wParam == VK_ESCAPE) {
+        p.done = true;
+        continue;
+      }
+      // The caret stays in the edit box, and the keys that move through the rows go to the list.
+      if (msg.hwnd == p.edit &&
+          (msg.wParam == VK_UP || msg.wParam == VK_DOWN || msg.wParam == VK_PRIOR || msg.wParam == VK_NEXT)) {
+        SendMessageW(p.list, msg.message, msg.wParam, msg.lParam);
+        continue;
+      }
+    }
+    TranslateMessage(&msg);
+    DispatchMessageW(&msg);
   }
-  HMENU h = CreatePopupMenu();
-  if (!h) {
-    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreatePopupMenu failed");
-    goto failed;
+  g_font_picker = NULL;
+  font_preview_log();
+  // A query typed in the picker is of no use anymore.
+  cancel_similar_query();
+  // Unless the picker was closed by activating another window, the caret goes back to the text.
+  if (GetActiveWindow() == p.window) {
+    SetFocus(hwnd);
   }
-  for (size_t i = 0; i < fl->num && i < 10; ++i) {
-    if (!AppendMenuW(h, MF_ENABLED | MF_STRING, (UINT_PTR)i + 1, fl->sorted[similar[i].idx])) {
-      odshr(HRESULT_FROM_WIN32(GetLastError()), L"AppendMenu failed");
-      goto failed;
-    }
+
+cleanup:
+  if (p.window) {
+    DestroyWindow(p.window);
   }
-  int const id =
-      TrackPopupMenu(h, TPM_TOPALIGN | TPM_LEFTALIGN | TPM_RETURNCMD | TPM_RIGHTBUTTON, pt.x, pt.y, 0, hwnd, NULL);
-  DestroyMenu(h);
+  if (p.owned) {
+    free_similar_request(p.owned);
+  }
+  if (p.ranked) {
+    free(p.ranked);
+  }
+  if (p.chosen) {
+    wcscpy(name, p.name);
+  }
+  return p.chosen;
+}
 
-  PCWSTR ret = id ? fl->sorted[similar[id - 1].idx] : NULL;
-  free(similar);
-  return ret;
+static bool increment_tag_font_name(HWND hwnd,
+                                    struct tag *tag,
+                                    struct font_list_snapshot *const snapshot,
+                                    int const keyCode) {
+  if (g_similar_ready) {
+    // The result of the query started for this name has arrived, see receive_similar_result.
+    wchar_t name[font_name_buffer_len];
+    if (wcscmp(tag->value.font.name, g_similar_ready->query) != 0) {
+      return false;
+    }
+    if (!choice_similar_font(hwnd, g_similar_ready, name)) {
+      return false;
+    }
+    wcscpy(tag->value.font.name, name);
+    font_usage_record(get_font_usage(), name);
+    return true;
+  }
 
-failed:
-  if (similar) {
-    free(similar);
+  struct font_list const *const fl = &snapshot->fl;
+  int const fidx = font_list_index_of(fl, tag->value.font.name);
+  if (fidx != -1 && g_settings.family_step) {
+    // Up and down step through the weights of the family, and with Shift through the families.
+    int const v = choice_by_arrow_up_downi(keyCode, -1, 1, -1, 1);
+    if (!v) {
+      return false;
+    }
+    size_t const idx = GetKeyState(VK_SHIFT) < 0 ? font_list_step_family(fl, (size_t)fidx, v)
+                                                 : font_list_step_in_family(fl, (size_t)fidx, v);
+    font_list_get_name(fl, idx, tag->value.font.name);
+    return true;
   }
-  DestroyMenu(h);
-  return NULL;
+  if (fidx != -1) {
+    int const v = choice_by_arrow_up_downi(keyCode, -1, 1, -10, 10);
+    if (!v) {
+      return false;
+    }
+    font_list_get_name(fl, (size_t)saturatei(fidx + v, 0, (int)fl->num - 1), tag->value.font.name);
+    return true;
+  }
+
+  start_similar_query(hwnd, snapshot, tag->value.font.name);
+  return false;
 }
 
 static bool increment_tag_font(HWND hwnd, struct tag *tag, int const pos, int const keyCode) {
@@ -501,23 +1520,16 @@ static bool increment_tag_font(HWND hwnd, struct tag *tag, int const pos, int co
   }
     return true;
   case 1: {
-    int const fidx = font_list_index_of(&g_font_name_list, tag->value.font.name);
-    if (fidx != -1) {
-      int const v = choice_by_arrow_up_downi(keyCode, -1, 1, -10, 10);
-      if (!v) {
-        return false;
-      }
-      wcscpy(tag->value.font.name, g_font_name_list.sorted[saturatei(fidx + v, 0, (int)g_font_name_list.num - 1)]);
-      return true;
-    }
-
-    PCWSTR s = choice_similar_font(&g_font_name_list, hwnd, tag->value.font.name);
-    if (!s) {
+    // Size and style stay editable while the font list is still being built.
+    struct font_list_snapshot *const snapshot = acquire_font_list(font_list_wait_timeout_ms);
+    if (!snapshot) {
+      ods(L"font list is not ready yet");
       return false;
     }
-    wcscpy(tag->value.font.name, s);
+    bool const r = increment_tag_font_name(hwnd, tag, snapshot, keyCode);
+    release_font_list(snapshot);
+    return r;
   }
-    return true;
   case 2: {
     int const v = choice_by_arrow_up_downi(keyCode, -1, 1, -1, 1);
     if (!v) {
@@ -721,12 +1733,6 @@ static wchar_t *get_text_from_window(HWND hwnd, int *length) {
   return str;
 }
 
-static struct settings {
-  wchar_t filepath[MAX_PATH];
-  bool psdtoolkit_installed;
-  bool prefer_pp;
-} g_settings = {0};
-
 static bool insert_tag(HWND hwnd) {
   DWORD caret_start = 0, caret_end = 0;
   SendMessageW(hwnd, EM_SCROLLCARET, 0, 0);
@@ -1035,14 +2041,180 @@ failed:
   return false;
 }
 
+enum {
+  font_completion_max_items = 20,
+};
+
+// Shows the names that start with the part of the font name before the caret, and replaces the whole font name
+// with the chosen one. *in_font_name is set if the caret is in the font name of a tag.
+static bool complete_font_name(HWND hwnd, bool *const in_font_name) {
+  *in_font_name = false;
+  DWORD caret_start = 0, caret_end = 0;
+  SendMessageW(hwnd, EM_GETSEL, (WPARAM)&caret_start, (LPARAM)&caret_end);
+  if (caret_start != caret_end) {
+    return false;
+  }
+  int len = 0;
+  wchar_t *str = get_text_from_window(hwnd, &len);
+  if (!str) {
+    return false;
+  }
+  bool ret = false;
+  struct font_list_snapshot *snapshot = NULL;
+  HMENU h = NULL;
+  wchar_t *str2 = NULL;
+  struct tag tag = {0};
+  if (!find_tag(str, len, (int)caret_start, &tag) ||
+      (tag.type != tag_type_font && tag.type != tag_type_font_relative) ||
+      get_caret_tag_value_index(&tag, (int)caret_start) != 1) {
+    goto cleanup;
+  }
+  *in_font_name = true;
+  int const namepos = tag.value_pos[1];
+  int const prefixlen = (int)caret_start - namepos;
+  if (prefixlen >= font_name_buffer_len) {
+    goto cleanup;
+  }
+  wchar_t prefix[font_name_buffer_len];
+  memcpy(prefix, str + namepos, (size_t)prefixlen * sizeof(WCHAR));
+  prefix[prefixlen] = L'\0';
+
+  snapshot = acquire_font_list(font_list_wait_timeout_ms);
+  if (!snapshot) {
+    ods(L"font list is not ready yet");
+    goto cleanup;
+  }
+  struct font_list const *const fl = &snapshot->fl;
+  size_t first = 0, last = 0;
+  if (!font_list_prefix_range(fl, prefix, &first, &last)) {
+    ods(L"failed to find the names that start with the prefix");
+    goto cleanup;
+  }
+  if (first == last) {
+    goto cleanup;
+  }
+
+  LRESULT r = SendMessageW(hwnd, EM_POSFROMCHAR, (WPARAM)namepos, 0);
+  POINT pt = {(int)(short)LOWORD(r), (int)(short)HIWORD(r)};
+  if (!ClientToScreen(hwnd, &pt)) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"ClientToScreen failed");
+    goto cleanup;
+  }
+  h = CreatePopupMenu();
+  if (!h) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreatePopupMenu failed");
+    goto cleanup;
+  }
+  size_t const n = last - first < font_completion_max_items ? last - first : font_completion_max_items;
+  wchar_t name[font_name_buffer_len];
+  for (size_t i = 0; i < n; ++i) {
+    font_list_get_name(fl, first + i, name);
+    if (!AppendMenuW(h, MF_ENABLED | MF_STRING, (UINT_PTR)i + 1, name)) {
+      odshr(HRESULT_FROM_WIN32(GetLastError()), L"AppendMenu failed");
+      goto cleanup;
+    }
+  }
+  if (last - first > n) {
+    wchar_t more[64];
+    wsprintfW(more, L"ほか %d 件", (int)(last - first - n));
+    AppendMenuW(h, MF_GRAYED | MF_STRING, 0, more);
+  }
+  int const id =
+      TrackPopupMenu(h, TPM_TOPALIGN | TPM_LEFTALIGN | TPM_RETURNCMD | TPM_RIGHTBUTTON, pt.x, pt.y, 0, hwnd, NULL);
+  if (!id) {
+    goto cleanup;
+  }
+  font_list_get_name(fl, first + (size_t)id - 1, name);
+
+  int const namelen = (int)wcslen(name);
+  int const rest = namepos + tag.value_len[1];
+  str2 = realloc(NULL, sizeof(WCHAR) * (size_t)(len - tag.value_len[1] + namelen + 1));
+  if (!str2) {
+    ods(L"failed to allocate modified text buffer");
+    goto cleanup;
+  }
+  memcpy(str2, str, (size_t)namepos * sizeof(WCHAR));
+  memcpy(str2 + namepos, name, (size_t)namelen * sizeof(WCHAR));
+  memcpy(str2 + namepos + namelen, str + rest, (size_t)(len - rest + 1) * sizeof(WCHAR));
+  if (!SetWindowTextW(hwnd, str2)) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"SetWindowText failed");
+    goto cleanup;
+  }
+  SendMessageW(hwnd, EM_SETSEL, (WPARAM)(namepos + namelen), (LPARAM)(namepos + namelen));
+  SendMessageW(hwnd, EM_SCROLLCARET, 0, 0);
+  font_usage_record(get_font_usage(), name);
+  ret = true;
+
+cleanup:
+  if (h) {
+    DestroyMenu(h);
+  }
+  if (snapshot) {
+    release_font_list(snapshot);
+  }
+  if (str2) {
+    free(str2);
+  }
+  free(str);
+  return ret;
+}
+
 static HWND g_exedit_window = NULL;
 
+// Shows the result of the latest query as if the key were pressed again, and drops the stale ones.
+static void receive_similar_result(struct similar_request *const r) {
+  if (r != g_similar_latest) {
+    free_similar_request(r);
+    return;
+  }
+  g_similar_latest = NULL;
+  if (g_font_picker) {
+    if (r->deep) {
+      font_picker_receive_ranking(g_font_picker, r);
+    } else {
+      font_picker_receive(g_font_picker, r);
+    }
+    return;
+  }
+  HWND const hwnd = r->hwnd;
+  bool current = r->num && GetFocus() == hwnd && GetWindowTextLengthW(hwnd) == r->textlen;
+  if (current) {
+    DWORD caret_start = 0, caret_end = 0;
+    SendMessageW(hwnd, EM_GETSEL, (WPARAM)&caret_start, (LPARAM)&caret_end);
+    current = caret_start == r->caret && caret_end == r->caret;
+  }
+  if (current) {
+    g_similar_ready = r;
+    bool const changed = support_input(hwnd, VK_DOWN);
+    g_similar_ready = NULL;
+    if (changed) {
+      UpdateWindow(hwnd);
+      SendMessageW(g_exedit_window, WM_COMMAND, (WPARAM)(MAKELONG(GetDlgCtrlID(hwnd), EN_CHANGE)), (LPARAM)hwnd);
+    }
+  }
+  free_similar_request(r);
+}
+
 static LRESULT WINAPI subclassed_edit_control_window_proc(
     HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam, UINT_PTR uid_subclass, DWORD_PTR ref_data) {
   (void)uid_subclass;
   (void)ref_data;
   switch (message) {
+  case WM_SETCURSOR:
+    if (g_similar_latest && LOWORD(lparam) == HTCLIENT) {
+      SetCursor(LoadCursorW(NULL, IDC_APPSTARTING));
+      return TRUE;
+    }
+    break;
+  case WM_KEYDOWN:
+  case WM_CHAR:
+  case WM_LBUTTONDOWN:
+  case WM_RBUTTONDOWN:
+    // The query in flight is for the text and the caret before this input.
+    cancel_similar_query();
+    break;
   case WM_SYSKEYDOWN:
+    cancel_similar_query();
     if (wparam == VK_DOWN || wparam == VK_UP || wparam == VK_LEFT || wparam == VK_RIGHT) {
       if (support_input(hwnd, wparam)) {
         UpdateWindow(hwnd);
@@ -1063,6 +2235,16 @@ static LRESULT WINAPI subclassed_edit_control_window_proc(
       }
       return 0;
     }
+    if (wparam == 'f' || wparam == 'F') {
+      bool in_font_name = false;
+      if (complete_font_name(hwnd, &in_font_name)) {
+        UpdateWindow(hwnd);
+        SendMessageW(g_exedit_window, WM_COMMAND, (WPARAM)(MAKELONG(GetDlgCtrlID(hwnd), EN_CHANGE)), (LPARAM)hwnd);
+      }
+      if (in_font_name) {
+        return 0;
+      }
+    }
     break;
   }
   return DefSubclassProc(hwnd, message, wparam, lparam);
@@ -1077,14 +2259,15 @@ static LRESULT WINAPI subclassed_exedit_window_proc(
     switch (HIWORD(wparam)) {
     case EN_SETFOCUS:
       if ((GetWindowLongPtrW((HWND)lparam, GWL_STYLE) & ES_MULTILINE) == ES_MULTILINE) {
-        if (!SetWindowSubclass((HWND)lparam, subclassed_edit_control_window_proc, (UINT_PTR)&g_font_name_list, 0)) {
+        if (!SetWindowSubclass((HWND)lparam, subclassed_edit_control_window_proc, (UINT_PTR)&g_font_list_current, 0)) {
           ods(L"拡張編集ウィンドウのサブクラス化に失敗しました");
         }
       }
       break;
     case EN_KILLFOCUS:
       if ((GetWindowLongPtrW((HWND)lparam, GWL_STYLE) & ES_MULTILINE) == ES_MULTILINE) {
-        RemoveWindowSubclass((HWND)lparam, subclassed_edit_control_window_proc, (UINT_PTR)&g_font_name_list);
+        cancel_similar_query();
+        RemoveWindowSubclass((HWND)lparam, subclassed_edit_control_window_proc, (UINT_PTR)&g_font_list_current);
       }
       break;
     }
@@ -1093,12 +2276,133 @@ static LRESULT WINAPI subclassed_exedit_window_proc(
   return DefSubclassProc(hwnd, message, wparam, lparam);
 }
 
+static struct font_list_snapshot *build_font_list(wchar_t const *const cache_path) {
+  struct font_list_snapshot *s = realloc(NULL, sizeof(struct font_list_snapshot));
+  if (!s) {
+    ods(L"failed to allocate font list");
+    return NULL;
+  }
+  *s = (struct font_list_snapshot){.refcount = 1};
+  LARGE_INTEGER freq, start, end;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&start);
+  if (!font_list_create(&s->fl, cache_path)) {
+    ods(L"failed to initialize font list");
+    free(s);
+    return NULL;
+  }
+  QueryPerformanceCounter(&end);
+  ods(L"font list built: %d fonts in %d ms (%s)",
+      (int)s->fl.num,
+      (int)((end.QuadPart - start.QuadPart) * 1000 / freq.QuadPart),
+      s->fl.cache_view ? L"cached" : L"enumerated");
+  struct font_list_memory_usage mu;
+  font_list_memory_usage(&s->fl, &mu);
+  ods(L"font list memory: %d bytes (text %d, restarts %d, signature %d, bigram %d, family %d)%s",
+      (int)mu.total,
+      (int)mu.text,
+      (int)mu.restarts,
+      (int)mu.signature,
+      (int)mu.qgram,
+      (int)mu.family,
+      mu.mapped ? L" mapped" : L"");
+  return s;
+}
+
+static void publish_font_list(struct font_list_snapshot *const s) {
+  struct font_list_snapshot *const old = InterlockedExchangePointer((PVOID volatile *)&g_font_list_current, s);
+  if (!old) {
+    return;
+  }
+  struct font_list_snapshot *head;
+  do {
+    head = InterlockedCompareExchangePointer((PVOID volatile *)&g_font_list_retired, NULL, NULL);
+    old->next = head;
+  } while (InterlockedCompareExchangePointer((PVOID volatile *)&g_font_list_retired, old, head) != head);
+  PostMessageW(g_font_list_window, WM_APP + 2, 0, 0);
+}
+
+static DWORD WINAPI font_list_worker(LPVOID param) {
+  wchar_t const *const cache_path = param;
+  HANDLE const events[2] = {g_font_list_quit, g_font_list_changed};
+  for (;;) {
+    struct font_list_snapshot *const s = build_font_list(cache_path);
+    if (s) {
+      publish_font_list(s);
+    }
+    SetEvent(g_font_list_ready);
+    if (WaitForMultipleObjects(2, events, FALSE, INFINITE) != WAIT_OBJECT_0 + 1) {
+      break;
+    }
+    // Installing a font pack sends WM_FONTCHANGE once per font,
+    // so wait until the notifications stop and rebuild once for the whole burst.
+    DWORD r;
+    do {
+      r = WaitForMultipleObjects(2, events, FALSE, font_list_settle_ms);
+    } while (r == WAIT_OBJECT_0 + 1);
+    if (r != WAIT_TIMEOUT) {
+      break;
+    }
+  }
+  return 0;
+}
+
+static void close_font_list_worker(void) {
+  if (g_font_list_thread) {
+    SetEvent(g_font_list_quit);
+    WaitForSingleObject(g_font_list_thread, INFINITE);
+    CloseHandle(g_font_list_thread);
+    g_font_list_thread = NULL;
+  }
+  if (g_font_list_quit) {
+    CloseHandle(g_font_list_quit);
+    g_font_list_quit = NULL;
+  }
+  if (g_font_list_changed) {
+    CloseHandle(g_font_list_changed);
+    g_font_list_changed = NULL;
+  }
+  if (g_font_list_ready) {
+    CloseHandle(g_font_list_ready);
+    g_font_list_ready = NULL;
+  }
+}
+
+static bool start_font_list_worker(HWND hwnd, wchar_t *const cache_path) {
+  g_font_list_window = hwnd;
+  g_font_list_ready = CreateEventW(NULL, TRUE, FALSE, NULL);
+  g_font_list_changed = CreateEventW(NULL, FALSE, FALSE, NULL);
+  g_font_list_quit = CreateEventW(NULL, TRUE, FALSE, NULL);
+  if (!g_font_list_ready || !g_font_list_changed || !g_font_list_quit) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateEvent failed");
+    goto failed;
+  }
+  g_font_list_thread = CreateThread(NULL, 0, font_list_worker, cache_path, 0, NULL);
+  if (!g_font_list_thread) {
+    odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateThread failed");
+    goto failed;
+  }
+  return true;
+
+failed:
+  close_font_list_worker();
+  return false;
+}
+
 static void initialize(HWND hwnd, void *editp, FILTER *fp) {
   (void)editp;
   (void)fp;
 
-  if (!font_list_create(&g_font_name_list)) {
-    ods(L"failed to initialize font list");
+  wchar_t *const cache_path = g_settings.fontcache_path[0] != L'\0' ? g_settings.fontcache_path : NULL;
+  if (!start_font_list_worker(hwnd, cache_path)) {
+    // Without the worker the list is built here once and never refreshed.
+    struct font_list_snapshot *const s = build_font_list(cache_path);
+    if (s) {
+      publish_font_list(s);
+    }
+  }
+  if (!start_similar_worker()) {
+    ods(L"fuzzy font queries run on the UI thread");
   }
 
   g_exedit_window = FindWindowW(L"ExtendedFilterClass", NULL);
@@ -1107,7 +2411,7 @@ static void initialize(HWND hwnd, void *editp, FILTER *fp) {
     return;
   }
   if (!SetWindowSubclass(
-          g_exedit_window, (SUBCLASSPROC)subclassed_exedit_window_proc, (UINT_PTR)&g_font_name_list, 0)) {
+          g_exedit_window, (SUBCLASSPROC)subclassed_exedit_window_proc, (UINT_PTR)&g_font_list_current, 0)) {
     MessageBoxW(hwnd, L"拡張編集ウィンドウのサブクラス化に失敗しました", CAPTION, MB_ICONERROR);
     return;
   }
@@ -1118,11 +2422,23 @@ static void finalize(HWND hwnd, void *editp, FILTER *fp) {
   (void)editp;
   (void)fp;
   if (g_exedit_window) {
-    RemoveWindowSubclass(g_exedit_window, subclassed_exedit_window_proc, (UINT_PTR)&g_font_name_list);
+    RemoveWindowSubclass(g_exedit_window, subclassed_exedit_window_proc, (UINT_PTR)&g_font_list_current);
   }
   g_exedit_window = NULL;
 
-  font_list_destroy(&g_font_name_list);
+  close_similar_worker();
+  close_font_list_worker();
+  release_retired_font_lists();
+  release_font_list(InterlockedExchangePointer((PVOID volatile *)&g_font_list_current, NULL));
+  font_similar_cache_free(&g_similar_cache);
+  font_preview_destroy();
+  if (g_font_picker_registered) {
+    UnregisterClassW(g_font_picker_class, g_hinst);
+    g_font_picker_registered = false;
+  }
+  if (g_font_usage.dirty && g_settings.fontusage_path[0] != L'\0') {
+    font_usage_save(&g_font_usage, g_settings.fontusage_path);
+  }
 }
 
 static bool find_psdtoolkit(FILTER *fp) {
@@ -1145,8 +2461,10 @@ static bool find_psdtoolkit(FILTER *fp) {
   return false;
 }
 
-static bool get_setting_file_path(HMODULE h, wchar_t *const path, size_t const size) {
-  wchar_t const extension[] = L".ini";
+static bool get_module_file_path_with_extension(HMODULE h,
+                                               wchar_t const *const extension,
+                                               wchar_t *const path,
+                                               size_t const size) {
   wchar_t module_path[MAX_PATH];
   if (!GetModuleFileNameW(h, module_path, MAX_PATH)) {
     odshr(HRESULT_FROM_WIN32(GetLastError()), L"GetModuleFileName failed");
@@ -1169,14 +2487,26 @@ static bool get_setting_file_path(HMODULE h, wchar_t *const path, size_t const s
   return true;
 }
 
+static bool get_setting_file_path(HMODULE h, wchar_t *const path, size_t const size) {
+  return get_module_file_path_with_extension(h, L".ini", path, size);
+}
+
+static bool get_fontcache_file_path(HMODULE h, wchar_t *const path, size_t const size) {
+  return get_module_file_path_with_extension(h, L".fontcache", path, size);
+}
+
+static bool get_fontusage_file_path(HMODULE h, wchar_t *const path, size_t const size) {
+  return get_module_file_path_with_extension(h, L".fontusage", path, size);
+}
+
 enum {
   ID_CHK_PREFER_PP = 1001,
+  ID_CHK_FAMILY_STEP = 1002,
 };
 
-static HINSTANCE g_hinst = NULL;
-
 static BOOL textassist_wndproc(HWND hwnd, UINT message, WPARAM wparam, LPARAM lparam, void *editp, FILTER *fp) {
   static HWND chk_prefer_pp = NULL;
+  static HWND chk_family_step = NULL;
   (void)wparam;
   (void)lparam;
   switch (message) {
@@ -1198,11 +2528,40 @@ static BOOL textassist_wndproc(HWND hwnd, UINT message, WPARAM wparam, LPARAM lp
       break;
     }
     SendMessageW(chk_prefer_pp, WM_SETFONT, (WPARAM)(GetStockObject(DEFAULT_GUI_FONT)), MAKELPARAM(TRUE, 0));
+    chk_family_step = CreateWindowExW(0,
+                                      L"BUTTON",
+                                      L"Alt+上下キーでフォントを同じファミリー内で切り替える（Shift でファミリー間）",
+                                      WS_CHILD | WS_VISIBLE | BS_CHECKBOX,
+                                      10,
+                                      32,
+                                      480 - 20,
+                                      32,
+                                      hwnd,
+                                      (HMENU)ID_CHK_FAMILY_STEP,
+                                      NULL,
+                                      NULL);
+    if (!chk_family_step) {
+      odshr(HRESULT_FROM_WIN32(GetLastError()), L"CreateWindowEx failed");
+      break;
+    }
+    SendMessageW(chk_family_step, WM_SETFONT, (WPARAM)(GetStockObject(DEFAULT_GUI_FONT)), MAKELPARAM(TRUE, 0));
     if (get_setting_file_path(
             g_hinst, g_settings.filepath, sizeof(g_settings.filepath) / sizeof(g_settings.filepath[0]))) {
       g_settings.psdtoolkit_installed = find_psdtoolkit(fp);
       g_settings.prefer_pp = GetPrivateProfileIntW(L"config", L"prefer_pp", 0, g_settings.filepath) != 0;
       SendMessageW(chk_prefer_pp, BM_SETCHECK, g_settings.prefer_pp ? BST_CHECKED : BST_UNCHECKED, 0);
+      g_settings.family_step = GetPrivateProfileIntW(L"config", L"family_step", 0, g_settings.filepath) != 0;
+      SendMessageW(chk_family_step, BM_SETCHECK, g_settings.family_step ? BST_CHECKED : BST_UNCHECKED, 0);
+    }
+    if (!get_fontcache_file_path(g_hinst,
+                                 g_settings.fontcache_path,
+                                 sizeof(g_settings.fontcache_path) / sizeof(g_settings.fontcache_path[0]))) {
+      g_settings.fontcache_path[0] = L'\0';
+    }
+    if (!get_fontusage_file_path(g_hinst,
+                                 g_settings.fontusage_path,
+                                 sizeof(g_settings.fontusage_path) / sizeof(g_settings.fontusage_path[0]))) {
+      g_settings.fontusage_path[0] = L'\0';
     }
     PostMessageW(hwnd, WM_APP + 1, 0, 0);
     break;
@@ -1218,11 +2577,30 @@ static BOOL textassist_wndproc(HWND hwnd, UINT message, WPARAM wparam, LPARAM lp
         WritePrivateProfileStringW(L"config", L"prefer_pp", g_settings.prefer_pp ? L"1" : L"0", g_settings.filepath);
       }
       break;
+    case ID_CHK_FAMILY_STEP:
+      if (g_settings.filepath[0] != L'\0') {
+        g_settings.family_step = SendMessageW(chk_family_step, BM_GETCHECK, 0, 0) != BST_CHECKED;
+        SendMessageW(chk_family_step, BM_SETCHECK, g_settings.family_step ? BST_CHECKED : BST_UNCHECKED, 0);
+        WritePrivateProfileStringW(
+            L"config", L"family_step", g_settings.family_step ? L"1" : L"0", g_settings.filepath);
+      }
+      break;
     }
     break;
   case WM_APP + 1:
     initialize(hwnd, editp, fp);
     break;
+  case WM_APP + 2:
+    release_retired_font_lists();
+    break;
+  case WM_APP + 3:
+    receive_similar_result((struct similar_request *)lparam);
+    break;
+  case WM_FONTCHANGE:
+    if (g_font_list_changed) {
+      SetEvent(g_font_list_changed);
+    }
+    break;
   }
   return FALSE;
 }
@@ -1233,7 +2611,7 @@ EXTERN_C FILTER_DLL __declspec(dllexport) * *__stdcall GetFilterTableList(void)
       .flag =
           FILTER_FLAG_ALWAYS_ACTIVE | FILTER_FLAG_EX_INFORMATION | FILTER_FLAG_DISP_FILTER | FILTER_FLAG_WINDOW_SIZE,
       .x = 480 | FILTER_WINDOW_SIZE_CLIENT,
-      .y = 32 | FILTER_WINDOW_SIZE_CLIENT,
+      .y = 64 | FILTER_WINDOW_SIZE_CLIENT,
       .name = TEXTASSIST_NAME,
       .func_WndProc = textassist_wndproc,
       .information = TEXTASSIST_NAME " " VERSION,
@@ -0,0 +1,211 @@
+#include "thread.h"
+
+#include <stdlib.h>
+
+#ifdef _WIN32
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+
+typedef SRWLOCK thread_mutex;
+typedef CONDITION_VARIABLE thread_cond;
+typedef HANDLE thread_handle;
+
+static bool thread_mutex_init(thread_mutex *const m) {
+  InitializeSRWLock(m);
+  return true;
+}
+static void thread_mutex_exit(thread_mutex *const m) { (void)m; }
+static void thread_mutex_lock(thread_mutex *const m) { AcquireSRWLockExclusive(m); }
+static void thread_mutex_unlock(thread_mutex *const m) { ReleaseSRWLockExclusive(m); }
+
+static bool thread_cond_init(thread_cond *const c) {
+  InitializeConditionVariable(c);
+  return true;
+}
+static void thread_cond_exit(thread_cond *const c) { (void)c; }
+static void thread_cond_wait(thread_cond *const c, thread_mutex *const m) {
+  SleepConditionVariableSRW(c, m, INFINITE, 0);
+}
+static void thread_cond_broadcast(thread_cond *const c) { WakeAllConditionVariable(c); }
+#else
+#  include <pthread.h>
+
+typedef pthread_mutex_t thread_mutex;
+typedef pthread_cond_t thread_cond;
+typedef pthread_t thread_handle;
+
+static bool thread_mutex_init(thread_mutex *const m) { return pthread_mutex_init(m, NULL) == 0; }
+static void thread_mutex_exit(thread_mutex *const m) { pthread_mutex_destroy(m); }
+static void thread_mutex_lock(thread_mutex *const m) { pthread_mutex_lock(m); }
+static void thread_mutex_unlock(thread_mutex *const m) { pthread_mutex_unlock(m); }
+
+static bool thread_cond_init(thread_cond *const c) { return pthread_cond_init(c, NULL) == 0; }
+static void thread_cond_exit(thread_cond *const c) { pthread_cond_destroy(c); }
+static void thread_cond_wait(thread_cond *const c, thread_mutex *const m) { pthread_cond_wait(c, m); }
+static void thread_cond_broadcast(thread_cond *const c) { pthread_cond_broadcast(c); }
+#endif
+
+struct thread_pool {
+  thread_mutex mtx;
+  thread_cond wake; // signaled when a job is posted or the pool is destroyed
+  thread_cond done; // signaled when the last task of the job has returned
+  // The current job, the tasks next..n are not taken yet.
+  thread_pool_task task;
+  void *userdata;
+  size_t n, next, finished;
+  bool busy;
+  bool quit;
+  size_t threads;
+  size_t started;
+  thread_handle handles[];
+};
+
+static void thread_pool_work(struct thread_pool *const p) {
+  thread_mutex_lock(&p->mtx);
+  for (;;) {
+    while (!p->quit && p->next >= p->n) {
+      thread_cond_wait(&p->wake, &p->mtx);
+    }
+    if (p->quit) {
+      break;
+    }
+    size_t const idx = p->next++;
+    thread_pool_task const task = p->task;
+    void *const userdata = p->userdata;
+    thread_mutex_unlock(&p->mtx);
+    task(userdata, idx);
+    thread_mutex_lock(&p->mtx);
+    if (++p->finished == p->n) {
+      thread_cond_broadcast(&p->done);
+    }
+  }
+  thread_mutex_unlock(&p->mtx);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI thread_pool_main(LPVOID param) {
+  thread_pool_work(param);
+  return 0;
+}
+
+static bool thread_start(thread_handle *const h, struct thread_pool *const p) {
+  *h = CreateThread(NULL, 0, thread_pool_main, p, 0, NULL);
+  return *h != NULL;
+}
+
+static void thread_join(thread_handle const h) {
+  WaitForSingleObject(h, INFINITE);
+  CloseHandle(h);
+}
+#else
+static void *thread_pool_main(void *param) {
+  thread_pool_work(param);
+  return NULL;
+}
+
+static bool thread_start(thread_handle *const h, struct thread_pool *const p) {
+  return pthread_create(h, NULL, thread_pool_main, p) == 0;
+}
+
+static void thread_join(thread_handle const h) { pthread_join(h, NULL); }
+#endif
+
+bool thread_pool_create(struct thread_pool **const pool, size_t const threads) {
+  if (!pool) {
+    return false;
+  }
+  *pool = NULL;
+  if (!threads) {
+    return false;
+  }
+  struct thread_pool *p = realloc(NULL, sizeof(struct thread_pool) + (threads - 1) * sizeof(thread_handle));
+  if (!p) {
+    return false;
+  }
+  *p = (struct thread_pool){
+      .threads = threads,
+  };
+  if (!thread_mutex_init(&p->mtx)) {
+    free(p);
+    return false;
+  }
+  if (!thread_cond_init(&p->wake)) {
+    thread_mutex_exit(&p->mtx);
+    free(p);
+    return false;
+  }
+  if (!thread_cond_init(&p->done)) {
+    thread_cond_exit(&p->wake);
+    thread_mutex_exit(&p->mtx);
+    free(p);
+    return false;
+  }
+  *pool = p;
+  for (; p->started < threads - 1; ++p->started) {
+    if (!thread_start(&p->handles[p->started], p)) {
+      thread_pool_destroy(pool);
+      return false;
+    }
+  }
+  return true;
+}
+
+void thread_pool_destroy(struct thread_pool **const pool) {
+  if (!pool || !*pool) {
+    return;
+  }
+  struct thread_pool *const p = *pool;
+  thread_mutex_lock(&p->mtx);
+  p->quit = true;
+  thread_cond_broadcast(&p->wake);
+  thread_mutex_unlock(&p->mtx);
+  for (size_t i = 0; i < p->started; ++i) {
+    thread_join(p->handles[i]);
+  }
+  thread_cond_exit(&p->done);
+  thread_cond_exit(&p->wake);
+  thread_mutex_exit(&p->mtx);
+  free(p);
+  *pool = NULL;
+}
+
+size_t thread_pool_threads(struct thread_pool const *const pool) { return pool ? pool->threads : 1; }
+
+void thread_pool_run(struct thread_pool *const pool,
+                     thread_pool_task const task,
+                     void *const userdata,
+                     size_t const n) {
+  if (pool) {
+    thread_mutex_lock(&pool->mtx);
+  }
+  if (!pool || pool->busy) {
+    if (pool) {
+      thread_mutex_unlock(&pool->mtx);
+    }
+    for (size_t i = 0; i < n; ++i) {
+      task(userdata, i);
+    }
+    return;
+  }
+  pool->busy = true;
+  pool->task = task;
+  pool->userdata = userdata;
+  pool->n = n;
+  pool->next = 0;
+  pool->finished = 0;
+  thread_cond_broadcast(&pool->wake);
+  while (pool->next < pool->n) {
+    size_t const idx = pool->next++;
+    thread_mutex_unlock(&pool->mtx);
+    task(userdata, idx);
+    thread_mutex_lock(&pool->mtx);
+    ++pool->finished;
+  }
+  while (pool->finished < pool->n) {
+    thread_cond_wait(&pool->done, &pool->mtx);
+  }
+  pool->n = 0;
+  pool->next = 0;
+  pool->busy = false;
+  thread_mutex_unlock(&pool->mtx);
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// A fixed set of threads that run the tasks of one job at a time.
+// It uses Win32 threads on Windows and pthreads elsewhere.
+struct thread_pool;
+
+typedef void (*thread_pool_task)(void *const userdata, size_t const idx);
+
+// Creates a pool that runs each job on threads threads, including the thread that calls thread_pool_run,
+// so threads - 1 worker threads are started. *pool is set to NULL on failure.
+bool thread_pool_create(struct thread_pool **const pool, size_t const threads);
+// Stops and joins the worker threads, and sets *pool to NULL.
+void thread_pool_destroy(struct thread_pool **const pool);
+size_t thread_pool_threads(struct thread_pool const *const pool);
+// Calls task(userdata, idx) for each idx in [0, n) on the worker threads and the calling thread,
+// and returns after all of them have returned.
+// While another thread is running a job on the pool, the tasks run on the calling thread only.
+void thread_pool_run(struct thread_pool *const pool,
+                     thread_pool_task const task,
+                     void *const userdata,
+                     size_t const n);
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+# Generates nfkc_table.h from the Unicode Character Database bundled with Python.
+#
+# python3 src/tools/nfkc_table.py > src/nfkc_table.h
+#
+# Re-run this script and commit the result when the Unicode version should be updated.
+
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x110000
+HANGUL_FIRST = 0xAC00
+HANGUL_LAST = 0xD7A3
+
+
+def is_surrogate(cp):
+    return 0xD800 <= cp <= 0xDFFF
+
+
+def utf16(cps):
+    units = []
+    for cp in cps:
+        if cp >= 0x10000:
+            cp -= 0x10000
+            units += [0xD800 | (cp >> 10), 0xDC00 | (cp & 0x3FF)]
+        else:
+            units.append(cp)
+    return units
+
+
+def two_stage(values, shift):
+    # Splits values into blocks of 1 << shift entries up to the last non-zero value and shares the identical blocks.
+    block_size = 1 << shift
+    last = max(cp for cp, v in enumerate(values) if v)
+    limit = (last + block_size) & ~(block_size - 1)
+    index, data, seen = [], [], {}
+    for first in range(0, limit, block_size):
+        block = tuple(values[first : first + block_size])
+        if block not in seen:
+            seen[block] = len(data) >> shift
+            data.extend(block)
+        index.append(seen[block])
+    return limit, index, data
+
+
+def smallest_two_stage(values, index_size, data_size):
+    best = None
+    for shift in range(3, 10):
+        limit, index, data = two_stage(values, shift)
+        if max(index) >= 1 << (8 * index_size):
+            continue
+        size = len(index) * index_size + len(data) * data_size
+        if not best or size < best[0]:
+            best = (size, shift, limit, index, data)
+    return best[1:]
+
+
+def emit_array(out, ctype, name, values, per_line):
+    out.append("static %s const %s[%d] = {" % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        out.append("    " + " ".join("%d," % v for v in values[i : i + per_line]))
+    out.append("};")
+
+
+def main():
+    ccc = [0] * MAX_CODE_POINT
+    decomp = [0] * MAX_CODE_POINT
+    # Offset 0 means no decomposition, identical decompositions share the code units.
+    units = [0]
+    offsets = {}
+    for cp in range(MAX_CODE_POINT):
+        if is_surrogate(cp):
+            continue
+        ch = chr(cp)
+        ccc[cp] = unicodedata.combining(ch)
+        if HANGUL_FIRST <= cp <= HANGUL_LAST:
+            continue  # decomposed algorithmically
+        d = unicodedata.normalize("NFKD", ch)
+        if d != ch:
+            if d not in offsets:
+                u = utf16([ord(c) for c in d])
+                offsets[d] = len(units)
+                units += [len(u)] + u
+            decomp[cp] = offsets[d]
+
+    compositions = []
+    for cp in range(MAX_CODE_POINT):
+        if is_surrogate(cp) or HANGUL_FIRST <= cp <= HANGUL_LAST:
+            continue
+        d = unicodedata.decomposition(chr(cp))
+        if not d or d.startswith("<"):
+            continue
+        pair = [int(x, 16) for x in d.split()]
+        if len(pair) != 2:
+            continue
+        # Excludes composition exclusions and non-starter decompositions.
+        if unicodedata.normalize("NFC", chr(pair[0]) + chr(pair[1])) != chr(cp):
+            continue
+        compositions.append((pair[0], pair[1], cp))
+    compositions.sort()
+
+    ccc_shift, ccc_limit, ccc_index, ccc_data = smallest_two_stage(ccc, 1, 1)
+    decomp_shift, decomp_limit, decomp_index, decomp_data = smallest_two_stage(decomp, 2, 2)
+    assert len(units) < 65536
+
+    out = [
+        "#pragma once",
+        "// Generated by tools/nfkc_table.py from Unicode %s, do not edit." % unicodedata.unidata_version,
+        "",
+        "#include <stdint.h>",
+        "",
+        "// clang-format off",
+        "enum {",
+        "  nfkc_ccc_shift = %d," % ccc_shift,
+        "  nfkc_ccc_limit = 0x%x," % ccc_limit,
+        "  nfkc_decomp_shift = %d," % decomp_shift,
+        "  nfkc_decomp_limit = 0x%x," % decomp_limit,
+        "  nfkc_composition_count = %d," % len(compositions),
+        "};",
+        "",
+        "// Two-stage tables: data[(index[cp >> shift] << shift) + (cp & ((1 << shift) - 1))] for cp < limit.",
+        "",
+        "// Canonical combining class.",
+    ]
+    emit_array(out, "uint8_t", "nfkc_ccc_index", ccc_index, 20)
+    emit_array(out, "uint8_t", "nfkc_ccc_data", ccc_data, 20)
+    out.append("")
+    out.append("// Offset in nfkc_decomp_units of the full compatibility decomposition, 0 if there is none.")
+    emit_array(out, "uint16_t", "nfkc_decomp_index", decomp_index, 16)
+    emit_array(out, "uint16_t", "nfkc_decomp_data", decomp_data, 16)
+    out.append("// The length in UTF-16 code units followed by the code units.")
+    emit_array(out, "uint16_t", "nfkc_decomp_units", units, 12)
+    out.append("")
+    out.append("// Primary composites sorted by the pair of code points.")
+    out.append("static uint32_t const nfkc_compositions[%d][3] = {" % len(compositions))
+    for a, b, c in compositions:
+        out.append("    {0x%04x, 0x%04x, 0x%04x}," % (a, b, c))
+    out.append("};")
+    out.append("// clang-format on")
+    sys.stdout.write("\n".join(out) + "\n")
+    size = len(ccc_index) + len(ccc_data) + 2 * (len(decomp_index) + len(decomp_data) + len(units)) + 12 * len(compositions)
+    sys.stderr.write("tables: %d bytes\n" % size)
+
+
+if __name__ == "__main__":
+    main()